@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Arena.h
+//! \brief Defines a region allocator that constructs objects within large blocks
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <algorithm>          //!< std::max
+#include <cstddef>            //!< size_t
+#include <cstdint>            //!< uintptr_t
+#include <memory>             //!< std::unique_ptr
+#include <new>                //!< placement new
+#include <type_traits>        //!< std::is_trivially_destructible
+#include <utility>            //!< std::forward
+#include <vector>             //!< std::vector
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Arena - Constructs objects consecutively within blocks, releasing them all at once
+  //!
+  //! Objects are never freed individually; they are destroyed in reverse order of creation
+  //! when the arena is destroyed. Objects with non-trivial destructors record a destructor
+  //! within the arena itself, so a block allocation serves many objects.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Arena
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var DefaultBlockSize - Default size of each block, in bytes
+    static constexpr size_t DefaultBlockSize = 4096;
+
+  private:
+    //! \struct Cleanup - Destroys an object  (Linked from the most recent)
+    struct Cleanup
+    {
+      void      (*Destroy)(void*);     //!< Destroys the object
+      void*     Object;                //!< Object
+      Cleanup*  Next;                  //!< Previous cleanup
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    size_t                                      BlockSize;          //!< Size of each block
+    std::vector<std::unique_ptr<unsigned char[]>>  Blocks;          //!< Allocated blocks
+    unsigned char*                              Next = nullptr;     //!< Free space within the current block
+    size_t                                      Free = 0;           //!< Bytes free within the current block
+    Cleanup*                                    Cleanups = nullptr; //!< Most recent cleanup
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit Arena(size_t blockSize = DefaultBlockSize) : BlockSize(blockSize)
+    {}
+
+    Arena(const Arena&) = delete;
+    Arena& operator= (const Arena&) = delete;
+
+    ~Arena()
+    {
+      for (Cleanup* c = Cleanups; c; c = c->Next)
+        c->Destroy(c->Object);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the number of blocks allocated
+    size_t blocks() const  { return Blocks.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Arena::make
+    //! Construct an object within the arena
+    //!
+    //! \param[in] args - Constructor arguments
+    //! \return T& - Object  (Valid until the arena is destroyed)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T, typename... ARGS>
+    T& make(ARGS&&... args)
+    {
+      T* obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<ARGS>(args)...);
+      if (!std::is_trivially_destructible<T>::value)
+        Cleanups = new (allocate(sizeof(Cleanup), alignof(Cleanup))) Cleanup{ [](void* p) { static_cast<T*>(p)->~T(); }, obj, Cleanups };
+      return *obj;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Arena::allocate
+    //! Reserve aligned space, starting a new block when the current block is exhausted
+    ///////////////////////////////////////////////////////////////////////////////
+    void* allocate(size_t size, size_t align)
+    {
+      size_t padding = (align - reinterpret_cast<uintptr_t>(Next) % align) % align;
+      if (!Next || padding + size > Free)
+      {
+        const size_t bytes = std::max(BlockSize, size + align);
+        Blocks.emplace_back(new unsigned char[bytes]);
+        Next = Blocks.back().get();
+        Free = bytes;
+        padding = (align - reinterpret_cast<uintptr_t>(Next) % align) % align;
+      }
+
+      void* p = Next + padding;
+      Next += padding + size;
+      Free -= padding + size;
+      return p;
+    }
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Commands.h
+//! \brief Defines the table of GUI commands, stored within an arena and dispatched by id
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef COMMANDS_H
+#define COMMANDS_H
+
+#include <cstdint>            //!< uint16_t
+#include <stdexcept>          //!< std::out_of_range
+#include <vector>             //!< std::vector
+#include "Arena.h"            //!< hw1::Arena
+#include "Delegate.h"         //!< hw1::Delegate
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Command - GUI command
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Command
+  {
+    uint16_t              Id;         //!< Command id
+    uint16_t              Group;      //!< Id of command group  (eg. File, Help)
+    const char*           Name;       //!< Display name  (String literal)
+    Delegate<void ()>     Execute;    //!< Performs the command
+    Delegate<bool ()>     Permitted;  //!< Whether the command may be executed  (Always, if empty)
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct CommandTable - Commands stored within an arena and indexed directly by id
+  //!
+  //! Commands are constructed consecutively within the arena's blocks rather than allocated
+  //! individually, and are found by indexing an array with their id rather than searching.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct CommandTable
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    uint16_t               First;      //!< Lowest command id
+    Arena                  Storage;    //!< Commands
+    std::vector<Command*>  Index;      //!< Commands by id less First  (Null where no command)
+    std::vector<Command*>  Ordered;    //!< Commands in order of registration
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandTable::CommandTable
+    //! Create an empty table for a range of ids
+    //!
+    //! \param[in] first - Lowest command id
+    //! \param[in] count - [optional] Number of ids expected  (Reserves the index)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit CommandTable(uint16_t first = 0, size_t count = 64) : First(first)
+    {
+      Index.reserve(count);
+      Ordered.reserve(count);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t size() const  { return Ordered.size(); }
+
+    //! Get the commands in order of registration
+    const std::vector<Command*>& commands() const  { return Ordered; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandTable::find const
+    //! Find a command by id
+    //!
+    //! \return Command* - Command, or nullptr if none
+    ///////////////////////////////////////////////////////////////////////////////
+    Command* find(uint16_t id) const
+    {
+      const size_t idx = size_t(id) - First;
+      return id >= First && idx < Index.size() ? Index[idx] : nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandTable::execute const
+    //! Execute a command, if it exists and is permitted
+    //!
+    //! \param[in] id - Command id
+    //! \return bool - True if executed
+    ///////////////////////////////////////////////////////////////////////////////
+    bool execute(uint16_t id) const
+    {
+      const Command* cmd = find(id);
+      if (!cmd || (cmd->Permitted && !cmd->Permitted()))
+        return false;
+
+      cmd->Execute();
+      return true;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandTable::add
+    //! Add a command, replacing any with the same id
+    //!
+    //! \param[in] id - Command id  (Not less than the lowest id of the table)
+    //! \param[in] group - Command group id
+    //! \param[in] name - Display name  (String literal)
+    //! \param[in] execute - Performs the command
+    //! \param[in] permitted - [optional] Whether the command may be executed
+    //! \return Command& - New command
+    //!
+    //! \throw std::out_of_range - Id is less than the lowest id of the table
+    ///////////////////////////////////////////////////////////////////////////////
+    Command& add(uint16_t id, uint16_t group, const char* name, Delegate<void ()> execute, Delegate<bool ()> permitted = {})
+    {
+      if (id < First)
+        throw std::out_of_range("Command id is less than the lowest id of the table");
+
+      Command& cmd = Storage.make<Command>(Command{id, group, name, std::move(execute), std::move(permitted)});
+      if (size_t(id) - First >= Index.size())
+        Index.resize(size_t(id) - First + 1, nullptr);
+      Index[size_t(id) - First] = &cmd;
+      Ordered.push_back(&cmd);
+      return cmd;
+    }
+  };
+
+} // namespace
+
+#endif
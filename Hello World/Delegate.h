@@ -0,0 +1,238 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Delegate.h
+//! \brief Defines callables and events stored inline, without heap allocation
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef DELEGATE_H
+#define DELEGATE_H
+
+#include <cstddef>            //!< size_t
+#include <cstring>            //!< std::memcpy
+#include <new>                //!< placement new
+#include <stdexcept>          //!< std::length_error
+#include <type_traits>        //!< std::decay_t
+#include <utility>            //!< std::forward
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  template <typename SIGNATURE, size_t CAPACITY = 3*sizeof(void*)>
+  struct Delegate;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Delegate - Type-erased callable stored within the delegate itself
+  //!
+  //! Callables (lambdas, function pointers, bound member functions) are stored in a buffer of
+  //! CAPACITY bytes; one that does not fit fails to compile rather than spilling to the heap.
+  //! Invocation is a single indirect call. Trivially copyable callables, which include
+  //! lambdas capturing only pointers, are copied without calling through a manager.
+  //!
+  //! \tparam R - Return type
+  //! \tparam ARGS - Argument types
+  //! \tparam CAPACITY - Bytes of inline storage  (Default holds a lambda capturing three pointers)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename R, typename... ARGS, size_t CAPACITY>
+  struct Delegate<R (ARGS...), CAPACITY>
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  private:
+    //! \enum Operation - Lifetime operations of a stored callable
+    enum class Operation { Copy, Move, Destroy };
+
+    //! \alias invoke_t - Calls the stored callable
+    using invoke_t = R (*)(void*, ARGS&&...);
+
+    //! \alias manage_t - Copies, moves or destroys the stored callable  (Null when trivial)
+    using manage_t = void (*)(Operation, void*, void*);
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    alignas(std::max_align_t) unsigned char  Storage[CAPACITY];   //!< Stored callable
+    invoke_t                                 Invoke = nullptr;    //!< Calls the callable  (Null when empty)
+    manage_t                                 Manage = nullptr;    //!< Manages the callable's lifetime  (Null when trivial)
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    Delegate() = default;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Delegate::Delegate
+    //! Store a callable
+    //!
+    //! \param[in] func - Callable as R(ARGS...)  (Must fit within CAPACITY bytes)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC, typename = std::enable_if_t<!std::is_same<std::decay_t<FUNC>, Delegate>::value>>
+    Delegate(FUNC&& func)
+    {
+      using callable_t = std::decay_t<FUNC>;
+      static_assert(sizeof(callable_t) <= CAPACITY, "Callable exceeds the inline storage of the delegate");
+      static_assert(alignof(callable_t) <= alignof(std::max_align_t), "Callable is over-aligned");
+      static_assert(std::is_nothrow_move_constructible<callable_t>::value, "Callable must be nothrow movable");
+
+      new (Storage) callable_t(std::forward<FUNC>(func));
+      Invoke = [](void* f, ARGS&&... args) -> R {
+        return (*static_cast<callable_t*>(f))(std::forward<ARGS>(args)...);
+      };
+      if (!std::is_trivially_copyable<callable_t>::value || !std::is_trivially_destructible<callable_t>::value)
+        Manage = [](Operation op, void* dest, void* src) {
+          switch (op)
+          {
+          case Operation::Copy:    new (dest) callable_t(*static_cast<const callable_t*>(src));  break;
+          case Operation::Move:    new (dest) callable_t(std::move(*static_cast<callable_t*>(src)));  break;
+          case Operation::Destroy: static_cast<callable_t*>(dest)->~callable_t();  break;
+          }
+        };
+    }
+
+    Delegate(const Delegate& r) : Invoke(r.Invoke), Manage(r.Manage)
+    {
+      if (Manage)
+        Manage(Operation::Copy, Storage, const_cast<unsigned char*>(r.Storage));
+      else
+        std::memcpy(Storage, r.Storage, CAPACITY);
+    }
+
+    Delegate(Delegate&& r) noexcept
+    {
+      take(r);
+    }
+
+    Delegate& operator= (Delegate r) noexcept
+    {
+      reset();
+      take(r);
+      return *this;
+    }
+
+    ~Delegate()
+    {
+      reset();
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Delegate::bind
+    //! Create a delegate calling a member function of an object
+    //!
+    //! \tparam OBJECT - Object type
+    //! \tparam METHOD - Member function
+    //! \param[in] obj - Object  (Must outlive the delegate)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename OBJECT, R (OBJECT::*METHOD)(ARGS...)>
+    static Delegate bind(OBJECT* obj)
+    {
+      return [obj](ARGS... args) -> R { return (obj->*METHOD)(std::forward<ARGS>(args)...); };
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    explicit operator bool() const  { return Invoke != nullptr; }
+
+    //! Invoke the callable  (Must not be empty)
+    R operator() (ARGS... args) const
+    {
+      return Invoke(const_cast<unsigned char*>(Storage), std::forward<ARGS>(args)...);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //! Release the callable
+    void reset()
+    {
+      if (Manage)
+        Manage(Operation::Destroy, Storage, nullptr);
+      Invoke = nullptr;
+      Manage = nullptr;
+    }
+
+  private:
+    //! Move the callable of another delegate into this empty delegate, leaving the other empty
+    void take(Delegate& r) noexcept
+    {
+      Invoke = r.Invoke;
+      Manage = r.Manage;
+      if (Manage)
+        Manage(Operation::Move, Storage, r.Storage);
+      else
+        std::memcpy(Storage, r.Storage, CAPACITY);
+      r.reset();
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Event - Raises each of a fixed number of handlers, stored inline, in order of registration
+  //!
+  //! Handlers return true to indicate the event was handled, which stops routing to later
+  //! handlers. Registration beyond HANDLERS handlers throws rather than allocating.
+  //!
+  //! \tparam ARGS - Event argument types
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename... ARGS>
+  struct Event
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias handler_t - Event handler
+    using handler_t = Delegate<bool (ARGS...)>;
+
+    //! \var Handlers - Maximum number of handlers
+    static constexpr size_t Handlers = 4;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    handler_t  Items[Handlers];     //!< Handlers, in order of registration
+    size_t     Count = 0;           //!< Number of handlers
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t size() const   { return Count; }
+    bool   empty() const  { return Count == 0; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Event::raise const
+    //! Invoke handlers in order of registration until one handles the event
+    //!
+    //! \param[in] args - Event arguments  (Passed to each handler)
+    //! \return bool - True if handled
+    ///////////////////////////////////////////////////////////////////////////////
+    bool raise(ARGS... args) const
+    {
+      for (size_t idx = 0; idx < Count; ++idx)
+        if (Items[idx](args...))
+          return true;
+      return false;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Event::operator+=
+    //! Register a handler
+    //!
+    //! \param[in] handler - Handler
+    //!
+    //! \throw std::length_error - Event already has the maximum number of handlers
+    ///////////////////////////////////////////////////////////////////////////////
+    Event& operator+= (handler_t handler)
+    {
+      if (Count == Handlers)
+        throw std::length_error("Event has the maximum number of handlers");
+      Items[Count++] = std::move(handler);
+      return *this;
+    }
+
+    //! Remove every handler
+    void clear()
+    {
+      for (size_t idx = 0; idx < Count; ++idx)
+        Items[idx].reset();
+      Count = 0;
+    }
+  };
+
+} // namespace
+
+#endif
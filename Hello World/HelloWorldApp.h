@@ -11,10 +11,15 @@
 //! \def _WIN32_WINNT - Define build target (Windows XP)
 #define _WIN32_WINNT    _WIN32_WINNT_WINXP
 
+#include <string>                             //!< std::basic_string
+#include <utility>                            //!< std::forward
 #include <wtl/WTL.hpp>                        //!< Windows Template Library
 #include <wtl/modules/Application.hpp>        //!< wtl::Application
 #include <wtl/windows/skins/ThemedSkin.hpp>   //!< wtl::ThemedSkin
 #include "MainWindow.h"                       //!< hw1::Mainwindow
+#include "Profiler.h"                         //!< hw1::profile::Profiler
+#include "Startup.h"                          //!< hw1::Startup
+#include "WtlDispatch.h"                      //!< hw1::TableCommand
 
 ///////////////////////////////////////////////////////////////////////////////
 //! \namespace hw1 - Hello World v1 (Drawing demonstration)
@@ -47,9 +52,43 @@ namespace hw1
 
     //! \var encoding - Define app character encoding
     static constexpr wtl::Encoding  encoding = ENC;
-  
-    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+
+    //! \var Name - Full application name  (Transcoded at compile time)
+    static constexpr auto Name = literal<native_char_t<ENC>>("Hello World 1");
+
+    //! \var Version - Application version  (Transcoded at compile time)
+    static constexpr auto Version = literal<native_char_t<ENC>>("v1.00");
 
+    ///////////////////////////////////////////////////////////////////////////////
+    //! \struct AboutCommand - Shows the 'About' dialog  (Followed by the startup timeline and paint
+    //! profile in profiling builds, which the command builds and shows itself)
+    ///////////////////////////////////////////////////////////////////////////////
+    struct AboutCommand : wtl::AboutProgramCommand<ENC>
+    {
+      template <typename... ARGS>
+      AboutCommand(ARGS&&... args) : wtl::AboutProgramCommand<ENC>(std::forward<ARGS>(args)...)
+      {}
+
+      void execute() override
+      {
+#if defined(HW1_PROFILE)
+        // Append the reports to the version  (ASCII, so widened character by character)
+        const std::string report = "\n\n" + Startup::instance().report() + "\n" + profile::Profiler::instance().report();
+        std::basic_string<native_char_t<ENC>> text(Version.c_str());
+        text.append(report.begin(), report.end());
+        messageBox(::GetActiveWindow(), text.c_str(), Name.c_str());
+#else
+        wtl::AboutProgramCommand<ENC>::execute();
+#endif
+      }
+
+    private:
+      static void messageBox(::HWND owner, const char* text, const char* caption)        { ::MessageBoxA(owner, text, caption, MB_OK|MB_ICONINFORMATION); }
+      static void messageBox(::HWND owner, const wchar_t* text, const wchar_t* caption)  { ::MessageBoxW(owner, text, caption, MB_OK|MB_ICONINFORMATION); }
+    };
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
     ///////////////////////////////////////////////////////////////////////////////
     // HelloWorldApp::HelloWorldApp
     //! Create application from handle supplied by WinMain(..)
@@ -58,47 +97,58 @@ namespace hw1
     ///////////////////////////////////////////////////////////////////////////////
     HelloWorldApp(::HMODULE app) : base(app)
     {
-      // Initialize default window skin
-      wtl::ThemedSkin<encoding>::get();
+      // Initialize default window skin once the first frame is shown  (Controls drawn sooner create it upon first use)
+      Startup::instance().defer("skin", [] { wtl::ThemedSkin<encoding>::get(); });
 
       // Register main window class
-      MainWindow<encoding>::registerClass(app);
-
-      //! Populate the program GUI commands  ['File' command grouping]
-      MainWindow<encoding>::CommandGroups += new wtl::CommandGroup<encoding>(wtl::CommandGroupId::File, 
-      { 
-        new wtl::ExitProgramCommand<encoding>(this->window()) 
-      });
-      
-      //! Populate the program GUI commands  ['Help' command grouping]
-      MainWindow<encoding>::CommandGroups += new wtl::CommandGroup<encoding>(wtl::CommandGroupId::Help, 
-      { 
-        new wtl::AboutProgramCommand<encoding>(this->window()) 
-      });
+      {
+        HW1_STARTUP_PHASE("registerClass");
+        MainWindow<encoding>::registerClass(app);
+      }
+
+      // Populate and bind the commands before window creation  (The exit button and menu execute them as soon as they are shown)
+      {
+        HW1_STARTUP_PHASE("commands");
+
+        //! Command table dispatching every GUI command by id  (Menus and the exit button execute through it)
+        CommandTable& commands = MainWindow<encoding>::commands();
+
+        //! Populate the program GUI commands  ['File' command grouping]
+        MainWindow<encoding>::CommandGroups += new wtl::CommandGroup<encoding>(wtl::CommandGroupId::File, 
+        { 
+          new TableCommand<wtl::ExitProgramCommand<encoding>>(commands, wtl::CommandId::App_Exit, wtl::CommandGroupId::File, "Exit", this->window()) 
+        });
+        
+        //! Populate the program GUI commands  ['Help' command grouping]
+        MainWindow<encoding>::CommandGroups += new wtl::CommandGroup<encoding>(wtl::CommandGroupId::Help, 
+        { 
+          new TableCommand<AboutCommand>(commands, wtl::CommandId::App_About, wtl::CommandGroupId::Help, "About", this->window()) 
+        });
+      }
     }
 
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
     
     /////////////////////////////////////////////////////////////////////////////////////////
     // HelloWorldApp::name const 
-    //! Get the application name
+    //! Get the application name  (wtl's interface returns a copy; callers within the program use Name)
     //!
-    //! \return String<encoding> - Full application name
+    //! \return String<encoding> - Full application name  (Copied from native characters; no transcoding)
     /////////////////////////////////////////////////////////////////////////////////////////
     wtl::String<encoding> name() const override
     {
-      return "Hello World 1";
+      return Name.c_str();
     }
     
     /////////////////////////////////////////////////////////////////////////////////////////
     // HelloWorldApp::version const 
-    //! Get the application version
+    //! Get the application version  (wtl's interface returns a copy; callers within the program use Version)
     //!
-    //! \return String<encoding> - Version string
+    //! \return String<encoding> - Version string  (Copied from native characters; no transcoding)
     /////////////////////////////////////////////////////////////////////////////////////////
     wtl::String<encoding> version() const override 
     {
-      return "v1.00";
+      return Version.c_str();
     }
 
     // ----------------------------------- MUTATOR METHODS ----------------------------------  
@@ -113,17 +163,33 @@ namespace hw1
     ///////////////////////////////////////////////////////////////////////////////
     void onStart(wtl::ShowWindowFlags mode) override
     {
-      // Create window
-      this->window().create();
+      // Create window  (Which sizes the render thread, so it draws the first frame while the window is shown)
+      {
+        HW1_STARTUP_PHASE("create");
+        this->window().create();
+      }
     
       // Show window
-      this->window().show(mode);
-      this->window().update();
+      {
+        HW1_STARTUP_PHASE("show");
+        this->window().show(mode);
+      }
+
+      // Paint window
+      {
+        HW1_STARTUP_PHASE("update");
+        this->window().update();
+      }
     }
 
-    // ----------------------------------- REPRESENTATION -----------------------------------
   };
 
+  template <wtl::Encoding ENC>
+  constexpr decltype(HelloWorldApp<ENC>::Name) HelloWorldApp<ENC>::Name;
+
+  template <wtl::Encoding ENC>
+  constexpr decltype(HelloWorldApp<ENC>::Version) HelloWorldApp<ENC>::Version;
+
   ///////////////////////////////////////////////////////////////////////////////
   //! \alias application_t - Define ANSI/UNICODE application type according to build settings (Size of TCHAR)
   ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\ImageFile.h
+//! \brief Defines streaming of pixel rows into memory-mapped PPM and PNG files
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef IMAGE_FILE_H
+#define IMAGE_FILE_H
+
+#include <algorithm>          //!< std::min
+#include <cstdint>            //!< uint32_t
+#include <cstdio>             //!< std::snprintf
+#include <cstring>            //!< std::memcpy
+#include "MappedFile.h"       //!< hw1::MappedOutputFile
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum ImageFormat - Image file formats
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class ImageFormat
+  {
+    PPM,    //!< Binary portable pixmap  (P6)
+    PNG,    //!< Portable network graphics  (Stored deflate blocks)
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Crc32 - CRC-32 of PNG chunks  (Polynomial 0xEDB88320)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Crc32
+  {
+    uint32_t  Table[256] {};
+
+    constexpr Crc32()
+    {
+      for (uint32_t n = 0; n < 256; ++n)
+      {
+        uint32_t c = n;
+        for (int k = 0; k < 8; ++k)
+          c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        Table[n] = c;
+      }
+    }
+
+    //! Continue a CRC over a range of bytes  (Begin with 0)
+    uint32_t update(uint32_t crc, const uint8_t* data, size_t length) const
+    {
+      crc = ~crc;
+      for (const uint8_t* end = data + length; data != end; ++data)
+        crc = Table[(crc ^ *data) & 0xFF] ^ (crc >> 8);
+      return ~crc;
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ImageWriter - Writes rows of 0xAARRGGBB pixels, top to bottom, into a mapped image file
+  //!
+  //! The size of the file is calculated in advance so each row is converted to RGB directly
+  //! within the mapping, without an intermediate copy of the image. PNG data is stored
+  //! uncompressed, in deflate blocks of whole rows, so its layout is equally predictable;
+  //! rows must therefore be no wider than 21844 pixels.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ImageWriter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var MaxBlock - Largest payload of a stored deflate block
+    static constexpr size_t MaxBlock = 65535;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    MappedOutputFile  File;                  //!< Output file
+    ImageFormat       Format = ImageFormat::PPM;  //!< File format
+    int32_t           Width = 0,             //!< Width in pixels
+                      Height = 0,            //!< Height in pixels
+                      Row = 0;               //!< Rows written
+    uint64_t          Offset = 0;            //!< File offset of next row
+    size_t            RowBytes = 0;          //!< Bytes of each encoded row
+    int32_t           BlockRows = 0;         //!< Rows of each PNG block
+    uint32_t          Adler = 1;             //!< Adler-32 of the PNG image data
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    int32_t   rows() const      { return Row; }
+    bool      complete() const  { return Row == Height; }
+    uint64_t  size() const  { return File.size(); }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ImageWriter::fileSize
+    //! Calculate the size of an image file  (Zero if the format cannot represent the image)
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64_t fileSize(ImageFormat format, int32_t width, int32_t height)
+    {
+      if (width <= 0 || height <= 0)
+        return 0;
+
+      if (format == ImageFormat::PPM)
+        return ppmHeader(nullptr, width, height) + uint64_t(width) * 3 * height;
+
+      const size_t rowBytes = 1 + size_t(width) * 3;
+      if (rowBytes > MaxBlock)
+        return 0;
+      const int32_t blockRows = int32_t(MaxBlock / rowBytes),
+                    blocks = (height + blockRows-1) / blockRows;
+      //     signature + IHDR  + zlib header + blocks: chunk, block header     + rows                     + Adler-32 + IEND
+      return 8 + 25 + (12+2) + uint64_t(blocks) * (12+5) + uint64_t(rowBytes) * height + (12+4) + 12;
+    }
+
+  private:
+    //! Format the PPM header  (Returns its length)
+    static size_t ppmHeader(char* out, int32_t width, int32_t height)
+    {
+      char buffer[48];
+      const int length = std::snprintf(buffer, sizeof(buffer), "P6\n%d %d\n255\n", width, height);
+      if (out)
+        std::memcpy(out, buffer, size_t(length));
+      return size_t(length);
+    }
+
+    //! Get the shared CRC table
+    static const Crc32& crc()
+    {
+      static constexpr Crc32 table;
+      return table;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ImageWriter::create
+    //! Create an image file of the final size and write its header
+    //!
+    //! \param[in] path - Full path
+    //! \param[in] format - File format
+    //! \param[in] width - Width in pixels
+    //! \param[in] height - Height in pixels
+    //! \return bool - False if the file could not be created or the format cannot represent the image
+    ///////////////////////////////////////////////////////////////////////////////
+    bool create(const char* path, ImageFormat format, int32_t width, int32_t height)
+    {
+      const uint64_t size = fileSize(format, width, height);
+      if (!size || !File.create(path, size))
+        return false;
+
+      Format = format;
+      Width = width;
+      Height = height;
+      Row = 0;
+      Adler = 1;
+      if (format == ImageFormat::PPM)
+      {
+        RowBytes = size_t(width) * 3;
+        Offset = ppmHeader(nullptr, width, height);
+        uint8_t* out = File.map(0, size_t(Offset));
+        if (!out)
+          return false;
+        ppmHeader(reinterpret_cast<char*>(out), width, height);
+        return true;
+      }
+
+      RowBytes = 1 + size_t(width) * 3;
+      BlockRows = int32_t(MaxBlock / RowBytes);
+      Offset = 0;
+
+      // Signature, header and zlib stream header  (Deflate, 32K window, no dictionary, fastest)
+      static constexpr uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+      const uint8_t header[] = { be(width,3), be(width,2), be(width,1), be(width,0),
+                                 be(height,3), be(height,2), be(height,1), be(height,0),
+                                 8, 2, 0, 0, 0 };       // 8-bit RGB, deflate, adaptive filtering, not interlaced
+      const uint8_t zlib[] = { 0x78, 0x01 };
+      return put(signature, sizeof(signature))
+          && chunk("IHDR", header, sizeof(header))
+          && chunk("IDAT", zlib, sizeof(zlib));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ImageWriter::write
+    //! Convert a row of pixels into the file  (Rows are written top to bottom)
+    //!
+    //! \param[in] pixels - Width() pixels as 0xAARRGGBB
+    //! \return bool - False if the file could not be mapped or every row has been written
+    ///////////////////////////////////////////////////////////////////////////////
+    bool write(const uint32_t* pixels)
+    {
+      if (Row >= Height)
+        return false;
+
+      // Begin each PNG block with its chunk and block headers
+      const bool png = Format == ImageFormat::PNG;
+      if (png && Row % BlockRows == 0)
+      {
+        const int32_t count = std::min(BlockRows, Height - Row);
+        const size_t payload = size_t(count) * RowBytes;
+        uint8_t* out = File.map(Offset, 8+5);
+        if (!out)
+          return false;
+        store32(out, uint32_t(5 + payload));
+        std::memcpy(out+4, "IDAT", 4);
+        out[8] = Row + count == Height ? 1 : 0;    // Final block?
+        out[9] = uint8_t(payload);
+        out[10] = uint8_t(payload >> 8);
+        out[11] = uint8_t(~payload);
+        out[12] = uint8_t(~payload >> 8);
+        Offset += 8+5;
+      }
+
+      uint8_t* out = File.map(Offset, RowBytes);
+      if (!out)
+        return false;
+
+      // Convert pixels  (PNG rows begin with their filter type)
+      uint8_t* dst = out;
+      if (png)
+        *dst++ = 0;
+      for (const uint32_t* px = pixels, *end = pixels + Width; px != end; ++px, dst += 3)
+      {
+        dst[0] = uint8_t(*px >> 16);
+        dst[1] = uint8_t(*px >> 8);
+        dst[2] = uint8_t(*px);
+      }
+      Offset += RowBytes;
+      ++Row;
+
+      // Close each PNG block with the CRC of its chunk
+      if (png)
+      {
+        Adler = adler32(Adler, out, RowBytes);
+        if (Row % BlockRows == 0 || Row == Height)
+        {
+          const int32_t count = (Row-1) % BlockRows + 1;
+          const size_t length = 4 + 5 + size_t(count) * RowBytes;
+          const uint64_t start = Offset - length;
+          uint8_t* data = File.map(start, length + 4);
+          if (!data)
+            return false;
+          store32(data + length, crc().update(0, data, length));
+          Offset += 4;
+        }
+      }
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ImageWriter::close
+    //! Complete the file once every row is written, and close it
+    //!
+    //! \return bool - False if rows are missing or the file could not be completed
+    ///////////////////////////////////////////////////////////////////////////////
+    bool close()
+    {
+      bool complete = Row == Height && !File.empty();
+      if (complete && Format == ImageFormat::PNG)
+      {
+        const uint8_t adler[] = { uint8_t(Adler >> 24), uint8_t(Adler >> 16), uint8_t(Adler >> 8), uint8_t(Adler) };
+        complete = chunk("IDAT", adler, sizeof(adler)) && chunk("IEND", nullptr, 0);
+      }
+      File.close();
+      return complete;
+    }
+
+  private:
+    //! Get a byte of a big-endian value
+    static constexpr uint8_t be(int32_t value, int byte)
+    {
+      return uint8_t(uint32_t(value) >> (byte * 8));
+    }
+
+    //! Store a big-endian value
+    static void store32(uint8_t* out, uint32_t value)
+    {
+      out[0] = uint8_t(value >> 24);
+      out[1] = uint8_t(value >> 16);
+      out[2] = uint8_t(value >> 8);
+      out[3] = uint8_t(value);
+    }
+
+    //! Continue an Adler-32 checksum over a range of bytes
+    static uint32_t adler32(uint32_t adler, const uint8_t* data, size_t length)
+    {
+      uint32_t a = adler & 0xFFFF, b = adler >> 16;
+      while (length)
+      {
+        // Defer the modulus for as many bytes as cannot overflow
+        const size_t n = std::min<size_t>(length, 5552);
+        for (const uint8_t* end = data + n; data != end; ++data)
+          b += a += *data;
+        a %= 65521;
+        b %= 65521;
+        length -= n;
+      }
+      return (b << 16) | a;
+    }
+
+    //! Write bytes at the current offset
+    bool put(const uint8_t* data, size_t length)
+    {
+      uint8_t* out = File.map(Offset, length);
+      if (!out)
+        return false;
+      std::memcpy(out, data, length);
+      Offset += length;
+      return true;
+    }
+
+    //! Write a complete chunk at the current offset
+    bool chunk(const char (&type)[5], const uint8_t* data, size_t length)
+    {
+      uint8_t* out = File.map(Offset, 12 + length);
+      if (!out)
+        return false;
+      store32(out, uint32_t(length));
+      std::memcpy(out+4, type, 4);
+      if (length)
+        std::memcpy(out+8, data, length);
+      store32(out+8+length, crc().update(0, out+4, 4+length));
+      Offset += 12 + length;
+      return true;
+    }
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Literal.h
+//! \brief Defines string literals transcoded to a character type at compile time
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef LITERAL_H
+#define LITERAL_H
+
+#include <cstddef>            //!< size_t
+#include <cstdint>            //!< uint32_t
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Literal - String literal stored as a null-terminated array of a character type
+  //!
+  //! Created by hw1::literal() within constant expressions, so declaring one 'static constexpr'
+  //! places the transcoded characters in read-only data and no conversion happens at runtime.
+  //!
+  //! \tparam CHR - Character type  (char: ANSI, wchar_t/char16_t: UTF-16, char32_t: UTF-32)
+  //! \tparam CAPACITY - Size of the array  (Size of the UTF-8 source literal, including its terminator)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename CHR, size_t CAPACITY>
+  struct Literal
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    using char_t = CHR;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    CHR     Text[CAPACITY] {};     //!< Characters  (Null terminated, padded with nulls)
+    size_t  Length = 0;            //!< Number of characters, excluding the terminator
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    constexpr const CHR* c_str() const  { return Text; }
+    constexpr size_t     size() const   { return Length; }
+    constexpr const CHR* begin() const  { return Text; }
+    constexpr const CHR* end() const    { return Text + Length; }
+
+    constexpr CHR operator[] (size_t idx) const  { return Text[idx]; }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // hw1::literal
+  //! Transcode a UTF-8 string literal to a character type  (Intended for constant expressions)
+  //!
+  //! Narrow targets receive code points below 256 as Latin-1 (which Windows-1252 matches above
+  //! 0x9F) and '?' for anything else. 16-bit targets receive UTF-16 with surrogate pairs.
+  //!
+  //! \tparam CHR - Target character type
+  //! \param[in] str - UTF-8 string literal
+  //! \return Literal<CHR,LEN> - Transcoded literal
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename CHR, size_t LEN>
+  constexpr Literal<CHR,LEN> literal(const char (&str)[LEN])
+  {
+    Literal<CHR,LEN> r {};
+    for (size_t idx = 0; idx+1 < LEN && str[idx]; )
+    {
+      // Decode code point
+      const uint32_t lead = uint8_t(str[idx++]);
+      const size_t trail = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+      uint32_t cp = trail == 3 ? lead & 0x07 : trail == 2 ? lead & 0x0F : trail == 1 ? lead & 0x1F : lead;
+      for (size_t n = 0; n < trail && idx+1 < LEN; ++n)
+        cp = (cp << 6) | (uint8_t(str[idx++]) & 0x3F);
+
+      // Encode
+      if (sizeof(CHR) == 1)
+        r.Text[r.Length++] = CHR(cp < 0x100 ? cp : '?');
+      else if (sizeof(CHR) == 2 && cp >= 0x10000)
+      {
+        r.Text[r.Length++] = CHR(0xD800 + ((cp - 0x10000) >> 10));
+        r.Text[r.Length++] = CHR(0xDC00 + ((cp - 0x10000) & 0x3FF));
+      }
+      else
+        r.Text[r.Length++] = CHR(cp);
+    }
+    return r;
+  }
+
+} // namespace
+
+#endif
@@ -8,8 +8,10 @@
 #ifndef MAIN_WINDOW_H
 #define MAIN_WINDOW_H
 
+#include <algorithm>                                            //!< std::min
+#include <atomic>                                               //!< std::atomic
+#include <functional>                                           //!< std::ref
 #include <wtl/WTL.hpp>                                          //!< Windows Template Library
-#include <wtl/utils/Random.hpp>                                 //!< wtl::Random
 #include <wtl/windows/Window.hpp>                               //!< wtl::Window
 #include <wtl/windows/controls/Button.hpp>                      //!< wtl::Button
 #include <wtl/windows/commands/NewDocumentCommand.hpp>          //!< wtl::NewDocumentCommand
@@ -20,6 +22,16 @@
 #include <wtl/windows/commands/PasteClipboardCommand.hpp>       //!< wtl::PasteClipboardCommand
 #include <wtl/windows/commands/AboutProgramCommand.hpp>         //!< wtl::AboutProgramCommand
 #include <wtl/windows/commands/ExitProgramCommand.hpp>          //!< wtl::ExitProgramCommand
+#include "Commands.h"                                           //!< hw1::CommandTable
+#include "Delegate.h"                                           //!< hw1::Event
+#include "Literal.h"                                            //!< hw1::literal
+#include "WtlGraphics.h"                                        //!< hw1::WtlGraphics
+#include "render/Graphics.h"                                    //!< hw1::render::Graphics
+#include "render/LayerCache.h"                                  //!< hw1::render::LayerCache
+#include "render/RenderThread.h"                                //!< hw1::render::RenderThread
+#include "Scene.h"                                              //!< hw1::Scene
+#include "Startup.h"                                            //!< hw1::Startup
+#include "WtlDispatch.h"                                        //!< hw1::TableCommand
 
 
 //! \namespace hw1 - Hello World v1 (Drawing demonstration)
@@ -28,6 +40,24 @@ namespace hw1
   ///////////////////////////////////////////////////////////////////////////////
   //! \struct MainWindow - Main window class
   //! 
+  //! The scene is drawn by the software renderer on a render thread, unless built with HW1_GDI,
+  //! which draws it with GDI within onPaint. Software frames are anti-aliased only when built
+  //! with HW1_ANTIALIAS, since bench/Antialias measures the anti-aliased frame at about 1.6x
+  //! the cost of the aliased frame. Both may also be changed once the window exists.
+  //!
+  //! Software frames draw text with the portable bitmap font until the first frame has been
+  //! shown; creating the GDI fonts and memory bitmap is then deferred to the following frame.
+  //!
+  //! The static layers of software frames (background, river, sign and trees) are drawn once
+  //! per client size into a render::LayerCache, and each frame copies them before drawing the
+  //! bunny and eggs over them. Changing the anti-aliasing or the font also redraws them.
+  //!
+  //! The window procedure handles WM_COMMAND, WM_SHOWWINDOW and WM_DESTROY itself before wtl
+  //! sees them: commands are dispatched by id from an arena-backed hw1::CommandTable and window
+  //! and button events are raised through inline hw1::Event handlers, so dispatching them
+  //! allocates nothing and passes through no wtl handler. wtl still owns the commands of the
+  //! menu, which it allocates once upon startup  (See hw1::TableCommand).
+  //!
   //! \tparam ENC - Window charactrer encoding (Default is UTF-16)
   ///////////////////////////////////////////////////////////////////////////////
   template <wtl::Encoding ENC = wtl::Encoding::UTF16>
@@ -46,6 +76,28 @@ namespace hw1
 
     //! \var encoding - Inherit window character encoding
     static constexpr wtl::Encoding  encoding = base::encoding;
+
+    //! \alias char_t - Define character type of window encoding
+    using char_t = native_char_t<encoding>;
+
+    //! \var Title - Window title  (Transcoded at compile time)
+    static constexpr auto Title = literal<char_t>("Hello World");
+
+    //! \var Goodbye - 'Exit program' button text  (Transcoded at compile time)
+    static constexpr auto Goodbye = literal<char_t>("Goodbye");
+
+    //! \alias scene_t - Define scene type  (Drawn by the software renderer on the render thread)
+    using scene_t = Scene<render::Graphics>;
+
+    //! \alias gdi_scene_t - Define scene type drawn by GDI  (Drawn by onPaint on the UI thread)
+    using gdi_scene_t = Scene<WtlGraphics>;
+
+    //! \enum RenderMode - Define how the scene is drawn
+    enum class RenderMode
+    {
+      Software,     //!< Software renderer on the render thread  (onPaint presents the newest frame)
+      Gdi,          //!< GDI within onPaint
+    };
   
     //! \enum ControlId - Define control Ids
     enum class ControlId : int16_t
@@ -57,7 +109,21 @@ namespace hw1
   
     // ----------------------------------- REPRESENTATION -----------------------------------
   
-    wtl::Button<encoding>  Button1;    //!< 'Exit program' button 
+    wtl::Button<encoding>  Button1;        //!< 'Exit program' button 
+    Event<>                Destroyed;      //!< Raised upon window destruction
+    Event<>                Shown;          //!< Raised when the window is shown or hidden
+    Event<>                ExitClicked;    //!< Raised when the 'Exit program' button is clicked
+    RenderMode             Rendering;      //!< How the scene is drawn  (Accessed only by the UI thread)
+    std::atomic<bool>      Antialias;      //!< Whether software frames are anti-aliased  (About 1.6x the cost of the frame)
+    gdi_scene_t            GdiScene;       //!< Scene drawn within client area by GDI
+    scene_t                Landscape;      //!< Scene drawn within client area by software  (Accessed only by the render thread)
+    GdiTextWriter          TextWriter;     //!< Draws the text of software frames with GDI fonts  (Accessed only by the render thread)
+    std::atomic<bool>      Lettering;      //!< Whether software frames draw text with TextWriter  (Set once the first frame is shown)
+    render::LayerCache     Layers;         //!< Static layers of software frames  (Accessed only by the render thread)
+    uint8_t                LayerStyle;     //!< Anti-aliasing and font of the cached static layers  (Accessed only by the render thread)
+    std::atomic<::HWND>    Notify{};       //!< Window invalidated by each completed frame  (Null before creation and after destruction)
+    static MainWindow*     Instance;       //!< Window receiving the messages handled by WndProc  (Null before creation and after destruction)
+    render::RenderThread   Renderer;       //!< Draws the scene into frames presented by onPaint  (Idle until sized by onCreate)
 
     // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
   
@@ -65,25 +131,42 @@ namespace hw1
     // MainWindow::MainWindow
     //! Create the main window
     ///////////////////////////////////////////////////////////////////////////////
-    MainWindow() : Button1(wtl::window_id(ControlId::Goodbye))
+    MainWindow() : Button1(wtl::window_id(ControlId::Goodbye)),
+                   Rendering(RenderMode::Software),
+                   Antialias(false),
+                   Lettering(false),
+                   LayerStyle(0),
+                   Renderer(0, 0, [this] (render::Framebuffer& frame) { drawFrame(frame); },
+                                      [this] { if (::HWND wnd = Notify.load()) ::InvalidateRect(wnd, nullptr, FALSE); })
     {
       //! Initialize window properties
       this->Size    = wtl::SizeL(640,480);
       this->Style   = wtl::WindowStyle::OverlappedWindow;
       this->StyleEx = wtl::WindowStyleEx::None;
-      this->Text    = "Hello World";
+      this->Text    = Title.c_str();
       
-      //! Listen for window events
-      this->Destroy += new wtl::DestroyWindowEventHandler<encoding>(this, &MainWindow::onDestroy);
-      this->Show    += new wtl::ShowWindowEventHandler<encoding>(this, &MainWindow::onShowWindow);
+      //! Listen for window events  (Raised by WndProc)
+      Destroyed     += Event<>::handler_t::bind<MainWindow, &MainWindow::onDestroy>(this);
+      Shown         += Event<>::handler_t::bind<MainWindow, &MainWindow::onShowWindow>(this);
 
       //! Initialize child controls
       Button1.Position  = wtl::PointL(500,20);
       Button1.Icon      = wtl::icon_resource<encoding>(wtl::CommandId::App_Exit).Handle;
       Button1.Size      = wtl::SizeL(100,50);
-      Button1.Text      = "Goodbye";
+      Button1.Text      = Goodbye.c_str();
       Button1.Visible   = true;
-      Button1.Click    += new wtl::ButtonClickEventHandler<encoding>(this, &MainWindow::onButton1_Click);
+      ExitClicked      += Event<>::handler_t::bind<MainWindow, &MainWindow::onButton1_Click>(this);
+
+      //! Create GDI fonts once the first frame is shown
+      Startup::instance().defer("fonts", [this] { setLettering(true); });
+
+      //! Select build options
+#if defined(HW1_GDI)
+      Rendering = RenderMode::Gdi;
+#endif
+#if defined(HW1_ANTIALIAS)
+      Antialias = true;
+#endif
     }
   
     // ----------------------------------- STATIC METHODS -----------------------------------
@@ -103,8 +186,8 @@ namespace hw1
 
       static wtl::WindowClass<encoding> wc(instance,                                              //!< Registering module
                                            name.c_str(),                                          //!< Class name
-                                           wtl::ClassStyle::HRedraw|wtl::ClassStyle::VRedraw,     //!< Styles (Redraw upon resize)
-                                           base::WndProc,                                         //!< Window procedure
+                                           wtl::ClassStyle::HRedraw|wtl::ClassStyle::VRedraw,     //!< Styles (Repaint upon resize; repaints only present the cached frame)
+                                           &MainWindow::WndProc,                                  //!< Window procedure  (Forwards to wtl's)
                                            wtl::ResourceIdW(),                                    //!< Window menu 
                                            wtl::HCursor(wtl::SystemCursor::Arrow),                //!< Window cursor
                                            wtl::HBrush(wtl::Colour::Green),                       //!< Window background brush 
@@ -115,6 +198,61 @@ namespace hw1
       return wc;
     }
   
+    ///////////////////////////////////////////////////////////////////////////////
+    // MainWindow::WndProc
+    //! Window procedure: dispatches commands and raises window events directly, then forwards to wtl
+    //! 
+    //! Menu commands arrive by command id and the exit button's clicks by its control id. Both
+    //! are handled here, so wtl does not also execute them. Show and destroy notifications are
+    //! raised and then forwarded, so wtl keeps its own bookkeeping.
+    //! 
+    //! \param[in] wnd - Window
+    //! \param[in] message - Message
+    //! \param[in] w - First message parameter
+    //! \param[in] l - Second message parameter
+    //! \return ::LRESULT - Message result
+    ///////////////////////////////////////////////////////////////////////////////
+    static ::LRESULT WINAPI WndProc(::HWND wnd, ::UINT message, ::WPARAM w, ::LPARAM l)
+    {
+      if (MainWindow* window = Instance)
+        switch (message)
+        {
+        case WM_COMMAND:
+          if (!l && commands().execute(LOWORD(w)))
+            return 0;
+          if (l && LOWORD(w) == uint16_t(ControlId::Goodbye) && HIWORD(w) == BN_CLICKED && window->ExitClicked.raise())
+            return 0;
+          break;
+
+        case WM_SHOWWINDOW:
+          window->Shown.raise();
+          break;
+
+        case WM_DESTROY:
+        {
+          window->Destroyed.raise();
+          const ::LRESULT result = base::WndProc(wnd, message, w, l);
+          Instance = nullptr;
+          return result;
+        }
+        }
+      return base::WndProc(wnd, message, w, l);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MainWindow::commands
+    //! Get the program GUI commands  (Populated by the application before window creation)
+    //! 
+    //! \return CommandTable& - Shared command table, indexed from the lowest 'App' command id
+    ///////////////////////////////////////////////////////////////////////////////
+    static CommandTable& commands()
+    {
+      static CommandTable table(uint16_t(std::min(wtl::CommandId::App_Exit, wtl::CommandId::App_About)), 2);
+
+      // Return singleton
+      return table;
+    }
+  
     // ---------------------------------- ACCESSOR METHODS ----------------------------------
   public:
     /////////////////////////////////////////////////////////////////////////////////////////
@@ -129,21 +267,70 @@ namespace hw1
     }
     
     // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // MainWindow::setRenderMode
+    //! Select how the scene is drawn  (UI thread only)
+    //! 
+    //! \param[in] mode - Software renderer or GDI
+    ///////////////////////////////////////////////////////////////////////////////
+    void  setRenderMode(RenderMode mode)
+    {
+      Rendering = mode;
+      if (::HWND wnd = Notify.load())
+      {
+        // Size the render thread, which idles while GDI draws
+        if (mode == RenderMode::Software)
+        {
+          ::RECT client;
+          ::GetClientRect(wnd, &client);
+          Renderer.resize(client.right, client.bottom);
+          Renderer.request();
+        }
+        ::InvalidateRect(wnd, nullptr, FALSE);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MainWindow::setAntialias
+    //! Enable or disable anti-aliasing of software frames  (UI thread only)
+    //! 
+    //! \param[in] enable - Whether edges of ellipses and polygons are anti-aliased
+    ///////////////////////////////////////////////////////////////////////////////
+    void  setAntialias(bool enable)
+    {
+      Antialias = enable;
+      if (Notify.load() && Rendering == RenderMode::Software)
+        Renderer.request();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MainWindow::setLettering
+    //! Select the font of the text of software frames  (UI thread only)
+    //! 
+    //! \param[in] gdi - Whether text is drawn with GDI fonts  (Otherwise the portable bitmap font)
+    ///////////////////////////////////////////////////////////////////////////////
+    void  setLettering(bool gdi)
+    {
+      Lettering = gdi;
+      if (Notify.load() && Rendering == RenderMode::Software)
+        Renderer.request();
+    }
+
   private:    
     ///////////////////////////////////////////////////////////////////////////////
     // MainWindow::onButton1_Click
     //! Called to exits the program when user clicks the exit button
     //! 
-    //! \param[in] args - Message arguments
-    //! \return wtl::LResult - Routing indicating message was handled
+    //! \return bool - True to indicate event was handled
     ///////////////////////////////////////////////////////////////////////////////
-    wtl::LResult  onButton1_Click(wtl::ButtonClickEventArgs<encoding> args) 
+    bool  onButton1_Click() 
     { 
       // Execute 'Exit Program' gui command
-      Button1.execute(wtl::CommandId::App_Exit);
+      commands().execute(uint16_t(wtl::CommandId::App_Exit));
     
       // [Handled] 
-      return {wtl::MsgRoute::Handled, 0}; 
+      return true; 
     }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -156,14 +343,30 @@ namespace hw1
     wtl::LResult  onCreate(wtl::CreateWindowEventArgs<encoding>& args) override
     { 
       // Populate window menu
-      this->Menu += base::CommandGroups[wtl::CommandGroupId::File];
-      this->Menu += base::CommandGroups[wtl::CommandGroupId::Help];
+      {
+        HW1_STARTUP_PHASE("menu");
+        this->Menu += base::CommandGroups[wtl::CommandGroupId::File];
+        this->Menu += base::CommandGroups[wtl::CommandGroupId::Help];
+      }
 
       // Create 'exit' button child ctrl
-      this->Children.create(Button1);
+      {
+        HW1_STARTUP_PHASE("children");
+        this->Children.create(Button1);
 
-      // Show 'exit' button
-      Button1.show(wtl::ShowWindowFlags::Show);
+        // Show 'exit' button
+        Button1.show(wtl::ShowWindowFlags::Show);
+      }
+
+      // Draw the first frame at the client size while the window is shown  (No frame is drawn until the size is known)
+      Instance = this;
+      Notify = this->handle();
+      if (Rendering == RenderMode::Software)
+      {
+        ::RECT client;
+        ::GetClientRect(this->handle(), &client);
+        Renderer.resize(client.right, client.bottom);
+      }
       
       // [Handled] Accept window parameters
       return {wtl::MsgRoute::Handled, 0};
@@ -173,10 +376,13 @@ namespace hw1
     // MainWindow::onDestroy
     //! Called during window destruction
     //! 
-    //! \return wtl::LResult - Routing indicating message was handled
+    //! \return bool - True to indicate event was handled
     ///////////////////////////////////////////////////////////////////////////////
-    wtl::LResult  onDestroy() 
+    bool  onDestroy() 
     { 
+      // Stop invalidating
+      Notify = nullptr;
+
       // Destroy children
       Button1.destroy();
 
@@ -184,7 +390,7 @@ namespace hw1
       this->post(wtl::WindowMessage::Quit);
       
       // [Handled] 
-      return {wtl::MsgRoute::Handled, 0};
+      return true;
     }
   
     ///////////////////////////////////////////////////////////////////////////////
@@ -196,232 +402,98 @@ namespace hw1
     ///////////////////////////////////////////////////////////////////////////////
     wtl::LResult  onPaint(wtl::PaintWindowEventArgs<encoding>& args) override
     {
-      static int32_t numEggs = wtl::Random::number(4,8);
-
-      // Draw background
-      args.Graphics.fill(args.Rect, wtl::StockBrush::Green);
-
-      // Draw river
-      drawRiver(args.Graphics, wtl::PointL(), args.EraseBackground);
-
-      // Draw 'Hello World' sign
-      drawSign(args.Graphics, wtl::PointL(80,80), args.EraseBackground);
-
-      // Draw trees
-      drawTree(args.Graphics, wtl::PointL(450,125), args.EraseBackground);
-      drawTree(args.Graphics, wtl::PointL(350,130), args.EraseBackground);
-      drawTree(args.Graphics, wtl::PointL(425,155), args.EraseBackground);
-      drawTree(args.Graphics, wtl::PointL(360,180), args.EraseBackground);
-      drawTree(args.Graphics, wtl::PointL(410,210), args.EraseBackground);
-
-      // Draw 'Easter Bunny' in front of sign
-      drawEasterBunny(args.Graphics, wtl::PointL(320,340), args.EraseBackground);
+      bool shown = true;
+      if (Rendering == RenderMode::Gdi)
+      {
+        // Draw the invalidated area
+        const uint64_t start = Startup::instance().elapsed();
+        GdiScene.paint(args.Graphics, args.Rect, args.EraseBackground);
+        Startup::instance().frameDrawn(start);
+      }
+      else
+      {
+        // Render at the client size once it settles; meanwhile, stretch the newest complete frame to fit
+        ::RECT client;
+        ::GetClientRect(this->handle(), &client);
+        Renderer.resize(client.right, client.bottom);
+
+        // Present the invalidated area of the newest complete frame  (Until the first frame completes, the class brush erases the background)
+        Renderer.present();
+        const render::Framebuffer& frame = Renderer.frame().Pixels;
+        if (frame.width() == client.right && frame.height() == client.bottom)
+          WtlGraphics::present(args.Graphics, frame, args.Rect);
+        else
+          WtlGraphics::present(args.Graphics, frame, client.right, client.bottom);
+        shown = frame.width() != 0;
+      }
 
-      // Draw 'Easter Eggs' next to easter bunny
-      drawEasterEggs(args.Graphics, wtl::PointL(400, 380), numEggs, args.EraseBackground);
+      // Run deferred initialization once the first frame reaches the screen
+      if (shown && Startup::instance().frameShown())
+      {
+        ::GdiFlush();
+        Startup::instance().release();
+      }
 
       // Handled
       return 0; 
     }
   
     ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::onShowWindow
-    //! Called when window is being shown or hidden
+    // MainWindow::drawFrame
+    //! Called on the render thread to draw the scene into a frame
     //! 
-    //! \param[in] &args - Message arguments 
-    //! \return wtl::LResult - Routing indicating message was handled
-    ///////////////////////////////////////////////////////////////////////////////
-    wtl::LResult  onShowWindow(wtl::ShowWindowEventArgs<encoding> args) 
-    { 
-      // [Handled] 
-      return {wtl::MsgRoute::Handled, 0};
-    }
-  
-  private:
-    ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::drawEasterBunny
-    //! Draws the easter Bunny at a point
+    //! The static layers are copied from the cache, which redraws them only when the frame
+    //! size, anti-aliasing or font changes; the dynamic layers are drawn over them.
     //! 
-    //! \param[in] dc - Device context
-    //! \param[in] pt - Target
-    //! \param[in] erase - Whether to erase before drawing
+    //! \param[in,out] frame - Frame to draw
     ///////////////////////////////////////////////////////////////////////////////
-    void  drawEasterBunny(wtl::DeviceContext& dc, wtl::PointL pt, bool erase)
+    void  drawFrame(render::Framebuffer& frame)
     {
-      // Set body colour
-      dc += wtl::HPen(wtl::PenStyle::Solid, 2, wtl::Colour::Brown);
-      dc += wtl::StockBrush::Wheat;
-
-      // [BODY] Medium elogated ellipse
-      dc.ellipse( wtl::RectL(pt, wtl::SizeL(60,80)) );
+      const uint64_t start = Startup::instance().elapsed();
+      const bool antialias = Antialias.load(),
+                 lettering = Lettering.load();
 
-      // [HEAD] Small circle above
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(10,0), wtl::SizeL(40,-40)) );
-    
-      // [EARS] 2x Small circles above
-      dc += wtl::StockBrush::Snow;
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(0,-60), wtl::SizeL(20,30)) );
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(40,-60), wtl::SizeL(20,30)) );
-
-      // [FEET] 2x Small circles below
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(0,40), wtl::SizeL(20,40)) );
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(40,40), wtl::SizeL(20,40)) );
-
-      // [EYES] 2x Small circles 
-      //dc += wtl::StockBrush::Red;
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(30,-30), wtl::SizeL(10,10)) );
-      dc.ellipse( wtl::RectL(pt+wtl::PointL(15,-30), wtl::SizeL(10,10)) );
-
-      // Cleanup
-      dc.clear();
-    }
-
-    ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::drawEasterEggs
-    //! Draws easter eggs at a point
-    //! 
-    //! \param[in] dc - Device context
-    //! \param[in] pt - Target
-    //! \param[in] numEggs - Number of eggs to draw
-    //! \param[in] erase - Whether to erase before drawing
-    ///////////////////////////////////////////////////////////////////////////////
-    void  drawEasterEggs(wtl::DeviceContext& dc, wtl::PointL pt, const int32_t numEggs, bool erase)
-    {
-      static constexpr wtl::HatchStyle styles[] = { wtl::HatchStyle::Horizontal, wtl::HatchStyle::Vertical, 
-                                                    wtl::HatchStyle::ForwardDiagonal, wtl::HatchStyle::BackwardDiagonal, 
-                                                    wtl::HatchStyle::Cross, wtl::HatchStyle::CrossDiagonal };
-      // Draw egg backgrounds
-      dc += wtl::DrawingMode::Opaque;
-
-      // [EGGS] Draw eggs with random colours
-      for (int32_t idx = 0; idx < numEggs; ++idx)
+      // Redraw the static layers when their appearance changes  (Resizing is detected by the cache)
+      const uint8_t style = uint8_t(1 | (antialias ? 2 : 0) | (lettering ? 4 : 0));
+      if (style != LayerStyle)
       {
-        static constexpr wtl::Colour eggColours[] = { wtl::Colour::Beige, wtl::Colour::Honey, wtl::Colour::Gold, wtl::Colour::Green, wtl::Colour::Magenta, wtl::Colour::Rose,
-                                                      wtl::Colour::Yellow, wtl::Colour::SkyBlue, wtl::Colour::Orange, wtl::Colour::Leaves, wtl::Colour::Teal };
-
-        // Randomize egg properties
-        wtl::HBrush eggBrush(wtl::random_element(styles), wtl::random_element(eggColours));
-        wtl::HPen eggPen(wtl::PenStyle::Solid, 2, wtl::random_element(eggColours));
-      
-        // Set egg colour
-        dc.setBackColour(wtl::random_element(eggColours));
-        dc += eggPen;
-        dc += eggBrush;
-
-        // [EGG] Draw small oval
-        dc.ellipse( wtl::RectL(pt+wtl::PointL(idx*30,0), wtl::SizeL(20,30)) );
-
-        // Cleanup
-        dc.clear();
+        Layers.invalidate();
+        LayerStyle = style;
       }
-    
-    
-    }
 
-    ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::drawRiver
-    //! Draws a river across the screen in an upward arc
-    //! 
-    //! \param[in] dc - Device context
-    //! \param[in] pt - Ignored
-    //! \param[in] erase - Whether to erase before drawing
-    ///////////////////////////////////////////////////////////////////////////////
-    void  drawRiver(wtl::DeviceContext& dc, wtl::PointL pt, bool erase)
-    {
-      // Light blue river & dark highlights
-      dc += wtl::HPen(wtl::PenStyle::Solid, 2, wtl::Colour::Blue);
-      dc += wtl::StockBrush::Cyan;
-
-      ::POINT river[] = { {0, 300},   {200, 280}, {400, 260}, {640, 250},
-                          {640, 300}, {480, 310}, {280, 360}, {120, 420},  {0, 430} };
-
-      // [RIVER] Fill polygon
-      dc.polygon(river);
-
-      // Cleanup
-      dc.clear();
+      auto draw = [&](render::DeviceContext& dc, const render::RectL& rc, scene_t::Layer layers) {
+        dc.setAntialias(antialias);
+        if (lettering)
+          dc.setTextWriter(std::ref(TextWriter));
+        Landscape.paint(dc, rc, true, layers);
+      };
+      Layers.paint(frame, frame.bounds(), Landscape.view()(Landscape.layerBounds(scene_t::Layer::Dynamic)),
+                   [&](render::DeviceContext& dc, const render::RectL& rc) { draw(dc, rc, scene_t::Layer::Static); },
+                   [&](render::DeviceContext& dc, const render::RectL& rc) { draw(dc, rc, scene_t::Layer::Dynamic); });
+      Startup::instance().frameDrawn(start);
     }
   
     ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::drawTree
-    //! Draws a tree at a point
+    // MainWindow::onShowWindow
+    //! Called when window is being shown or hidden
     //! 
-    //! \param[in] dc - Device context
-    //! \param[in] pt - Target
-    //! \param[in] erase - Whether to erase before drawing
+    //! \return bool - True to indicate event was handled
     ///////////////////////////////////////////////////////////////////////////////
-    void  drawTree(wtl::DeviceContext& dc, wtl::PointL pt, bool erase)
-    {
-      // Set dark green outline + light green interior
-      dc += wtl::HPen(wtl::PenStyle::Solid, 2, wtl::Colour::Forest);
-      dc += wtl::StockBrush::Leaves;
-
-      // [LEAVES] Small green triangle
-      dc.triangle( wtl::TriangleL(pt, 50, 50) );
-
-      // Set brown interior + black outline
-      static wtl::HBrush trunkBrush(wtl::HatchStyle::ForwardDiagonal, wtl::Colour::Black);
-      dc += trunkBrush;  
-
-      // Set brown interior + black outline
-      dc.setBackColour(wtl::Colour::Brown);
-      dc += wtl::DrawingMode::Opaque;
-    
-      // [TRUNK] Small brown square
-      dc.rect( wtl::RectL(pt + wtl::PointL(10,2), wtl::SizeL(30,30)) );
-
-      // Cleanup
-      dc.clear();
+    bool  onShowWindow() 
+    { 
+      // [Handled] 
+      return true;
     }
-  
-    ///////////////////////////////////////////////////////////////////////////////
-    // MainWindow::drawSign
-    //! Draws the 'Hello World' sign at a point
-    //! 
-    //! \param[in] dc - Device context
-    //! \param[in] pt - Top left point of sign
-    //! \param[in] erase - Whether to erase before drawing
-    ///////////////////////////////////////////////////////////////////////////////
-    void  drawSign(wtl::DeviceContext& dc, wtl::PointL pt, bool erase)
-    {
-      // Large text
-      static const wtl::HFont largeFont = wtl::DeviceContext::ScreenDC.getFont(wtl::c_str("MS Shell Dlg 2"), 16, wtl::FontWeight::Bold);
-      dc += largeFont;
-
-      // [SIGN] Black outline + brown interior
-      dc += wtl::HPen(wtl::PenStyle::Solid, 2, wtl::Colour::Black);
-      dc += wtl::StockBrush::Brown;
-
-      // [SIGN] Large rectangle
-      wtl::RectL signRect(pt, wtl::SizeL(200,140));
-      dc.rect(signRect);
-    
-      // Set brown interior + black outline
-      static wtl::HBrush legBrush(wtl::HatchStyle::CrossDiagonal, wtl::Colour::Black);
-      dc += legBrush;  
+  };
 
-      // Set brown interior + black outline
-      dc.setBackColour(wtl::Colour::Brown);
-      dc += wtl::DrawingMode::Opaque;
-    
-      // [LEGS] 2x small rectangles below sign
-      dc.rect( wtl::RectL(pt + wtl::PointL(30,140), wtl::SizeL(40,30)) );
-      dc.rect( wtl::RectL(pt + wtl::PointL(130,140), wtl::SizeL(40,30)) );
+  template <wtl::Encoding ENC>
+  constexpr decltype(MainWindow<ENC>::Title) MainWindow<ENC>::Title;
 
-      // Transparent white text
-      dc += wtl::DrawingMode::Transparent;
-      dc.setTextColour(wtl::Colour::White);
-    
-      // [TEXT] Draw sign text
-      dc.write(wtl::c_str("\n Hello World 1"
-                          "\n\n From Windows"
-                          "\n\n Template Library"), signRect, wtl::DrawTextFlags::Centre); 
+  template <wtl::Encoding ENC>
+  constexpr decltype(MainWindow<ENC>::Goodbye) MainWindow<ENC>::Goodbye;
 
-      // Cleanup
-      dc.clear();
-    }
-
-  };
+  template <wtl::Encoding ENC>
+  MainWindow<ENC>* MainWindow<ENC>::Instance = nullptr;
 
 } // namespace
 
@@ -0,0 +1,340 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\MappedFile.h
+//! \brief Defines memory mapping of files for reading and writing
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <algorithm>          //!< std::min
+#include <cstddef>            //!< size_t
+#include <cstdint>            //!< uint8_t
+#include <utility>            //!< std::swap
+#if defined(_WIN32)
+  #include <windows.h>        //!< CreateFileMapping
+#else
+  #include <fcntl.h>          //!< open
+  #include <sys/mman.h>       //!< mmap
+  #include <sys/stat.h>       //!< fstat
+  #include <unistd.h>         //!< close
+#endif
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct MappedFile - Maps the contents of a file into memory for reading  (Move-only)
+  //!
+  //! Pages are loaded on first access, so opening a file costs the same regardless of its
+  //! size. Empty files cannot be mapped.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct MappedFile
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    const uint8_t*  Data = nullptr;     //!< First byte
+    size_t          Size = 0;           //!< Length in bytes
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    MappedFile() = default;
+
+    MappedFile(MappedFile&& r) noexcept : Data(r.Data), Size(r.Size)
+    {
+      r.Data = nullptr;
+      r.Size = 0;
+    }
+
+    MappedFile& operator= (MappedFile&& r) noexcept
+    {
+      if (this != &r)
+      {
+        close();
+        Data = r.Data;
+        Size = r.Size;
+        r.Data = nullptr;
+        r.Size = 0;
+      }
+      return *this;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator= (const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+      close();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    const uint8_t*  data() const  { return Data; }
+    size_t          size() const  { return Size; }
+    bool            empty() const { return Data == nullptr; }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // MappedFile::open
+    //! Map a file, replacing any existing mapping
+    //!
+    //! \param[in] path - Full path
+    //! \return bool - False if the file could not be opened or mapped
+    ///////////////////////////////////////////////////////////////////////////////
+    bool open(const char* path)
+    {
+      close();
+#if defined(_WIN32)
+      HANDLE file = ::CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+      LARGE_INTEGER length;
+      HANDLE mapping = nullptr;
+      if (::GetFileSizeEx(file, &length) && length.QuadPart > 0 && uint64_t(length.QuadPart) <= SIZE_MAX)
+        mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      ::CloseHandle(file);
+      if (!mapping)
+        return false;
+
+      // The view keeps the mapping alive
+      Data = static_cast<const uint8_t*>(::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+      ::CloseHandle(mapping);
+      Size = Data ? size_t(length.QuadPart) : 0;
+#else
+      const int fd = ::open(path, O_RDONLY);
+      if (fd < 0)
+        return false;
+
+      struct stat info;
+      void* view = MAP_FAILED;
+      if (::fstat(fd, &info) == 0 && info.st_size > 0)
+        view = ::mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+      ::close(fd);
+      if (view == MAP_FAILED)
+        return false;
+
+      Data = static_cast<const uint8_t*>(view);
+      Size = size_t(info.st_size);
+#endif
+      return Data != nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MappedFile::close
+    //! Release the mapping  (If any)
+    ///////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      if (!Data)
+        return;
+#if defined(_WIN32)
+      ::UnmapViewOfFile(Data);
+#else
+      ::munmap(const_cast<uint8_t*>(Data), Size);
+#endif
+      Data = nullptr;
+      Size = 0;
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct MappedOutputFile - Creates a file of a fixed size and maps successive windows of it for writing  (Move-only)
+  //!
+  //! Only one window is mapped at a time, so writing a file of any size keeps no more than
+  //! a window of it resident. Pages of previous windows are left to the system to write back.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct MappedOutputFile
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Alignment - Alignment of window offsets  (Allocation granularity of Windows; a multiple of the page size)
+    static constexpr uint64_t Alignment = 65536;
+
+    //! \var DefaultWindow - Default size of each window
+    static constexpr size_t DefaultWindow = 16 << 20;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+#if defined(_WIN32)
+    HANDLE    File = INVALID_HANDLE_VALUE;    //!< File
+    HANDLE    Mapping = nullptr;              //!< File mapping
+#else
+    int       File = -1;                      //!< File descriptor
+#endif
+    uint64_t  Size = 0;                       //!< File length in bytes
+    size_t    Window = DefaultWindow;         //!< Minimum size of each window
+    uint8_t*  View = nullptr;                 //!< First byte of current window
+    uint64_t  ViewOffset = 0;                 //!< File offset of current window
+    size_t    ViewSize = 0;                   //!< Length of current window
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit MappedOutputFile(size_t window = DefaultWindow) : Window(window)
+    {}
+
+    MappedOutputFile(MappedOutputFile&& r) noexcept
+    {
+      swap(r);
+    }
+
+    MappedOutputFile& operator= (MappedOutputFile&& r) noexcept
+    {
+      if (this != &r)
+      {
+        close();
+        swap(r);
+      }
+      return *this;
+    }
+
+    MappedOutputFile(const MappedOutputFile&) = delete;
+    MappedOutputFile& operator= (const MappedOutputFile&) = delete;
+
+    ~MappedOutputFile()
+    {
+      close();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    uint64_t  size() const  { return Size; }
+#if defined(_WIN32)
+    bool      empty() const { return File == INVALID_HANDLE_VALUE; }
+#else
+    bool      empty() const { return File < 0; }
+#endif
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // MappedOutputFile::create
+    //! Create (or truncate) a file of a fixed size, closing any existing file
+    //!
+    //! \param[in] path - Full path
+    //! \param[in] size - Length in bytes  (Non-zero)
+    //! \return bool - False if the file could not be created or sized
+    ///////////////////////////////////////////////////////////////////////////////
+    bool create(const char* path, uint64_t size)
+    {
+      close();
+      if (!size)
+        return false;
+#if defined(_WIN32)
+      File = ::CreateFileA(path, GENERIC_READ|GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (File == INVALID_HANDLE_VALUE)
+        return false;
+
+      // Mapping a file extends it to the size of the mapping
+      Mapping = ::CreateFileMappingA(File, nullptr, PAGE_READWRITE, DWORD(size >> 32), DWORD(size), nullptr);
+      if (!Mapping)
+      {
+        close();
+        return false;
+      }
+#else
+      File = ::open(path, O_RDWR|O_CREAT|O_TRUNC, 0644);
+      if (File < 0)
+        return false;
+
+      if (::ftruncate(File, off_t(size)) != 0)
+      {
+        close();
+        return false;
+      }
+#endif
+      Size = size;
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MappedOutputFile::map
+    //! Get writable memory of a range of the file, mapping a new window if necessary
+    //!
+    //! \param[in] offset - File offset
+    //! \param[in] length - Length in bytes  (Range must lie within the file)
+    //! \return uint8_t* - Memory of the range, valid until the next call; nullptr if it could not be mapped
+    ///////////////////////////////////////////////////////////////////////////////
+    uint8_t* map(uint64_t offset, size_t length)
+    {
+      if (View && offset >= ViewOffset && offset + length <= ViewOffset + ViewSize)
+        return View + (offset - ViewOffset);
+
+      if (empty() || offset + length > Size)
+        return nullptr;
+
+      // Map a window starting at the aligned offset below the range
+      unmap();
+      const uint64_t first = offset & ~(Alignment-1);
+      const size_t span = size_t(std::min<uint64_t>(Size - first, std::max<uint64_t>(Window, offset + length - first)));
+#if defined(_WIN32)
+      View = static_cast<uint8_t*>(::MapViewOfFile(Mapping, FILE_MAP_WRITE, DWORD(first >> 32), DWORD(first), span));
+#else
+      void* view = ::mmap(nullptr, span, PROT_READ|PROT_WRITE, MAP_SHARED, File, off_t(first));
+      View = view != MAP_FAILED ? static_cast<uint8_t*>(view) : nullptr;
+#endif
+      if (!View)
+        return nullptr;
+
+      ViewOffset = first;
+      ViewSize = span;
+      return View + (offset - first);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MappedOutputFile::close
+    //! Release the current window and close the file  (If any)
+    ///////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      unmap();
+#if defined(_WIN32)
+      if (Mapping)
+        ::CloseHandle(Mapping);
+      if (File != INVALID_HANDLE_VALUE)
+        ::CloseHandle(File);
+      Mapping = nullptr;
+      File = INVALID_HANDLE_VALUE;
+#else
+      if (File >= 0)
+        ::close(File);
+      File = -1;
+#endif
+      Size = 0;
+    }
+
+  private:
+    //! Release the current window  (If any)
+    void unmap()
+    {
+      if (!View)
+        return;
+#if defined(_WIN32)
+      ::UnmapViewOfFile(View);
+#else
+      ::munmap(View, ViewSize);
+#endif
+      View = nullptr;
+      ViewOffset = 0;
+      ViewSize = 0;
+    }
+
+    void swap(MappedOutputFile& r) noexcept
+    {
+      std::swap(File, r.File);
+#if defined(_WIN32)
+      std::swap(Mapping, r.Mapping);
+#endif
+      std::swap(Size, r.Size);
+      std::swap(Window, r.Window);
+      std::swap(View, r.View);
+      std::swap(ViewOffset, r.ViewOffset);
+      std::swap(ViewSize, r.ViewSize);
+    }
+  };
+
+} // namespace hw1
+
+#endif
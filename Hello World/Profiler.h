@@ -0,0 +1,413 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Profiler.h
+//! \brief Defines the optional scoped timers that profile the paint path
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+//!
+//! Profiling is compiled only when HW1_PROFILE is defined; otherwise HW1_PROFILE_SCOPE
+//! expands to nothing and this header declares nothing. Define HW1_PROFILE_TSC as well
+//! to time with the processor timestamp counter instead of std::chrono::steady_clock.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#if defined(HW1_PROFILE)
+
+#include <algorithm>          //!< std::max
+#include <atomic>             //!< std::atomic
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdint>            //!< uint64_t
+#include <cstdio>             //!< std::snprintf
+#include <fstream>            //!< std::ofstream
+#include <map>                //!< std::map
+#include <memory>             //!< std::unique_ptr
+#include <mutex>              //!< std::mutex
+#include <string>             //!< std::string
+#include <thread>             //!< std::this_thread
+#include <vector>             //!< std::vector
+#if defined(HW1_PROFILE_TSC)
+  #if defined(_MSC_VER)
+    #include <intrin.h>       //!< __rdtsc
+  #else
+    #include <x86intrin.h>    //!< __rdtsc
+  #endif
+#endif
+
+//! \namespace hw1::profile - Paint path instrumentation
+namespace hw1 { namespace profile
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Event - Timed execution of a named scope
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Event
+  {
+    const char*  Name;          //!< Scope name (String literal)
+    uint64_t     Start,         //!< Start time (Ticks)
+                 End,           //!< End time (Ticks)
+                 Primitives;    //!< Primitives drawn within scope
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct EventRing - Lock-free single-producer/single-consumer ring of events
+  //!
+  //! Each thread writes only into its own ring; the profiler drains every ring when
+  //! collecting. Events are dropped (and counted) rather than blocking when a ring is full.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct EventRing
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Capacity - Number of events  (Power of two)
+    static constexpr size_t Capacity = size_t(1) << 14;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    const uint32_t         Thread;           //!< Thread number
+    std::atomic<uint64_t>  Dropped{0};       //!< Events discarded while full
+
+  private:
+    alignas(64) std::atomic<size_t>  Head{0};    //!< Next slot to write  (Producer)
+    alignas(64) std::atomic<size_t>  Tail{0};    //!< Next slot to read  (Consumer)
+    std::unique_ptr<Event[]>         Items{new Event[Capacity]};
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit EventRing(uint32_t thread) : Thread(thread)
+    {}
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // EventRing::push
+    //! Append an event  (Owning thread only)
+    ///////////////////////////////////////////////////////////////////////////////
+    void push(const Event& e)
+    {
+      const size_t head = Head.load(std::memory_order_relaxed);
+      if (head - Tail.load(std::memory_order_acquire) == Capacity)
+      {
+        Dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      Items[head & (Capacity-1)] = e;
+      Head.store(head+1, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // EventRing::drain
+    //! Remove all available events  (Single consumer only)
+    //!
+    //! \param[in] func - Callable as func(const Event&)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void drain(FUNC&& func)
+    {
+      size_t tail = Tail.load(std::memory_order_relaxed);
+      const size_t head = Head.load(std::memory_order_acquire);
+      for (; tail != head; ++tail)
+        func(Items[tail & (Capacity-1)]);
+      Tail.store(tail, std::memory_order_release);
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Histogram - Log-linear histogram of durations  (Eight buckets per power of two)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Histogram
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Buckets - Number of buckets  (Values below 8 are exact)
+    static constexpr int32_t Buckets = 8 + 61*8;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    uint64_t  Counts[Buckets] = {};   //!< Values within each bucket
+    uint64_t  Count = 0,              //!< Number of values
+              Sum = 0,                //!< Sum of values
+              Max = 0;                //!< Largest value
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Histogram::percentile const
+    //! Estimate a percentile  (Upper bound of the bucket containing it)
+    //!
+    //! \param[in] p - Fraction [0,1]
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64_t percentile(double p) const
+    {
+      const uint64_t rank = std::max<uint64_t>(1, uint64_t(p * Count + 0.5));
+      uint64_t seen = 0;
+      for (int32_t b = 0; b < Buckets; ++b)
+        if ((seen += Counts[b]) >= rank)
+          return std::min(Max, b+1 < Buckets ? lower(b+1) - 1 : Max);
+      return Max;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    void record(uint64_t v)
+    {
+      ++Counts[bucket(v)];
+      ++Count;
+      Sum += v;
+      Max = std::max(Max, v);
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  private:
+    static int32_t bucket(uint64_t v)
+    {
+      if (v < 8)
+        return int32_t(v);
+
+      int32_t e = 0;
+      for (uint64_t t = v; t >>= 1; )
+        ++e;
+      return 8 + (e-3)*8 + int32_t((v >> (e-3)) & 7);
+    }
+
+    static uint64_t lower(int32_t b)
+    {
+      return b < 8 ? uint64_t(b) : uint64_t(8 + (b-8)%8) << ((b-8)/8);
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Profiler - Collects events from all threads into histograms and a trace
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Profiler
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var MaxTraceEvents - Upper bound on events retained for the trace file
+    static constexpr size_t MaxTraceEvents = size_t(1) << 20;
+
+    //! \struct Summary - Statistics of one scope name
+    struct Summary
+    {
+      Histogram  Durations;         //!< Durations (Ticks)
+      uint64_t   Primitives = 0;    //!< Total primitives drawn
+    };
+
+    //! \struct TraceEvent - Event retained for the trace file
+    struct TraceEvent
+    {
+      Event     Data;
+      uint32_t  Thread;
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    std::mutex                               Lock;          //!< Guards all members
+    std::vector<std::unique_ptr<EventRing>>  Rings;         //!< Ring of each thread
+    std::map<std::string,Summary>            Summaries;     //!< Statistics by scope name
+    std::vector<TraceEvent>                  Trace;         //!< Events in collection order
+    uint64_t                                 Dropped = 0;   //!< Events lost to full rings or trace
+    uint64_t                                 Origin;        //!< Time of creation (Ticks)
+    std::chrono::steady_clock::time_point    Created;       //!< Time of creation  (Calibrates the timestamp counter)
+    double                                   TicksPerMicro = 0; //!< Timer frequency  (Zero until calibrated)
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  private:
+    Profiler() : Origin(now()), Created(std::chrono::steady_clock::now())
+    {}
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    static Profiler& instance()
+    {
+      static Profiler p;
+      return p;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::now
+    //! Read the timer
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64_t now()
+    {
+#if defined(HW1_PROFILE_TSC)
+      return __rdtsc();
+#else
+      return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::ring
+    //! Get the event ring of the calling thread  (Created upon first use)
+    ///////////////////////////////////////////////////////////////////////////////
+    static EventRing& ring()
+    {
+      static thread_local EventRing* own = instance().attach();
+      return *own;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::collect
+    //! Drain the events of every thread into the histograms and trace
+    ///////////////////////////////////////////////////////////////////////////////
+    void collect()
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      for (auto& r : Rings)
+      {
+        Dropped += r->Dropped.exchange(0);
+        r->drain([&](const Event& e) {
+          Summary& s = Summaries[e.Name];
+          s.Durations.record(e.End - e.Start);
+          s.Primitives += e.Primitives;
+          if (Trace.size() < MaxTraceEvents)
+            Trace.push_back(TraceEvent{e, r->Thread});
+          else
+            ++Dropped;
+        });
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::reset
+    //! Discard all collected statistics and trace events
+    ///////////////////////////////////////////////////////////////////////////////
+    void reset()
+    {
+      collect();
+      std::lock_guard<std::mutex> lock(Lock);
+      Summaries.clear();
+      Trace.clear();
+      Dropped = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::report
+    //! Collect and then summarize every scope as a table  (Durations in microseconds)
+    //!
+    //! \param[in] frame - Name of the scope that encloses each frame  (Used for per-frame counts)
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string report(const char* frame = "paint")
+    {
+      collect();
+      std::lock_guard<std::mutex> lock(Lock);
+      const double ticksPerMicro = frequency();
+
+      auto f = Summaries.find(frame);
+      const uint64_t frames = f != Summaries.end() ? f->second.Durations.Count : 0;
+
+      char line[160];
+      std::snprintf(line, sizeof(line), "%-16s %8s %9s %9s %9s %11s\n", "scope", "calls", "p50(us)", "p99(us)", "max(us)", "prims/frame");
+      std::string out(line);
+      for (const auto& s : Summaries)
+      {
+        const Histogram& h = s.second.Durations;
+        std::snprintf(line, sizeof(line), "%-16s %8llu %9.2f %9.2f %9.2f %11.1f\n", s.first.c_str(), (unsigned long long)h.Count,
+                      h.percentile(0.50) / ticksPerMicro, h.percentile(0.99) / ticksPerMicro, h.Max / ticksPerMicro,
+                      frames ? double(s.second.Primitives) / frames : 0.0);
+        out += line;
+      }
+      std::snprintf(line, sizeof(line), "frames=%llu  dropped=%llu\n", (unsigned long long)frames, (unsigned long long)Dropped);
+      return out += line;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::writeTrace
+    //! Collect and then write every retained event as Chrome trace JSON  (chrome://tracing)
+    //!
+    //! \param[in] path - Output file
+    //! \return bool - True if written successfully
+    ///////////////////////////////////////////////////////////////////////////////
+    bool writeTrace(const char* path)
+    {
+      collect();
+      std::lock_guard<std::mutex> lock(Lock);
+      const double ticksPerMicro = frequency();
+
+      std::ofstream out(path);
+      out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+      char item[256];
+      for (size_t idx = 0; idx < Trace.size(); ++idx)
+      {
+        const TraceEvent& t = Trace[idx];
+        std::snprintf(item, sizeof(item), "%s\n{\"name\":\"%s\",\"cat\":\"paint\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"primitives\":%llu}}",
+                      idx ? "," : "", t.Data.Name, t.Thread, (t.Data.Start - Origin) / ticksPerMicro,
+                      (t.Data.End - t.Data.Start) / ticksPerMicro, (unsigned long long)t.Data.Primitives);
+        out << item;
+      }
+      out << "\n]}\n";
+      return bool(out);
+    }
+
+  private:
+    EventRing* attach()
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      Rings.emplace_back(new EventRing(uint32_t(Rings.size()+1)));
+      return Rings.back().get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Profiler::frequency
+    //! Get the timer frequency in ticks per microsecond  (Lock must be held)
+    //!
+    //! The timestamp counter is calibrated against the steady clock over the interval since
+    //! creation, upon the first report rather than within the first profiled scope (which
+    //! would otherwise wait for the calibration interval during the first paint)
+    ///////////////////////////////////////////////////////////////////////////////
+    double frequency()
+    {
+#if defined(HW1_PROFILE_TSC)
+      if (!TicksPerMicro)
+      {
+        using clock = std::chrono::steady_clock;
+        std::this_thread::sleep_until(Created + std::chrono::milliseconds(20));
+        const uint64_t ticks = now();
+        TicksPerMicro = double(ticks - Origin) / std::chrono::duration<double, std::micro>(clock::now() - Created).count();
+      }
+      return TicksPerMicro;
+#else
+      return 1000.0;
+#endif
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ScopedTimer - Records the duration of a scope and the primitives drawn within it
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ScopedTimer
+  {
+    const char*      Name;        //!< Scope name (String literal)
+    const uint64_t*  Counter;     //!< Primitive counter (if any)
+    uint64_t         Initial,     //!< Initial counter value
+                     Start;       //!< Start time
+
+    ScopedTimer(const char* name, const uint64_t* counter)
+      : Name(name), Counter(counter), Initial(counter ? *counter : 0), Start(Profiler::now())
+    {}
+
+    ~ScopedTimer()
+    {
+      const uint64_t end = Profiler::now();
+      Profiler::ring().push(Event{Name, Start, end, Counter ? *Counter - Initial : 0});
+    }
+  };
+
+} } // namespace hw1::profile
+
+#define HW1_PROFILE_CONCAT2(a,b)  a##b
+#define HW1_PROFILE_CONCAT(a,b)   HW1_PROFILE_CONCAT2(a,b)
+
+//! \def HW1_PROFILE_SCOPE - Time the enclosing scope  (Counter is a 'const uint64_t*' primitive count, or nullptr)
+#define HW1_PROFILE_SCOPE(name, counter)  ::hw1::profile::ScopedTimer HW1_PROFILE_CONCAT(profileScope, __LINE__)(name, counter)
+
+#else
+
+//! \def HW1_PROFILE_SCOPE - Compiled out
+#define HW1_PROFILE_SCOPE(name, counter)  ((void)0)
+
+#endif // HW1_PROFILE
+
+#endif
@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\ResourcePool.h
+//! \brief Defines the keyed cache of pens, brushes and fonts used when painting
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RESOURCE_POOL_H
+#define RESOURCE_POOL_H
+
+#include <cstdint>            //!< uint32_t
+#include <list>               //!< std::list
+#include <unordered_map>      //!< std::unordered_map
+#include "render/Types.h"     //!< hw1::render::faceHash
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ResourceKey - Identifies a pen, brush or font by its attributes
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ResourceKey
+  {
+    uint32_t  Style;      //!< Pen style, hatch style or font weight
+    int32_t   Width;      //!< Pen width or font height
+    uint32_t  Colour;     //!< Pen/brush colour or font face hash
+
+    bool operator== (const ResourceKey& r) const
+    {
+      return Style == r.Style && Width == r.Width && Colour == r.Colour;
+    }
+
+    //! \struct hash - Hashes a resource key
+    struct hash
+    {
+      size_t operator() (const ResourceKey& k) const
+      {
+        uint64_t h = (uint64_t(k.Style) << 40) ^ (uint64_t(uint32_t(k.Width)) << 24) ^ k.Colour;
+        return size_t(h * 0x9E3779B97F4A7C15ull >> 16);
+      }
+    };
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct PoolStats - Resource pool counters
+  ///////////////////////////////////////////////////////////////////////////////
+  struct PoolStats
+  {
+    uint64_t  Hits = 0,         //!< Requests satisfied from the pool
+              Misses = 0,       //!< Requests that required a new object
+              Creations = 0,    //!< Objects created
+              Evictions = 0;    //!< Objects released to make room
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct LruCache - Bounded cache that evicts the least recently used value
+  //!
+  //! \tparam VALUE - Cached value type
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename VALUE>
+  struct LruCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias entry_t - Key/value pair
+    using entry_t = std::pair<ResourceKey,VALUE>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    size_t                                                      Capacity;   //!< Maximum number of values
+    std::list<entry_t>                                          Entries;    //!< Values ordered from most to least recently used
+    std::unordered_map<ResourceKey, typename std::list<entry_t>::iterator, ResourceKey::hash>  Lookup;     //!< Values by key
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit LruCache(size_t capacity) : Capacity(capacity)
+    {
+      Lookup.reserve(capacity);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t size() const { return Entries.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // LruCache::get
+    //! Get a value, creating it upon a miss
+    //!
+    //! \param[in] key - Key
+    //! \param[in,out] stats - Pool counters
+    //! \param[in] create - Callable that creates the value
+    //! \return const VALUE& - Value (Valid until the next call)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FACTORY>
+    const VALUE& get(const ResourceKey& key, PoolStats& stats, FACTORY&& create)
+    {
+      // [HIT] Move to front
+      auto pos = Lookup.find(key);
+      if (pos != Lookup.end())
+      {
+        ++stats.Hits;
+        Entries.splice(Entries.begin(), Entries, pos->second);
+        return pos->second->second;
+      }
+
+      // [MISS] Evict least recently used
+      ++stats.Misses;
+      if (Entries.size() >= Capacity && !Entries.empty())
+      {
+        ++stats.Evictions;
+        Lookup.erase(Entries.back().first);
+        Entries.pop_back();
+      }
+
+      ++stats.Creations;
+      Entries.emplace_front(key, create());
+      Lookup[key] = Entries.begin();
+      return Entries.front().second;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // LruCache::clear
+    //! Release all values
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      Lookup.clear();
+      Entries.clear();
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ResourcePool - Shares pens, brushes and fonts between paints
+  //!
+  //! Objects are keyed by their attributes and retained until evicted, so repeated paints
+  //! select existing objects rather than creating new ones. Callers receive copies of the
+  //! pooled handles, which remain valid after eviction.
+  //!
+  //! \tparam GFX - Drawing vocabulary (Either hw1::WtlGraphics or hw1::render::Graphics)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename GFX>
+  struct ResourcePool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    using DeviceContext = typename GFX::DeviceContext;
+    using Colour        = typename GFX::Colour;
+    using HatchStyle    = typename GFX::HatchStyle;
+    using PenStyle      = typename GFX::PenStyle;
+    using FontWeight    = typename GFX::FontWeight;
+    using HPen          = typename GFX::HPen;
+    using HBrush        = typename GFX::HBrush;
+    using HFont         = typename GFX::HFont;
+
+    //! \var DefaultCapacity - Default maximum number of pooled objects of each kind
+    static constexpr size_t DefaultCapacity = 128;
+
+    //! \var SolidStyle - Style of the key of a solid brush  (Distinct from every hatch style)
+    static constexpr uint32_t SolidStyle = ~0u;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    LruCache<HPen>    Pens;       //!< Pens by (style, width, colour)
+    LruCache<HBrush>  Brushes;    //!< Solid and hatched brushes by (hatch, colour)
+    LruCache<HFont>   Fonts;      //!< Fonts by (weight, height, face)
+    PoolStats         Stats;      //!< Counters
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit ResourcePool(size_t capacity = DefaultCapacity) : Pens(capacity), Brushes(capacity), Fonts(capacity)
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    const PoolStats& stats() const { return Stats; }
+
+    size_t size() const { return Pens.size() + Brushes.size() + Fonts.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResourcePool::pen
+    //! Get a pen
+    //!
+    //! \param[in] style - Pen style
+    //! \param[in] width - Pen width
+    //! \param[in] col - Pen colour
+    ///////////////////////////////////////////////////////////////////////////////
+    HPen pen(PenStyle style, int32_t width, Colour col)
+    {
+      return Pens.get(ResourceKey{uint32_t(style), width, uint32_t(col)}, Stats, [=] { return HPen(style, width, col); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResourcePool::brush
+    //! Get a hatched brush
+    //!
+    //! \param[in] hatch - Hatch style
+    //! \param[in] col - Hatch colour
+    ///////////////////////////////////////////////////////////////////////////////
+    HBrush brush(HatchStyle hatch, Colour col)
+    {
+      return Brushes.get(ResourceKey{uint32_t(hatch), 0, uint32_t(col)}, Stats, [=] { return HBrush(hatch, col); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResourcePool::brush
+    //! Get a solid brush
+    //!
+    //! \param[in] col - Colour
+    ///////////////////////////////////////////////////////////////////////////////
+    HBrush brush(Colour col)
+    {
+      return Brushes.get(ResourceKey{SolidStyle, 0, uint32_t(col)}, Stats, [=] { return HBrush(col); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResourcePool::font
+    //! Get a font
+    //!
+    //! \param[in] face - Face name
+    //! \param[in] height - Height in pixels
+    //! \param[in] weight - Weight
+    ///////////////////////////////////////////////////////////////////////////////
+    template <unsigned LEN>
+    HFont font(const char (&face)[LEN], int32_t height, FontWeight weight)
+    {
+      return Fonts.get(ResourceKey{uint32_t(weight), height, render::faceHash(face)}, Stats, [&] {
+        return GFX::screenDC().getFont(GFX::c_str(face), height, weight);
+      });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResourcePool::clear
+    //! Release all pooled objects
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      Pens.clear();
+      Brushes.clear();
+      Fonts.clear();
+    }
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,1240 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Scene.h
+//! \brief Defines the scene drawn within the main window
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright � Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SCENE_H
+#define SCENE_H
+
+#include <algorithm>                //!< std::remove_if
+#include <cstdint>                  //!< int32_t
+#include <mutex>                    //!< std::call_once
+#include <vector>                   //!< std::vector
+#include "render/HitTest.h"         //!< hw1::render::insideEllipse
+#include "render/PointGrid.h"       //!< hw1::render::PointGrid
+#include "render/SpatialGrid.h"     //!< hw1::render::SpatialGrid
+#include "render/StateBatch.h"      //!< hw1::render::StateBatch
+#include "render/Span.h"            //!< hw1::render::span
+#include "render/Transform.h"       //!< hw1::render::Transform
+#include "render/Xoshiro.h"         //!< hw1::render::Xoshiro128
+#include "Literal.h"                //!< hw1::literal
+#include "Profiler.h"               //!< HW1_PROFILE_SCOPE
+#include "ResourcePool.h"           //!< hw1::ResourcePool
+#include "SceneFile.h"              //!< hw1::SceneFile
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Scene - Draws the 'Hello World' scene
+  //!
+  //! \tparam GFX - Drawing vocabulary (Either hw1::WtlGraphics or hw1::render::Graphics)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename GFX>
+  struct Scene
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias type - Define own type
+    using type = Scene<GFX>;
+
+    using DeviceContext = typename GFX::DeviceContext;
+    using POINT         = typename GFX::POINT;
+    using PointL        = typename GFX::PointL;
+    using SizeL         = typename GFX::SizeL;
+    using RectL         = typename GFX::RectL;
+    using TriangleL     = typename GFX::TriangleL;
+    using Colour        = typename GFX::Colour;
+    using StockBrush    = typename GFX::StockBrush;
+    using HatchStyle    = typename GFX::HatchStyle;
+    using PenStyle      = typename GFX::PenStyle;
+    using DrawingMode   = typename GFX::DrawingMode;
+    using DrawTextFlags = typename GFX::DrawTextFlags;
+    using FontWeight    = typename GFX::FontWeight;
+    using HPen          = typename GFX::HPen;
+    using HBrush        = typename GFX::HBrush;
+    using HFont         = typename GFX::HFont;
+
+    //! \enum Item - Define drawable scene objects
+    enum class Item : uint8_t
+    {
+      River,      //!< River polygon
+      Sign,       //!< 'Hello World' sign
+      Tree,       //!< Tree
+      Bunny,      //!< Easter bunny
+      Eggs,       //!< Row of easter eggs
+    };
+
+    //! \enum Layer - Define groups of scene objects that may be painted separately
+    enum class Layer : uint8_t
+    {
+      Static = 1,   //!< Background, river, sign and trees  (Identical on every paint)
+      Dynamic = 2,  //!< Bunny and eggs  (Drawn over the static layer)
+      All = 3,      //!< Every object
+    };
+
+    //! \struct Placement - Scene object and its position
+    struct Placement
+    {
+      Item            Kind;       //!< Object type
+      render::PointL  Position;   //!< Target point
+    };
+
+    //! \struct Hit - Scene object under a point
+    struct Hit
+    {
+      //! \var None - Index when no object lies under the point
+      static constexpr uint32_t None = ~0u;
+
+      Item      Kind = Item::River;   //!< Object type
+      uint32_t  Index = None;         //!< Index within the layout, or among the scene file objects of its kind
+
+      explicit operator bool() const  { return Index != None; }
+    };
+
+    //! \struct PaintStats - Counts of scene objects drawn and culled by the most recent paint
+    struct PaintStats
+    {
+      uint32_t  Drawn = 0,        //!< Objects intersecting the invalidated rectangle drawn in full detail
+                Simplified = 0,   //!< Objects intersecting the invalidated rectangle drawn at a lower level of detail
+                Culled = 0;       //!< Objects skipped entirely
+    };
+
+    //! \struct LevelOfDetail - Projected widths (in pixels) below which objects of a scene file are simplified
+    struct LevelOfDetail
+    {
+      float     Rect = 8.0f,      //!< Trees narrower than this are drawn as a rectangle of foliage
+                Point = 2.0f;     //!< Trees and eggs narrower than this are drawn as a single pixel
+    };
+
+    //! \struct EggAttributes - Palette indices of an easter egg  (Into EggStyles and EggColours)
+    struct EggAttributes
+    {
+      uint8_t     Hatch,        //!< Hatch style
+                  Fill,         //!< Hatch colour
+                  Outline,      //!< Outline colour
+                  Back;         //!< Background colour
+    };
+
+    //! \struct EggInstance - Position and palette indices of an easter egg
+    struct EggInstance
+    {
+      PointL         Position;  //!< Top-left of egg
+      EggAttributes  Style;     //!< Hatch style and colours
+    };
+
+    //! \struct River - River outline (Flows across the screen in an upward arc)
+    struct River
+    {
+      static constexpr POINT Points[] = { {0, 300},   {200, 280}, {400, 260}, {640, 250},
+                                          {640, 300}, {480, 310}, {280, 360}, {120, 420},  {0, 430} };
+    };
+
+    //! \var DefaultSeed - Seed of the attributes of the built-in layout, unless another is given
+    static constexpr uint64_t DefaultSeed = 42;
+
+    //! \var MaxEggs - Largest number of easter eggs in the row of the built-in layout
+    static constexpr int32_t MaxEggs = 8;
+
+    //! \var OutlinePadding - Padding added to bounding rectangles to contain pen outlines
+    static constexpr int32_t OutlinePadding = 2;
+
+    //! \var BatchLimit - Maximum trees or eggs of a scene file drawn per batch  (Bounds the cost of state-sorting)
+    static constexpr size_t BatchLimit = 4096;
+
+    //! \var IndexThreshold - Minimum number of objects of one kind in a scene file that are spatially indexed
+    static constexpr uint32_t IndexThreshold = 1024;
+
+    //! \var IndexCellSize - Preferred cell size of the spatial index of scene file objects
+    static constexpr int32_t IndexCellSize = 64;
+
+    //! \var EggStyles - Hatch styles of easter eggs
+    static constexpr HatchStyle EggStyles[] = { HatchStyle::Horizontal, HatchStyle::Vertical,
+                                                HatchStyle::ForwardDiagonal, HatchStyle::BackwardDiagonal,
+                                                HatchStyle::Cross, HatchStyle::CrossDiagonal };
+    //! \var EggColours - Colours of easter eggs
+    static constexpr Colour EggColours[] = { Colour::Beige, Colour::Honey, Colour::Gold, Colour::Green, Colour::Magenta, Colour::Rose,
+                                             Colour::Yellow, Colour::SkyBlue, Colour::Orange, Colour::Leaves, Colour::Teal };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    int32_t                                    NumEggs;      //!< Number of easter eggs
+    EggAttributes                              EggStyle[MaxEggs];   //!< Attributes of each easter egg  (Generated once; paints only read them)
+    std::vector<Placement>                     Layout;       //!< Scene objects in drawing order
+    render::SpatialGrid                        Index;        //!< Bounding rectangles of layout objects  (Empty for scene files)
+    std::vector<render::SpatialGrid::index_t>  Visible;      //!< Objects intersecting the current paint
+    PaintStats                                 Stats;        //!< Counts from most recent paint
+    ResourcePool<GFX>                          Resources;    //!< Pens, brushes and fonts shared between paints
+    render::StateBatch                         Batch;        //!< Primitives of current batch ordered by render state
+    std::vector<PointL>                        Trees;        //!< Positions of consecutive trees being painted
+    std::vector<EggInstance>                   Eggs;         //!< Eggs being painted
+    std::vector<HBrush>                        Palette;      //!< Solid brush of each egg colour  (Created upon first use by proxy eggs)
+    const SceneFile*                           Source = nullptr;   //!< Scene file replacing the layout  (If any)
+    render::PointGrid                          Grids[SceneFile::NumKinds];   //!< Positions of scene file objects  (Built upon first use, by painting or hit testing)
+    std::once_flag                             GridsBuilt[SceneFile::NumKinds];   //!< Whether each grid has been built
+    std::vector<render::PointGrid::index_t>    Candidates;   //!< Scene file objects intersecting the current paint
+    std::vector<render::SpatialGrid::index_t>  HitVisible;   //!< Objects beneath the current hit test  (Accessed only by hitTest)
+    std::vector<render::PointGrid::index_t>    HitCandidates;   //!< Scene file objects beneath the current hit test  (Accessed only by hitTest)
+    std::vector<uint32_t>                      Simplified;   //!< Scene file objects of the current batch drawn as proxies
+    render::RectBuffer                         Proxies;      //!< Device bounds of the current batch of proxies
+    render::PointBuffer                        Origins;      //!< Positions of the current batch of scene file trees or eggs
+    render::Transform                          View;         //!< Maps scene coordinates to device coordinates
+    LevelOfDetail                              Detail;       //!< Level-of-detail thresholds
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::Scene
+    //! Create the scene layout and index the bounds of each object
+    //!
+    //! \param[in] seed - [optional] Seed of the number of eggs and their colours  (Equal seeds produce identical frames)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit Scene(uint64_t seed = DefaultSeed) : Index(render::RectL(0,0,640,480), 64)
+    {
+      // Generate every attribute up front
+      using render::Xoshiro128;
+      uint32_t words[1 + 4*MaxEggs];
+      Xoshiro128(seed).generate(words, 1 + 4*MaxEggs);
+      const uint32_t colours = sizeof(EggColours) / sizeof(EggColours[0]),
+                     styles = sizeof(EggStyles) / sizeof(EggStyles[0]);
+      NumEggs = 4 + int32_t(Xoshiro128::bounded(words[0], MaxEggs-3));
+      for (int32_t idx = 0; idx < MaxEggs; ++idx)
+      {
+        const uint32_t* w = words + 1 + 4*idx;
+        EggStyle[idx] = EggAttributes{ uint8_t(Xoshiro128::bounded(w[0], styles)),  uint8_t(Xoshiro128::bounded(w[1], colours)),
+                                       uint8_t(Xoshiro128::bounded(w[2], colours)), uint8_t(Xoshiro128::bounded(w[3], colours)) };
+      }
+
+      // River, sign, trees, then bunny and eggs in front
+      place(Item::River, render::PointL());
+      place(Item::Sign,  render::PointL(80,80));
+      place(Item::Tree,  render::PointL(450,125));
+      place(Item::Tree,  render::PointL(350,130));
+      place(Item::Tree,  render::PointL(425,155));
+      place(Item::Tree,  render::PointL(360,180));
+      place(Item::Tree,  render::PointL(410,210));
+      place(Item::Bunny, render::PointL(320,340));
+      place(Item::Eggs,  render::PointL(400,380));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::Scene
+    //! Create a scene whose objects are read in place from a scene file
+    //!
+    //! \param[in] file - Scene file  (Must remain open while the scene is painted)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit Scene(const SceneFile& file) : NumEggs(0), EggStyle(), Source(&file)
+    {
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::stats const
+    //! Get the number of objects drawn and culled by the most recent paint
+    ///////////////////////////////////////////////////////////////////////////////
+    const PaintStats& stats() const
+    {
+      return Stats;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::resources const
+    //! Get the pool of pens, brushes and fonts
+    ///////////////////////////////////////////////////////////////////////////////
+    const ResourcePool<GFX>& resources() const
+    {
+      return Resources;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::view const
+    //! Get the transform from scene coordinates to device coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    const render::Transform& view() const
+    {
+      return View;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::detail const
+    //! Get the projected widths (in pixels) below which objects of a scene file are simplified
+    ///////////////////////////////////////////////////////////////////////////////
+    const LevelOfDetail& detail() const
+    {
+      return Detail;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::bounds const
+    //! Calculate the bounding rectangle of a scene object, including its outline
+    //!
+    //! \param[in] obj - Scene object
+    //! \return render::RectL - Bounding rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    render::RectL bounds(const Placement& obj) const
+    {
+      const render::PointL pt = obj.Position;
+      render::RectL rc;
+      switch (obj.Kind)
+      {
+      case Item::River:
+        rc = render::RectL(River::Points[0].x, River::Points[0].y, River::Points[0].x, River::Points[0].y);
+        for (const POINT& v : River::Points)
+          rc = render::RectL(std::min<int32_t>(rc.left, v.x), std::min<int32_t>(rc.top, v.y),
+                             std::max<int32_t>(rc.right, v.x), std::max<int32_t>(rc.bottom, v.y));
+        break;
+      case Item::Sign:  rc = render::RectL(pt.x, pt.y, pt.x+200, pt.y+170);        break;    // Board + legs
+      case Item::Tree:  rc = render::RectL(pt.x, pt.y-50, pt.x+50, pt.y+32);       break;    // Leaves + trunk
+      case Item::Bunny: rc = render::RectL(pt.x, pt.y-60, pt.x+60, pt.y+80);       break;    // Ears to feet
+      case Item::Eggs:  rc = render::RectL(pt.x, pt.y, pt.x+NumEggs*30-10, pt.y+30); break;
+      }
+      return padded(rc);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::layerBounds const
+    //! Calculate the bounding rectangle of the objects in a layer
+    //!
+    //! \param[in] layers - Layer(s)
+    //! \return render::RectL - Union of object bounds  (Empty if the layer has no objects)
+    ///////////////////////////////////////////////////////////////////////////////
+    render::RectL layerBounds(Layer layers) const
+    {
+      render::RectL rc;
+      if (Source)
+      {
+        for (uint32_t k = 0; k < SceneFile::NumKinds; ++k)
+          if (uint8_t(layers) & uint8_t(layer(SceneFile::Kind(k))))
+            visible(SceneFile::Kind(k), render::RectL(INT32_MIN/2, INT32_MIN/2, INT32_MAX/2, INT32_MAX/2),
+                    [&](uint32_t, const render::RectL& r) { rc = rc.unite(r); });
+        return rc;
+      }
+
+      for (const Placement& obj : Layout)
+        if (includes(layers, obj.Kind))
+          rc = rc.unite(bounds(obj));
+      return rc;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::contains
+    //! Query whether a point lies within the shapes drawn for an object  (Excluding outlines)
+    //!
+    //! \param[in] kind - Object type  (Rivers of the built-in layout only)
+    //! \param[in] pos - Object position
+    //! \param[in] pt - Point  (Scene coordinates)
+    //! \param[in] eggs - [optional] Number of eggs in a row of eggs
+    ///////////////////////////////////////////////////////////////////////////////
+    static bool  contains(Item kind, render::PointL pos, render::PointL pt, int32_t eggs = 1)
+    {
+      using render::RectL;
+      using render::SizeL;
+      using render::insideEllipse;
+      switch (kind)
+      {
+      case Item::River:
+        return render::insidePolygon(River::Points, int32_t(sizeof(River::Points) / sizeof(River::Points[0])), pt);
+
+      case Item::Sign:      // Board + legs
+        return RectL(pos, SizeL(200,140)).contains(pt)
+            || RectL(pos + render::PointL(30,140), SizeL(40,30)).contains(pt)
+            || RectL(pos + render::PointL(130,140), SizeL(40,30)).contains(pt);
+
+      case Item::Tree:      // Leaves + trunk
+        return render::insideTriangle(render::TriangleL(pos, 50, 50), pt)
+            || RectL(pos + render::PointL(10,2), SizeL(30,30)).contains(pt);
+
+      case Item::Bunny:     // Body, head, ears and feet  (Eyes lie within the head)
+        return insideEllipse(RectL(pos, SizeL(60,80)), pt)
+            || insideEllipse(RectL(pos + render::PointL(10,0), SizeL(40,-40)), pt)
+            || insideEllipse(RectL(pos + render::PointL(0,-60), SizeL(20,30)), pt)
+            || insideEllipse(RectL(pos + render::PointL(40,-60), SizeL(20,30)), pt)
+            || insideEllipse(RectL(pos + render::PointL(0,40), SizeL(20,40)), pt)
+            || insideEllipse(RectL(pos + render::PointL(40,40), SizeL(20,40)), pt);
+
+      case Item::Eggs:
+        for (int32_t idx = 0; idx < eggs; ++idx)
+          if (insideEllipse(RectL(pos + render::PointL(idx*30,0), SizeL(20,30)), pt))
+            return true;
+        return false;
+      }
+      return false;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::setView
+    //! Pan and zoom the scene  (Only the software renderer supports views other than the identity)
+    //!
+    //! \param[in] view - Maps scene coordinates to device coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    void  setView(const render::Transform& view)
+    {
+      View = view;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::setDetail
+    //! Change the projected sizes at which objects of a scene file are simplified
+    //!
+    //! \param[in] lod - Level-of-detail thresholds  (Zero draws every object in full detail)
+    ///////////////////////////////////////////////////////////////////////////////
+    void  setDetail(const LevelOfDetail& lod)
+    {
+      Detail = lod;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::paint
+    //! Paints the portion of the scene within a rectangle
+    //!
+    //! Only objects whose bounds intersect the invalidated rectangle are drawn; the device
+    //! context is expected to clip output to the same rectangle. Every static object precedes
+    //! every dynamic object in painter's order, so painting the static layer and then the
+    //! dynamic layer produces the same pixels as painting both at once.
+    //!
+    //! Objects are drawn through the current view, whose transform is removed afterwards.
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] rc - Invalidated rectangle  (Device coordinates)
+    //! \param[in] erase - Whether to erase before drawing
+    //! \param[in] layers - [optional] Layer(s) to paint  (The background belongs to the static layer)
+    ///////////////////////////////////////////////////////////////////////////////
+    void  paint(DeviceContext& dc, const RectL& rc, bool erase, Layer layers = Layer::All)
+    {
+      HW1_PROFILE_SCOPE("paint", GFX::primitives(dc));
+
+      // Draw background
+      if (uint8_t(layers) & uint8_t(Layer::Static))
+        dc.fill(rc, StockBrush::Green);
+
+      // Map invalidated rectangle into the scene
+      const render::RectL area = View.inverse(render::RectL(rc.left, rc.top, rc.right, rc.bottom));
+      GFX::transform(dc, View);
+
+      // Draw objects of scene file, or the built-in layout
+      if (Source)
+        paintSource(dc, area, erase, layers);
+      else
+        paintLayout(dc, area, erase, layers);
+
+      GFX::transform(dc, render::Transform());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::hitTest
+    //! Find the topmost object drawn at a pixel
+    //!
+    //! Candidates are found using the same spatial indices that cull painting, then tested
+    //! exactly against the ellipses, triangles, rectangles and polygons drawn for them.
+    //! Objects are tested in reverse painter's order, so the first hit is the visible one.
+    //!
+    //! May be called from one thread (eg. the UI thread) while another paints the scene (eg. the
+    //! render thread): hit tests use their own scratch buffers and build shared indices at most
+    //! once. The view must not be changed meanwhile.
+    //!
+    //! \param[in] pt - Pixel  (Device coordinates, through the current view)
+    //! \return Hit - Object drawn at the pixel  (If any)
+    ///////////////////////////////////////////////////////////////////////////////
+    Hit  hitTest(render::PointL pt)
+    {
+      // Sample the scene beneath the centre of the pixel
+      const render::RectL pixel = View.inverse(render::RectL(pt.x, pt.y, pt.x+1, pt.y+1));
+      const render::PointL at(int32_t((int64_t(pixel.left) + pixel.right) / 2), int32_t((int64_t(pixel.top) + pixel.bottom) / 2));
+      const render::RectL probe(at.x, at.y, at.x+1, at.y+1);
+      Hit hit;
+
+      // [FILE] Later kinds are drawn above earlier kinds, and later objects above earlier objects
+      if (Source)
+      {
+        const SceneFile& file = *Source;
+        for (uint32_t k = SceneFile::NumKinds; k-- > 0 && !hit; )
+        {
+          const SceneFile::Kind kind = SceneFile::Kind(k);
+          if (kind == SceneFile::Polygons)
+          {
+            const uint32_t* first = file.column<uint32_t>(SceneFile::PolygonFirst);
+            const render::POINT* verts = reinterpret_cast<const render::POINT*>(file.column<int32_t>(SceneFile::Vertices));
+            visible(kind, probe, [&](uint32_t idx, const render::RectL&) {
+              if (render::insidePolygon(verts + first[idx], int32_t(first[idx+1] - first[idx]), at))
+                hit = Hit{Item::River, idx};
+            });
+            continue;
+          }
+
+          // Index every kind  (A point query costs far less than scanning even a few objects)
+          const SceneFile::Positions pos = positions(kind);
+          query(kind, probe, [&](uint32_t idx, const render::RectL&) {
+            if (contains(item(kind), render::PointL(pos.X[idx], pos.Y[idx]), at))
+              hit = Hit{item(kind), idx};
+          }, 1, &HitCandidates);
+        }
+        return hit;
+      }
+
+      // [LAYOUT] Objects are indexed in painter's order
+      Index.query(at, HitVisible);
+      for (auto idx = HitVisible.rbegin(); idx != HitVisible.rend(); ++idx)
+        if (contains(Layout[*idx].Kind, Layout[*idx].Position, at, NumEggs))
+          return Hit{Layout[*idx].Kind, *idx};
+      return hit;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::draw
+    //! Draws a single scene object
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] obj - Scene object
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  draw(DeviceContext& dc, const Placement& obj, bool erase)
+    {
+      const PointL pt(obj.Position.x, obj.Position.y);
+      switch (obj.Kind)
+      {
+      case Item::River: drawRiver(dc, pt, erase);                 break;
+      case Item::Sign:  drawSign(dc, pt, erase);                  break;
+      case Item::Tree:  drawTree(dc, pt, erase);                  break;
+      case Item::Bunny: drawEasterBunny(dc, pt, erase);           break;
+      case Item::Eggs:  drawEasterEggs(dc, pt, NumEggs, erase);   break;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawEasterBunny
+    //! Draws the easter Bunny at a point
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pt - Target
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawEasterBunny(DeviceContext& dc, PointL pt, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawEasterBunny", GFX::primitives(dc));
+
+      // Set body colour
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Brown);
+      dc += StockBrush::Wheat;
+
+      // [BODY] Medium elogated ellipse
+      GFX::template ellipse<60,80>(dc, pt);
+
+      // [HEAD] Small circle above
+      GFX::template ellipse<40,-40>(dc, pt+PointL(10,0));
+
+      // [EARS] 2x Small circles above
+      dc += StockBrush::Snow;
+      GFX::template ellipse<20,30>(dc, pt+PointL(0,-60));
+      GFX::template ellipse<20,30>(dc, pt+PointL(40,-60));
+
+      // [FEET] 2x Small circles below
+      GFX::template ellipse<20,40>(dc, pt+PointL(0,40));
+      GFX::template ellipse<20,40>(dc, pt+PointL(40,40));
+
+      // [EYES] 2x Small circles
+      //dc += StockBrush::Red;
+      GFX::template ellipse<10,10>(dc, pt+PointL(30,-30));
+      GFX::template ellipse<10,10>(dc, pt+PointL(15,-30));
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawEasterEggs
+    //! Draws easter eggs at a point
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pt - Target
+    //! \param[in] numEggs - Number of eggs to draw  (Attributes repeat beyond MaxEggs)
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawEasterEggs(DeviceContext& dc, PointL pt, const int32_t numEggs, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawEasterEggs", GFX::primitives(dc));
+
+      // [EGGS] Look up egg properties
+      Eggs.clear();
+      for (int32_t idx = 0; idx < numEggs; ++idx)
+      {
+        Eggs.push_back(EggInstance{pt+PointL(idx*30,0), EggStyle[idx % MaxEggs]});
+      }
+
+      // [EGGS] Draw small ovals
+      drawEggs(dc, Eggs, erase);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawEggs
+    //! Draws a batch of easter eggs, grouped by render state within each batch of render::StateBatch::Capacity eggs
+    //!
+    //! Render states order eggs by background, then outline, then brush, so consecutive states
+    //! usually share a background and outline; only the parts that change are selected.
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] eggs - Egg instances  (Palette indices must lie within EggStyles and EggColours)
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawEggs(DeviceContext& dc, render::span<const EggInstance> eggs, bool erase)
+    {
+      // Draw egg backgrounds
+      dc += DrawingMode::Opaque;
+
+      // Render state of an egg, ordered by background, outline, hatch colour then hatch style
+      auto state = [](const EggAttributes& a) {
+        return uint32_t(a.Hatch) | (uint32_t(a.Fill) << 8) | (uint32_t(a.Outline) << 16) | (uint32_t(a.Back) << 24);
+      };
+
+      // Draw consecutive batches of eggs  (The current state is retained between batches)
+      EggAttributes current{0xFF, 0xFF, 0xFF, 0xFF};
+      for (size_t first = 0; first < eggs.size(); first += render::StateBatch::Capacity)
+      {
+        const size_t last = std::min(eggs.size(), first + render::StateBatch::Capacity);
+
+        // Record each egg with its render state
+        Batch.clear();
+        for (size_t idx = first; idx != last; ++idx)
+        {
+          const EggInstance& egg = eggs[idx];
+          Batch.add(state(egg.Style), padded(render::RectL(egg.Position.x, egg.Position.y, egg.Position.x+20, egg.Position.y+30)));
+        }
+
+        // [EGGS] Draw small ovals grouped by colour
+        for (const render::StateBatch::Entry& e : Batch.order())
+        {
+          const EggInstance& egg = eggs[first + e.Index];
+          if (egg.Style.Back != current.Back)
+            dc.setBackColour(EggColours[egg.Style.Back]);
+          if (egg.Style.Outline != current.Outline)
+            dc += Resources.pen(PenStyle::Solid, 2, EggColours[egg.Style.Outline]);
+          if (egg.Style.Hatch != current.Hatch || egg.Style.Fill != current.Fill)
+            dc += Resources.brush(EggStyles[egg.Style.Hatch], EggColours[egg.Style.Fill]);
+          current = egg.Style;
+          GFX::template ellipse<20,30>(dc, egg.Position);
+        }
+      }
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawRiver
+    //! Draws a river across the screen in an upward arc
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pt - Ignored
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawRiver(DeviceContext& dc, PointL pt, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawRiver", GFX::primitives(dc));
+
+      // Light blue river & dark highlights
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Blue);
+      dc += StockBrush::Cyan;
+
+      // [RIVER] Fill polygon
+      GFX::template polygon<River>(dc);
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawPolygon
+    //! Draws a river polygon of a scene file
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawPolygon(DeviceContext& dc, const POINT* pts, int32_t count, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawPolygon", GFX::primitives(dc));
+
+      // Light blue river & dark highlights
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Blue);
+      dc += StockBrush::Cyan;
+
+      GFX::polygon(dc, pts, count);
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawTree
+    //! Draws a tree at a point
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pt - Target
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawTree(DeviceContext& dc, PointL pt, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawTree", GFX::primitives(dc));
+
+      // Set dark green outline + light green interior
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Forest);
+      dc += StockBrush::Leaves;
+
+      // [LEAVES] Small green triangle
+      GFX::template triangle<50,50>(dc, pt);
+
+      // Set brown interior + black outline
+      dc += Resources.brush(HatchStyle::ForwardDiagonal, Colour::Black);
+
+      // Set brown interior + black outline
+      dc.setBackColour(Colour::Brown);
+      dc += DrawingMode::Opaque;
+
+      // [TRUNK] Small brown square
+      dc.rect( RectL(pt + PointL(10,2), SizeL(30,30)) );
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawTrees
+    //! Draws a batch of trees in order, selecting their shared outline and trunk background once
+    //!
+    //! Trees are not reordered: every tree alternates between the same two brushes, so grouping
+    //! by state saves no more than selecting the shared state once, and costs more than it saves.
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] trees - Tree positions
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawTrees(DeviceContext& dc, render::span<const PointL> trees, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawTrees", GFX::primitives(dc));
+
+      // Set dark green outline  (Shared by leaves and trunk)
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Forest);
+
+      // Set brown background of black hatching  (Solid leaves are unaffected)
+      dc.setBackColour(Colour::Brown);
+      dc += DrawingMode::Opaque;
+
+      const HBrush trunk = Resources.brush(HatchStyle::ForwardDiagonal, Colour::Black);
+      for (const PointL& pt : trees)
+      {
+        // [LEAVES] Small green triangle
+        dc += StockBrush::Leaves;
+        GFX::template triangle<50,50>(dc, pt);
+
+        // [TRUNK] Small brown square
+        dc += trunk;
+        dc.rect( RectL(pt + PointL(10,2), SizeL(30,30)) );
+      }
+
+      // Cleanup
+      dc.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawSign
+    //! Draws the 'Hello World' sign at a point
+    //!
+    //! \param[in] dc - Device context
+    //! \param[in] pt - Top left point of sign
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawSign(DeviceContext& dc, PointL pt, bool erase)
+    {
+      HW1_PROFILE_SCOPE("drawSign", GFX::primitives(dc));
+
+      // Large text
+      dc += Resources.font("MS Shell Dlg 2", 16, FontWeight::Bold);
+
+      // [SIGN] Black outline + brown interior
+      dc += Resources.pen(PenStyle::Solid, 2, Colour::Black);
+      dc += StockBrush::Brown;
+
+      // [SIGN] Large rectangle
+      RectL signRect(pt, SizeL(200,140));
+      dc.rect(signRect);
+
+      // Set brown interior + black outline
+      dc += Resources.brush(HatchStyle::CrossDiagonal, Colour::Black);
+
+      // Set brown interior + black outline
+      dc.setBackColour(Colour::Brown);
+      dc += DrawingMode::Opaque;
+
+      // [LEGS] 2x small rectangles below sign
+      dc.rect( RectL(pt + PointL(30,140), SizeL(40,30)) );
+      dc.rect( RectL(pt + PointL(130,140), SizeL(40,30)) );
+
+      // Transparent white text
+      dc += DrawingMode::Transparent;
+      dc.setTextColour(Colour::White);
+
+      // [TEXT] Draw sign text
+      static constexpr auto text = literal<typename GFX::char_t>("\n Hello World 1"
+                                                                 "\n\n From Windows"
+                                                                 "\n\n Template Library");
+      dc.write(GFX::c_str(text.Text), signRect, DrawTextFlags::Centre);
+
+      // Cleanup
+      dc.clear();
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::paintLayout
+    //! Paints the objects of the built-in layout within a rectangle, in painter's order
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] rc - Invalidated rectangle  (Scene coordinates)
+    //! \param[in] erase - Whether to erase before drawing
+    //! \param[in] layers - Layer(s) to paint
+    ///////////////////////////////////////////////////////////////////////////////
+    void  paintLayout(DeviceContext& dc, const render::RectL& rc, bool erase, Layer layers)
+    {
+      // Query objects intersecting invalidated area within the requested layers
+      Index.query(rc, Visible);
+      if (layers != Layer::All)
+        Visible.erase(std::remove_if(Visible.begin(), Visible.end(), [&](render::SpatialGrid::index_t idx) {
+                        return !includes(layers, Layout[idx].Kind);
+                      }), Visible.end());
+      Stats.Drawn = uint32_t(Visible.size());
+      Stats.Simplified = 0;
+      Stats.Culled = uint32_t(Layout.size() - Visible.size());
+
+      // Draw in painter's order  (Consecutive trees are drawn as a batch)
+      for (size_t pos = 0; pos < Visible.size(); )
+      {
+        const Placement& obj = Layout[Visible[pos]];
+        if (obj.Kind != Item::Tree)
+        {
+          draw(dc, obj, erase);
+          ++pos;
+          continue;
+        }
+
+        Trees.clear();
+        for (; pos < Visible.size() && Layout[Visible[pos]].Kind == Item::Tree; ++pos)
+          Trees.emplace_back(Layout[Visible[pos]].Position.x, Layout[Visible[pos]].Position.y);
+        drawTrees(dc, Trees, erase);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::paintSource
+    //! Paints the objects of the scene file within a rectangle, in painter's order
+    //!
+    //! Trees and eggs are drawn in batches of at most BatchLimit. Trees and eggs whose projected
+    //! size falls below the level-of-detail thresholds are drawn as filled rectangles or pixels.
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] rc - Invalidated rectangle  (Scene coordinates)
+    //! \param[in] erase - Whether to erase before drawing
+    //! \param[in] layers - Layer(s) to paint
+    ///////////////////////////////////////////////////////////////////////////////
+    void  paintSource(DeviceContext& dc, const render::RectL& rc, bool erase, Layer layers)
+    {
+      const SceneFile& file = *Source;
+      uint32_t total = 0;
+      Stats.Drawn = Stats.Simplified = 0;
+
+      for (uint32_t k = 0; k < SceneFile::NumKinds; ++k)
+      {
+        const SceneFile::Kind kind = SceneFile::Kind(k);
+        if (!(uint8_t(layers) & uint8_t(layer(kind))))
+          continue;
+        total += file.count(kind);
+
+        switch (kind)
+        {
+        case SceneFile::Polygons:
+        {
+          const uint32_t* first = file.column<uint32_t>(SceneFile::PolygonFirst);
+          const POINT* verts = reinterpret_cast<const POINT*>(file.column<int32_t>(SceneFile::Vertices));
+          Stats.Drawn += visible(kind, rc, [&](uint32_t idx, const render::RectL&) {
+            drawPolygon(dc, verts + first[idx], int32_t(first[idx+1] - first[idx]), erase);
+          });
+          break;
+        }
+        case SceneFile::Signs:
+        {
+          const SceneFile::Positions pos = file.signs();
+          Stats.Drawn += query(kind, rc, [&](uint32_t idx, const render::RectL&) { drawSign(dc, PointL(pos.X[idx], pos.Y[idx]), erase); });
+          break;
+        }
+        case SceneFile::Bunnies:
+        {
+          const SceneFile::Positions pos = file.bunnies();
+          Stats.Drawn += query(kind, rc, [&](uint32_t idx, const render::RectL&) { drawEasterBunny(dc, PointL(pos.X[idx], pos.Y[idx]), erase); });
+          break;
+        }
+        case SceneFile::Trees:
+        {
+          const SceneFile::Positions pos = file.trees();
+          const render::RectL size = extent(kind);
+
+          // [LOD] Distant trees become a rectangle of foliage, or a single pixel
+          const float width = View.length(size.width());
+          if (width < Detail.Rect)
+          {
+            auto leaves = [](uint32_t) { return StockBrush::Leaves; };
+            Simplified.clear();
+            Stats.Simplified += query(kind, rc, [&](uint32_t idx, const render::RectL&) {
+              Simplified.push_back(idx);
+              if (Simplified.size() == BatchLimit)
+                drawProxies(dc, kind, width < Detail.Point, leaves), Simplified.clear();
+            });
+            drawProxies(dc, kind, width < Detail.Point, leaves);
+            break;
+          }
+
+          Origins.clear();
+          Stats.Drawn += query(kind, rc, [&](uint32_t idx, const render::RectL&) {
+            Origins.push_back(pos.X[idx], pos.Y[idx]);
+            if (Origins.size() == BatchLimit)
+              drawOrigins(dc, kind, erase);
+          });
+          drawOrigins(dc, kind, erase);
+          break;
+        }
+        case SceneFile::Eggs:
+        {
+          const SceneFile::Positions pos = file.eggs();
+          const uint8_t* hatch = file.column<uint8_t>(SceneFile::EggHatch);
+          const uint8_t* fill = file.column<uint8_t>(SceneFile::EggFill);
+          const uint8_t* outline = file.column<uint8_t>(SceneFile::EggOutline);
+          const uint8_t* back = file.column<uint8_t>(SceneFile::EggBack);
+
+          // Palette indices are reduced into range rather than trusted
+          const size_t colours = sizeof(EggColours) / sizeof(EggColours[0]),
+                       styles = sizeof(EggStyles) / sizeof(EggStyles[0]);
+
+          // [LOD] Tiny eggs become a single pixel of their hatch colour
+          if (View.length(extent(kind).width()) < Detail.Point)
+          {
+            if (Palette.empty())
+              for (Colour c : EggColours)
+                Palette.push_back(Resources.brush(c));
+
+            auto colour = [&](uint32_t idx) { return Palette[fill[idx] % colours]; };
+            Simplified.clear();
+            Stats.Simplified += query(kind, rc, [&](uint32_t idx, const render::RectL&) {
+              Simplified.push_back(idx);
+              if (Simplified.size() == BatchLimit)
+                drawProxies(dc, kind, true, colour), Simplified.clear();
+            });
+            drawProxies(dc, kind, true, colour);
+            break;
+          }
+
+          Eggs.clear();
+          Origins.clear();
+          Stats.Drawn += query(kind, rc, [&](uint32_t idx, const render::RectL&) {
+            Origins.push_back(pos.X[idx], pos.Y[idx]);
+            Eggs.push_back(EggInstance{PointL(), EggAttributes{uint8_t(hatch[idx] % styles), uint8_t(fill[idx] % colours),
+                                                               uint8_t(outline[idx] % colours), uint8_t(back[idx] % colours)}});
+            if (Origins.size() == BatchLimit)
+              drawOrigins(dc, kind, erase);
+          });
+          drawOrigins(dc, kind, erase);
+          break;
+        }
+        default:
+          break;
+        }
+      }
+      Stats.Culled = total - Stats.Drawn - Stats.Simplified;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawProxies
+    //! Draws the simplified scene file objects of the current batch as filled rectangles or pixels
+    //!
+    //! The bounds of the batch are gathered into contiguous arrays and mapped into device
+    //! coordinates in one pass, rather than one object at a time.
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] kind - Object type
+    //! \param[in] points - Whether to reduce each object to the pixel at its centre
+    //! \param[in] brush - Callable as brush(index) returning the brush of an object
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename BRUSH>
+    void  drawProxies(DeviceContext& dc, SceneFile::Kind kind, bool points, BRUSH&& brush)
+    {
+      const SceneFile::Positions pos = positions(kind);
+      const render::RectL size = extent(kind);
+
+      // Gather bounds, then map into device coordinates
+      Proxies.clear();
+      for (uint32_t idx : Simplified)
+        Proxies.push_back(render::RectL(pos.X[idx]+size.left, pos.Y[idx]+size.top, pos.X[idx]+size.right, pos.Y[idx]+size.bottom));
+      Proxies.transform(View);
+
+      // Fill in device coordinates
+      GFX::transform(dc, render::Transform());
+      for (size_t n = 0; n < Proxies.size(); ++n)
+        dc.fill(proxy(Proxies[n], points), brush(Simplified[n]));
+      GFX::transform(dc, View);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::drawOrigins
+    //! Draws the scene file trees or eggs of the current batch in full detail, then empties the batch
+    //!
+    //! When the view only translates, the positions of the batch are mapped into device
+    //! coordinates in one pass and the shapes are drawn without a transform; otherwise each
+    //! shape is scaled through the view.
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] kind - Object type  (Trees or eggs; the attributes of eggs are in Eggs)
+    //! \param[in] erase - Whether to erase before drawing
+    ///////////////////////////////////////////////////////////////////////////////
+    void  drawOrigins(DeviceContext& dc, SceneFile::Kind kind, bool erase)
+    {
+      if (Origins.empty())
+        return;
+
+      // Map positions into device coordinates
+      const bool translated = !View.scaled();
+      if (translated)
+      {
+        Origins.transform(View);
+        GFX::transform(dc, render::Transform());
+      }
+
+      if (kind == SceneFile::Trees)
+      {
+        Trees.clear();
+        for (size_t n = 0; n < Origins.size(); ++n)
+          Trees.emplace_back(Origins.X[n], Origins.Y[n]);
+        drawTrees(dc, Trees, erase);
+      }
+      else
+      {
+        for (size_t n = 0; n < Origins.size(); ++n)
+          Eggs[n].Position = PointL(Origins.X[n], Origins.Y[n]);
+        drawEggs(dc, Eggs, erase);
+        Eggs.clear();
+      }
+
+      if (translated)
+        GFX::transform(dc, View);
+      Origins.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::proxy
+    //! Get the rectangle drawn in place of a simplified object
+    //!
+    //! \param[in] r - Object bounds  (Device coordinates)
+    //! \param[in] point - Whether to reduce the object to the pixel at its centre
+    //! \return RectL - Device rectangle of at least one pixel
+    ///////////////////////////////////////////////////////////////////////////////
+    static RectL  proxy(render::RectL r, bool point)
+    {
+      if (point)
+        r = render::RectL((r.left+r.right) / 2, (r.top+r.bottom) / 2, (r.left+r.right) / 2 + 1, (r.top+r.bottom) / 2 + 1);
+      return RectL(PointL(r.left, r.top), SizeL(std::max(1, r.width()), std::max(1, r.height())));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::query
+    //! Enumerate the objects of a scene file intersecting a rectangle using a spatial index
+    //!
+    //! Kinds with many objects are indexed by position upon first use; the rectangle is expanded
+    //! by their fixed size so the index need only find positions. Rectangles containing every
+    //! object of a kind are answered by a linear scan, which avoids sorting the results.
+    //!
+    //! \param[in] kind - Object type
+    //! \param[in] rc - Rectangle
+    //! \param[in] func - Callable as func(index, bounds) for each intersecting object, in index order
+    //! \param[in] threshold - [optional] Minimum number of objects worth indexing
+    //! \param[in,out] results - [optional] Scratch buffer  (Default is the buffer used by painting)
+    //! \return uint32_t - Number of intersecting objects
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    uint32_t  query(SceneFile::Kind kind, const render::RectL& rc, FUNC&& func, uint32_t threshold = IndexThreshold,
+                    std::vector<render::PointGrid::index_t>* results = nullptr)
+    {
+      const SceneFile::Positions pos = positions(kind);
+      if (kind == SceneFile::Polygons || pos.Count < threshold)
+        return visible(kind, rc, func);
+
+      render::PointGrid& grid = Grids[kind];
+      std::call_once(GridsBuilt[kind], [&] { grid = render::PointGrid(pos.X, pos.Y, pos.Count, IndexCellSize); });
+
+      // Positions strictly between the rectangle edges less the object extent  (See visible())
+      const render::RectL ext = padded(extent(kind));
+      auto clamp = [](int64_t v) { return int32_t(std::max<int64_t>(INT32_MIN, std::min<int64_t>(INT32_MAX, v))); };
+      const render::RectL area(clamp(int64_t(rc.left) - ext.right + 1), clamp(int64_t(rc.top) - ext.bottom + 1),
+                               clamp(int64_t(rc.right) - ext.left),     clamp(int64_t(rc.bottom) - ext.top));
+      if (grid.covers(area))
+        return visible(kind, rc, func);
+
+      std::vector<render::PointGrid::index_t>& found = results ? *results : Candidates;
+      grid.query(area, found);
+      for (uint32_t idx : found)
+        func(idx, render::RectL(pos.X[idx]+ext.left, pos.Y[idx]+ext.top, pos.X[idx]+ext.right, pos.Y[idx]+ext.bottom));
+      return uint32_t(found.size());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::visible const
+    //! Enumerate the objects of a scene file intersecting a rectangle
+    //!
+    //! Objects of each kind except polygons have a fixed size, so the test reduces to
+    //! comparing positions against the rectangle expanded by that size.
+    //!
+    //! \param[in] kind - Object type
+    //! \param[in] rc - Rectangle
+    //! \param[in] func - Callable as func(index, bounds) for each intersecting object
+    //! \return uint32_t - Number of intersecting objects
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    uint32_t  visible(SceneFile::Kind kind, const render::RectL& rc, FUNC&& func) const
+    {
+      const SceneFile& file = *Source;
+      uint32_t n = 0;
+
+      if (kind == SceneFile::Polygons)
+      {
+        const uint32_t* first = file.column<uint32_t>(SceneFile::PolygonFirst);
+        const int32_t* bounds = file.column<int32_t>(SceneFile::PolygonBounds);
+        for (uint32_t idx = 0; idx < file.count(kind); ++idx)
+        {
+          // Skip malformed vertex ranges
+          if (first[idx] > first[idx+1] || first[idx+1] > file.vertices() || first[idx+1] - first[idx] > SceneFile::MaxVertices)
+            continue;
+          const render::RectL r = padded(render::RectL(bounds[4*idx], bounds[4*idx+1], bounds[4*idx+2], bounds[4*idx+3]));
+          if (r.intersects(rc))
+            func(idx, r), ++n;
+        }
+        return n;
+      }
+
+      // Bounds relative to position
+      const render::RectL extent = padded(type::extent(kind));
+      const SceneFile::Positions pos = positions(kind);
+
+      // [x+extent.left, x+extent.right) intersects [rc.left, rc.right) iff rc.left-extent.right < x < rc.right-extent.left
+      const int64_t left = int64_t(rc.left) - extent.right,   right = int64_t(rc.right) - extent.left,
+                    top = int64_t(rc.top) - extent.bottom,    bottom = int64_t(rc.bottom) - extent.top;
+      for (uint32_t idx = 0; idx < pos.Count; ++idx)
+      {
+        const int32_t x = pos.X[idx], y = pos.Y[idx];
+        if (x > left && x < right && y > top && y < bottom)
+          func(idx, render::RectL(x+extent.left, y+extent.top, x+extent.right, y+extent.bottom)), ++n;
+      }
+      return n;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::positions const
+    //! Get the positions of a kind of fixed-size scene file object  (Empty for polygons)
+    ///////////////////////////////////////////////////////////////////////////////
+    SceneFile::Positions  positions(SceneFile::Kind kind) const
+    {
+      switch (kind)
+      {
+      case SceneFile::Signs:    return Source->signs();
+      case SceneFile::Trees:    return Source->trees();
+      case SceneFile::Bunnies:  return Source->bunnies();
+      case SceneFile::Eggs:     return Source->eggs();
+      default:                  return SceneFile::Positions {};
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::extent
+    //! Get the bounds of a kind of fixed-size scene file object relative to its position  (Excluding outlines)
+    ///////////////////////////////////////////////////////////////////////////////
+    static render::RectL  extent(SceneFile::Kind kind)
+    {
+      switch (kind)
+      {
+      case SceneFile::Signs:    return render::RectL(0, 0, 200, 170);     // Board + legs
+      case SceneFile::Trees:    return render::RectL(0, -50, 50, 32);     // Leaves + trunk
+      case SceneFile::Bunnies:  return render::RectL(0, -60, 60, 80);     // Ears to feet
+      case SceneFile::Eggs:     return render::RectL(0, 0, 20, 30);
+      default:                  return render::RectL();
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::item
+    //! Get the type of a kind of scene file object
+    ///////////////////////////////////////////////////////////////////////////////
+    static Item  item(SceneFile::Kind kind)
+    {
+      switch (kind)
+      {
+      case SceneFile::Signs:    return Item::Sign;
+      case SceneFile::Trees:    return Item::Tree;
+      case SceneFile::Bunnies:  return Item::Bunny;
+      case SceneFile::Eggs:     return Item::Eggs;
+      default:                  return Item::River;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::layer
+    //! Get the layer of a kind of scene file object
+    ///////////////////////////////////////////////////////////////////////////////
+    static Layer  layer(SceneFile::Kind kind)
+    {
+      return kind == SceneFile::Bunnies || kind == SceneFile::Eggs ? Layer::Dynamic : Layer::Static;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::includes
+    //! Query whether a set of layers includes a kind of scene object
+    ///////////////////////////////////////////////////////////////////////////////
+    static bool  includes(Layer layers, Item kind)
+    {
+      const Layer layer = kind == Item::Bunny || kind == Item::Eggs ? Layer::Dynamic : Layer::Static;
+      return (uint8_t(layers) & uint8_t(layer)) != 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::padded
+    //! Expands a bounding rectangle to contain outlines
+    ///////////////////////////////////////////////////////////////////////////////
+    static render::RectL  padded(const render::RectL& rc)
+    {
+      return render::RectL(rc.left-OutlinePadding, rc.top-OutlinePadding, rc.right+OutlinePadding, rc.bottom+OutlinePadding);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Scene::place
+    //! Appends an object to the layout and indexes its bounds
+    ///////////////////////////////////////////////////////////////////////////////
+    void  place(Item kind, render::PointL pt)
+    {
+      Layout.push_back(Placement{kind, pt});
+      Index.insert(bounds(Layout.back()));
+    }
+  };
+
+  //! \var Scene::River::Points - River outline
+  template <typename GFX>
+  constexpr typename Scene<GFX>::POINT  Scene<GFX>::River::Points[];
+
+  //! \var Scene::EggStyles - Hatch styles of easter eggs
+  template <typename GFX>
+  constexpr typename Scene<GFX>::HatchStyle  Scene<GFX>::EggStyles[];
+
+  //! \var Scene::EggColours - Colours of easter eggs
+  template <typename GFX>
+  constexpr typename Scene<GFX>::Colour  Scene<GFX>::EggColours[];
+
+} // namespace
+
+#endif
@@ -0,0 +1,395 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\SceneFile.h
+//! \brief Defines the memory-mapped binary scene format
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef SCENE_FILE_H
+#define SCENE_FILE_H
+
+#include <algorithm>          //!< std::min
+#include <cstdint>            //!< uint32_t
+#include <cstdio>             //!< std::fopen
+#include <cstring>            //!< std::memcpy
+#include <utility>            //!< std::move
+#include <vector>             //!< std::vector
+#include "MappedFile.h"       //!< hw1::MappedFile
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SceneFile - Read-only view of a binary scene, usually mapped from a file
+  //!
+  //! The file is a header followed by one array per object attribute (structure-of-arrays),
+  //! each starting on an 8-byte boundary:
+  //!
+  //!   Trees     - x, y                                              (int32)
+  //!   Eggs      - x, y (int32); hatch, fill, outline, back          (uint8 palette indices)
+  //!   Signs     - x, y                                              (int32)
+  //!   Bunnies   - x, y                                              (int32)
+  //!   Polygons  - first vertex (uint32, count+1 entries), bounds    (int32 left,top,right,bottom)
+  //!   Vertices  - x,y pairs                                         (int32)
+  //!
+  //! Opening a file checks the header, that every array lies within the file and that every
+  //! coordinate lies within [-MaxExtent, MaxExtent], so sums of coordinates and object sizes
+  //! cannot overflow 32 bits; the arrays are then read in place. Values that could index out
+  //! of range (palette indices and polygon vertex ranges) are checked when they are used.
+  //! All fields are little-endian.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct SceneFile
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Magic - File signature  ('HW1S')
+    static constexpr uint32_t Magic = 0x53315748;
+    //! \var Version - Format version
+    static constexpr uint16_t Version = 1;
+    //! \var MaxVertices - Maximum vertices of a polygon
+    static constexpr uint32_t MaxVertices = 256;
+    //! \var MaxExtent - Largest scene width or height, and magnitude of any coordinate  (Coordinates remain exact as floats)
+    static constexpr int32_t MaxExtent = 1 << 24;
+
+    //! \enum Column - Attribute arrays
+    enum Column : uint32_t
+    {
+      TreeX, TreeY,
+      EggX, EggY, EggHatch, EggFill, EggOutline, EggBack,
+      SignX, SignY,
+      BunnyX, BunnyY,
+      PolygonFirst, PolygonBounds,
+      Vertices,
+      NumColumns
+    };
+
+    //! \enum Kind - Object types, in painter's order
+    enum Kind : uint32_t
+    {
+      Polygons, Signs, Trees, Bunnies, Eggs,
+      NumKinds
+    };
+
+    //! \struct Header - File header
+    struct Header
+    {
+      uint32_t  Magic;                  //!< Signature
+      uint16_t  Version;                //!< Format version
+      uint16_t  Size;                   //!< Size of header, in bytes
+      int32_t   Width,                  //!< Scene extent
+                Height;
+      uint32_t  Counts[NumKinds];       //!< Number of objects of each kind
+      uint32_t  NumVertices;            //!< Number of polygon vertices
+      uint32_t  Reserved[2];            //!< Zero
+      uint64_t  Offsets[NumColumns];    //!< Byte offset of each column
+    };
+    static_assert(sizeof(Header) == 168, "Header must not contain padding");
+
+    //! \struct Positions - Coordinates of objects
+    struct Positions
+    {
+      const int32_t*  X;
+      const int32_t*  Y;
+      uint32_t        Count;
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    MappedFile      Mapping;            //!< File mapping  (If opened from a file)
+    const uint8_t*  Data = nullptr;     //!< First byte
+    size_t          Size = 0;           //!< Length in bytes
+    Header          Info {};            //!< Validated header
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    SceneFile() = default;
+    SceneFile(SceneFile&&) = default;
+    SceneFile& operator= (SceneFile&&) = default;
+
+    // ---------------------------------- STATIC METHODS ------------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::elementSize
+    //! Get the size of an element of a column, in bytes
+    ///////////////////////////////////////////////////////////////////////////////
+    static size_t elementSize(Column col)
+    {
+      switch (col)
+      {
+      case EggHatch: case EggFill: case EggOutline: case EggBack:   return 1;
+      case PolygonBounds:                                           return 16;
+      case Vertices:                                                return 8;
+      default:                                                      return 4;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::elementCount
+    //! Get the number of elements of a column
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint64_t elementCount(const Header& h, Column col)
+    {
+      switch (col)
+      {
+      case TreeX: case TreeY:                                       return h.Counts[Trees];
+      case SignX: case SignY:                                       return h.Counts[Signs];
+      case BunnyX: case BunnyY:                                     return h.Counts[Bunnies];
+      case PolygonFirst:                                            return uint64_t(h.Counts[Polygons]) + 1;
+      case PolygonBounds:                                           return h.Counts[Polygons];
+      case Vertices:                                                return h.NumVertices;
+      default:                                                      return h.Counts[Eggs];
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::bounded
+    //! Query whether coordinates lie within [-MaxExtent, MaxExtent]  (Branch-free, so the loop vectorizes)
+    //!
+    //! \param[in] values - Coordinates
+    //! \param[in] count - Number of coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    static bool bounded(const int32_t* values, size_t count)
+    {
+      uint32_t outside = 0;
+      for (size_t idx = 0; idx < count; ++idx)
+        outside |= uint32_t(uint32_t(values[idx]) + uint32_t(MaxExtent) > uint32_t(2 * MaxExtent));
+      return !outside;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool            empty() const           { return Data == nullptr; }
+    const uint8_t*  data() const            { return Data; }
+    size_t          size() const            { return Size; }
+    int32_t         width() const           { return Info.Width; }
+    int32_t         height() const          { return Info.Height; }
+    uint32_t        count(Kind k) const     { return Info.Counts[k]; }
+    uint32_t        vertices() const        { return Info.NumVertices; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::column const
+    //! Get an attribute array
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    const T* column(Column col) const
+    {
+      return reinterpret_cast<const T*>(Data + Info.Offsets[col]);
+    }
+
+    Positions trees() const    { return Positions{column<int32_t>(TreeX),  column<int32_t>(TreeY),  Info.Counts[Trees]};   }
+    Positions eggs() const     { return Positions{column<int32_t>(EggX),   column<int32_t>(EggY),   Info.Counts[Eggs]};    }
+    Positions signs() const    { return Positions{column<int32_t>(SignX),  column<int32_t>(SignY),  Info.Counts[Signs]};   }
+    Positions bunnies() const  { return Positions{column<int32_t>(BunnyX), column<int32_t>(BunnyY), Info.Counts[Bunnies]}; }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::open
+    //! Map and validate a scene file
+    //!
+    //! \param[in] path - Full path
+    //! \return bool - False if the file cannot be mapped or is not a valid scene
+    ///////////////////////////////////////////////////////////////////////////////
+    bool open(const char* path)
+    {
+      MappedFile file;
+      if (!file.open(path) || !attach(file.data(), file.size()))
+        return false;
+
+      Mapping = std::move(file);
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::attach
+    //! Validate a scene held in memory  (Must remain valid while in use; not copied)
+    //!
+    //! \param[in] data - First byte  (8-byte aligned)
+    //! \param[in] size - Length in bytes
+    //! \return bool - False if the data is not a valid scene
+    ///////////////////////////////////////////////////////////////////////////////
+    bool attach(const void* data, size_t size)
+    {
+      close();
+
+      Header h;
+      if (size < sizeof(Header) || (reinterpret_cast<uintptr_t>(data) & 7) != 0)
+        return false;
+      std::memcpy(&h, data, sizeof(Header));
+
+      // Little-endian hosts only read the signature correctly
+      if (h.Magic != Magic || h.Version != Version || h.Size != sizeof(Header)
+          || h.Width < 0 || h.Height < 0 || h.Width > MaxExtent || h.Height > MaxExtent)
+        return false;
+
+      for (uint32_t col = 0; col < NumColumns; ++col)
+      {
+        const uint64_t offset = h.Offsets[col],
+                       length = elementCount(h, Column(col)) * elementSize(Column(col));
+        if (offset % 8 != 0 || offset < sizeof(Header) || offset > size || length > size - offset)
+          return false;
+      }
+
+      // Reject coordinates beyond the largest extent
+      for (Column col : { TreeX, TreeY, EggX, EggY, SignX, SignY, BunnyX, BunnyY, PolygonBounds, Vertices })
+        if (!bounded(reinterpret_cast<const int32_t*>(static_cast<const uint8_t*>(data) + h.Offsets[col]),
+                     size_t(elementCount(h, col) * elementSize(col) / 4)))
+          return false;
+
+      Data = static_cast<const uint8_t*>(data);
+      Size = size;
+      Info = h;
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneFile::close
+    //! Release the scene
+    ///////////////////////////////////////////////////////////////////////////////
+    void close()
+    {
+      Mapping.close();
+      Data = nullptr;
+      Size = 0;
+      Info = Header{};
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SceneWriter - Builds binary scene files
+  ///////////////////////////////////////////////////////////////////////////////
+  struct SceneWriter
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    int32_t                Width = 640,         //!< Scene extent
+                           Height = 480;
+    std::vector<int32_t>   Columns32[SceneFile::NumColumns];    //!< 32-bit columns
+    std::vector<uint8_t>   Columns8[SceneFile::NumColumns];     //!< 8-bit columns  (Egg attributes)
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    SceneWriter()
+    {
+      Columns32[SceneFile::PolygonFirst].push_back(0);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    void tree(int32_t x, int32_t y)   { push(SceneFile::TreeX, x, y); }
+    void sign(int32_t x, int32_t y)   { push(SceneFile::SignX, x, y); }
+    void bunny(int32_t x, int32_t y)  { push(SceneFile::BunnyX, x, y); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneWriter::egg
+    //! Add an egg
+    //!
+    //! \param[in] x,y - Top-left
+    //! \param[in] hatch - Index of hatch style  (Scene::EggStyles)
+    //! \param[in] fill,outline,back - Indices of colours  (Scene::EggColours)
+    ///////////////////////////////////////////////////////////////////////////////
+    void egg(int32_t x, int32_t y, uint8_t hatch, uint8_t fill, uint8_t outline, uint8_t back)
+    {
+      push(SceneFile::EggX, x, y);
+      Columns8[SceneFile::EggHatch].push_back(hatch);
+      Columns8[SceneFile::EggFill].push_back(fill);
+      Columns8[SceneFile::EggOutline].push_back(outline);
+      Columns8[SceneFile::EggBack].push_back(back);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneWriter::polygon
+    //! Add a polygon  (At most SceneFile::MaxVertices vertices)
+    //!
+    //! \param[in] xy - Vertices as x,y pairs
+    //! \param[in] count - Number of vertices
+    ///////////////////////////////////////////////////////////////////////////////
+    void polygon(const int32_t* xy, uint32_t count)
+    {
+      std::vector<int32_t>& verts = Columns32[SceneFile::Vertices];
+      std::vector<int32_t>& bounds = Columns32[SceneFile::PolygonBounds];
+
+      int32_t left = INT32_MAX, top = INT32_MAX, right = INT32_MIN, bottom = INT32_MIN;
+      for (uint32_t v = 0; v < count; ++v)
+      {
+        left = std::min(left, xy[2*v]);
+        top = std::min(top, xy[2*v+1]);
+        right = std::max(right, xy[2*v]);
+        bottom = std::max(bottom, xy[2*v+1]);
+      }
+      verts.insert(verts.end(), xy, xy + 2*count);
+      Columns32[SceneFile::PolygonFirst].push_back(int32_t(verts.size() / 2));
+      bounds.insert(bounds.end(), { left, top, right, bottom });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneWriter::build const
+    //! Encode the scene
+    //!
+    //! \return std::vector<uint64_t> - Encoding  (8-byte aligned storage)
+    ///////////////////////////////////////////////////////////////////////////////
+    std::vector<uint64_t> build() const
+    {
+      SceneFile::Header h;
+      std::memset(&h, 0, sizeof(h));
+      h.Magic = SceneFile::Magic;
+      h.Version = SceneFile::Version;
+      h.Size = uint16_t(sizeof(SceneFile::Header));
+      h.Width = Width;
+      h.Height = Height;
+      h.Counts[SceneFile::Trees] = uint32_t(Columns32[SceneFile::TreeX].size());
+      h.Counts[SceneFile::Eggs] = uint32_t(Columns32[SceneFile::EggX].size());
+      h.Counts[SceneFile::Signs] = uint32_t(Columns32[SceneFile::SignX].size());
+      h.Counts[SceneFile::Bunnies] = uint32_t(Columns32[SceneFile::BunnyX].size());
+      h.Counts[SceneFile::Polygons] = uint32_t(Columns32[SceneFile::PolygonFirst].size() - 1);
+      h.NumVertices = uint32_t(Columns32[SceneFile::Vertices].size() / 2);
+
+      // Lay out columns on 8-byte boundaries
+      uint64_t offset = (sizeof(SceneFile::Header) + 7) & ~uint64_t(7);
+      for (uint32_t col = 0; col < SceneFile::NumColumns; ++col)
+      {
+        h.Offsets[col] = offset;
+        offset += (SceneFile::elementCount(h, SceneFile::Column(col)) * SceneFile::elementSize(SceneFile::Column(col)) + 7) & ~uint64_t(7);
+      }
+
+      std::vector<uint64_t> out(size_t(offset / 8), 0);
+      uint8_t* base = reinterpret_cast<uint8_t*>(out.data());
+      std::memcpy(base, &h, sizeof(h));
+      for (uint32_t col = 0; col < SceneFile::NumColumns; ++col)
+      {
+        const size_t width = SceneFile::elementSize(SceneFile::Column(col)),
+                     bytes = size_t(SceneFile::elementCount(h, SceneFile::Column(col)) * width);
+        const void* src = width == 1 ? static_cast<const void*>(Columns8[col].data()) : static_cast<const void*>(Columns32[col].data());
+        if (bytes)
+          std::memcpy(base + h.Offsets[col], src, bytes);
+      }
+      return out;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SceneWriter::save const
+    //! Write the encoding to a file
+    //!
+    //! \return bool - False if the file could not be written
+    ///////////////////////////////////////////////////////////////////////////////
+    bool save(const char* path) const
+    {
+      const std::vector<uint64_t> image = build();
+      FILE* out = std::fopen(path, "wb");
+      if (!out)
+        return false;
+      const bool written = std::fwrite(image.data(), sizeof(uint64_t), image.size(), out) == image.size();
+      return std::fclose(out) == 0 && written;
+    }
+
+  private:
+    void push(SceneFile::Column x, int32_t xv, int32_t yv)
+    {
+      Columns32[x].push_back(xv);
+      Columns32[x+1].push_back(yv);
+    }
+  };
+
+} // namespace hw1
+
+#endif
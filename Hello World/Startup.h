@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\Startup.h
+//! \brief Defines the startup timeline, the time-to-first-frame metric and deferred initialization
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+//!
+//! Unlike the paint profiler the timeline is always compiled, since it records only a few
+//! timestamps per process. In profiling builds each phase is also recorded as a profiler
+//! scope, so the trace shows startup alongside the first paints.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include <algorithm>          //!< std::sort
+#include <atomic>             //!< std::atomic
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdint>            //!< uint64_t
+#include <cstdio>             //!< std::snprintf
+#include <mutex>              //!< std::mutex
+#include <stdexcept>          //!< std::length_error
+#include <string>             //!< std::string
+#include "Delegate.h"         //!< hw1::Delegate
+#include "Profiler.h"         //!< HW1_PROFILE_SCOPE
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Startup - Timeline of the phases between process entry and the first frame
+  //!
+  //! Times are measured in nanoseconds from the first call to instance(), which the entry
+  //! point makes before anything else. The first frame is reached twice: when it has been
+  //! drawn (on the render thread) and when it has been shown (on the UI thread); a headless
+  //! backend, which has nothing to show, considers a frame shown once it is presented.
+  //!
+  //! Initialization the first frame does not depend upon is deferred until it is shown.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Startup
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias clock - Timeline clock
+    using clock = std::chrono::steady_clock;
+
+    //! \alias task_t - Deferred initialization
+    using task_t = Delegate<void ()>;
+
+    //! \var MaxPhases - Maximum number of phases recorded  (Later phases are counted but discarded)
+    static constexpr int32_t MaxPhases = 32;
+
+    //! \var MaxTasks - Maximum number of deferred tasks
+    static constexpr int32_t MaxTasks = 8;
+
+    //! \struct Phase - Timed step of startup
+    struct Phase
+    {
+      const char*  Name;      //!< Phase name (String literal)
+      uint64_t     Start,     //!< Start time (Nanoseconds since origin)
+                   End;       //!< End time (Nanoseconds since origin)
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    const clock::time_point  Origin = clock::now();   //!< Process entry
+    mutable std::mutex       Lock;                    //!< Guards phases and tasks
+    Phase                    Phases[MaxPhases];       //!< Phases in order of completion
+    int32_t                  Count = 0,               //!< Number of phases recorded
+                             Dropped = 0;             //!< Number of phases discarded
+    std::atomic<uint64_t>    Drawn{0},                //!< Time the first frame was drawn  (Zero until then)
+                             Shown{0};                //!< Time the first frame was shown  (Zero until then)
+    task_t                   Tasks[MaxTasks];         //!< Deferred tasks, in order of deferral
+    const char*              TaskNames[MaxTasks];     //!< Name of each deferred task
+    int32_t                  Pending = 0;             //!< Number of deferred tasks
+    bool                     Released = false;        //!< Whether deferred tasks have been run
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  private:
+    Startup() = default;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    //! Get the process timeline  (The first call defines its origin)
+    static Startup& instance()
+    {
+      static Startup s;
+      return s;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the time elapsed since the origin, in nanoseconds
+    uint64_t elapsed() const
+    {
+      return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - Origin).count());
+    }
+
+    //! Get the time the first frame was drawn, in nanoseconds  (Zero until then)
+    uint64_t drawn() const   { return Drawn.load(); }
+
+    //! Get the time the first frame was shown, in nanoseconds  (Zero until then)
+    uint64_t shown() const   { return Shown.load(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::report const
+    //! Summarize the timeline as a table  (Phases ordered by start time; times in milliseconds)
+    ///////////////////////////////////////////////////////////////////////////////
+    std::string report() const
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      Phase sorted[MaxPhases];
+      std::copy(Phases, Phases + Count, sorted);
+      std::sort(sorted, sorted + Count, [](const Phase& a, const Phase& b) { return a.Start < b.Start; });
+
+      char line[128];
+      std::snprintf(line, sizeof(line), "%-16s %9s %9s\n", "phase", "start(ms)", "took(ms)");
+      std::string out(line);
+      for (int32_t idx = 0; idx < Count; ++idx)
+      {
+        std::snprintf(line, sizeof(line), "%-16s %9.2f %9.2f\n", sorted[idx].Name, sorted[idx].Start / 1e6, (sorted[idx].End - sorted[idx].Start) / 1e6);
+        out += line;
+      }
+      std::snprintf(line, sizeof(line), "first frame drawn=%.2fms  shown=%.2fms  dropped=%d\n", drawn() / 1e6, shown() / 1e6, Dropped);
+      return out += line;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::record
+    //! Record a phase  (Any thread)
+    //!
+    //! \param[in] name - Phase name (String literal)
+    //! \param[in] start - Start time (Nanoseconds since origin)
+    //! \param[in] end - End time (Nanoseconds since origin)
+    ///////////////////////////////////////////////////////////////////////////////
+    void record(const char* name, uint64_t start, uint64_t end)
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      if (Count == MaxPhases)
+        ++Dropped;
+      else
+        Phases[Count++] = Phase{name, start, end};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::frameDrawn
+    //! Called by the render thread after drawing each frame; records the first as a phase
+    //!
+    //! \param[in] start - Time drawing began (Nanoseconds since origin)
+    //! \return bool - True for the first frame
+    ///////////////////////////////////////////////////////////////////////////////
+    bool frameDrawn(uint64_t start)
+    {
+      if (Drawn.load(std::memory_order_relaxed))
+        return false;
+
+      uint64_t none = 0;
+      const uint64_t now = elapsed();
+      if (!Drawn.compare_exchange_strong(none, now))
+        return false;
+      record("firstFrame", start, now);
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::frameShown
+    //! Called by the UI thread after showing each frame; the first defines the time to first frame
+    //!
+    //! \return bool - True for the first frame  (The caller should then release deferred tasks)
+    ///////////////////////////////////////////////////////////////////////////////
+    bool frameShown()
+    {
+      uint64_t none = 0;
+      return !Shown.load(std::memory_order_relaxed) && Shown.compare_exchange_strong(none, elapsed());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::defer
+    //! Defer initialization until the first frame has been shown  (UI thread only)
+    //!
+    //! \param[in] name - Phase name of the task (String literal)
+    //! \param[in] task - Task  (Run immediately once deferred tasks have been released)
+    //!
+    //! \throw std::length_error - Maximum number of tasks already deferred
+    ///////////////////////////////////////////////////////////////////////////////
+    void defer(const char* name, task_t task)
+    {
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (!Released)
+        {
+          if (Pending == MaxTasks)
+            throw std::length_error("Startup has the maximum number of deferred tasks");
+          TaskNames[Pending] = name;
+          Tasks[Pending++] = std::move(task);
+          return;
+        }
+      }
+      run(name, task);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Startup::release
+    //! Run the deferred tasks in order of deferral, timing each as a phase  (UI thread only; once)
+    ///////////////////////////////////////////////////////////////////////////////
+    void release()
+    {
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (Released)
+          return;
+        Released = true;
+      }
+      for (int32_t idx = 0; idx < Pending; ++idx)
+      {
+        run(TaskNames[idx], Tasks[idx]);
+        Tasks[idx].reset();
+      }
+      Pending = 0;
+    }
+
+  private:
+    //! Run a task, timing it as a phase
+    void run(const char* name, const task_t& task)
+    {
+      HW1_PROFILE_SCOPE(name, nullptr);
+      const uint64_t start = elapsed();
+      task();
+      record(name, start, elapsed());
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct StartupPhase - Records the duration of a scope as a startup phase
+  ///////////////////////////////////////////////////////////////////////////////
+  struct StartupPhase
+  {
+    const char*     Name;       //!< Phase name (String literal)
+    const uint64_t  Start;      //!< Start time (Nanoseconds since origin)
+
+    explicit StartupPhase(const char* name) : Name(name), Start(Startup::instance().elapsed())
+    {}
+
+    ~StartupPhase()
+    {
+      Startup::instance().record(Name, Start, Startup::instance().elapsed());
+    }
+  };
+
+} // namespace
+
+#define HW1_STARTUP_CONCAT2(a,b)  a##b
+#define HW1_STARTUP_CONCAT(a,b)   HW1_STARTUP_CONCAT2(a,b)
+
+//! \def HW1_STARTUP_PHASE - Time the enclosing scope as a startup phase  (And as a profiler scope in profiling builds)
+#define HW1_STARTUP_PHASE(name)   ::hw1::StartupPhase HW1_STARTUP_CONCAT(startupPhase, __LINE__)(name); HW1_PROFILE_SCOPE(name, nullptr)
+
+#endif
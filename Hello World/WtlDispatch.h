@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\WtlDispatch.h
+//! \brief Binds the Windows Template Library's commands to hw1::CommandTable
+//! \date 18 October 2026
+//! \author Nick Crowley
+//! \copyright � Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_DISPATCH_H
+#define WTL_DISPATCH_H
+
+#include <cstdint>                                              //!< uint16_t
+#include <utility>                                              //!< std::forward
+#include <wtl/WTL.hpp>                                          //!< Windows Template Library
+#include "Commands.h"                                           //!< hw1::CommandTable
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TableCommand - wtl command whose execution is dispatched through a command table
+  //!
+  //! wtl's menus and command groups take ownership of their commands, so each is a single
+  //! object that registers its action with the table and forwards execution to it. Menus,
+  //! buttons and the table itself therefore dispatch every command the same way. Each is
+  //! allocated once upon startup and owned by wtl, as is each command group; MainWindow
+  //! dispatches WM_COMMAND through the table without them.
+  //!
+  //! \tparam COMMAND - wtl command type  (eg. wtl::ExitProgramCommand)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename COMMAND>
+  struct TableCommand : COMMAND
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    CommandTable&  Table;    //!< Table dispatching the command  (Must outlive the command)
+    uint16_t       Id;       //!< Command id
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TableCommand::TableCommand
+    //! Create the command and register its action with the table
+    //!
+    //! \param[in,out] table - Table dispatching the command
+    //! \param[in] id - Command id
+    //! \param[in] group - Command group id
+    //! \param[in] name - Display name  (String literal)
+    //! \param[in] args - Arguments of the wtl command
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename... ARGS>
+    TableCommand(CommandTable& table, wtl::CommandId id, wtl::CommandGroupId group, const char* name, ARGS&&... args)
+      : COMMAND(std::forward<ARGS>(args)...), Table(table), Id(uint16_t(id))
+    {
+      Table.add(Id, uint16_t(group), name, [this] { this->COMMAND::execute(); });
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // TableCommand::execute
+    //! Execute the command through the table  (Which calls the action of the wtl command)
+    ///////////////////////////////////////////////////////////////////////////////
+    void execute() override
+    {
+      Table.execute(Id);
+    }
+  };
+
+} // namespace
+
+#endif
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\WtlGraphics.h
+//! \brief Binds the Windows Template Library to the scene drawing interface
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef WTL_GRAPHICS_H
+#define WTL_GRAPHICS_H
+
+#include <algorithm>                                            //!< std::max
+#include <cstring>                                              //!< std::memcpy
+#include <type_traits>                                          //!< std::conditional_t
+#include <vector>                                               //!< std::vector
+#include <wtl/WTL.hpp>                                          //!< Windows Template Library
+#include "render/DeviceContext.h"                               //!< hw1::render::DeviceContext
+#include "render/Framebuffer.h"                                 //!< hw1::render::Framebuffer
+#include "render/Transform.h"                                   //!< hw1::render::Transform
+
+//! \namespace hw1 - Hello World v1 (Drawing demonstration)
+namespace hw1
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \alias native_char_t - Character type of a wtl encoding  (Target of hw1::literal)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <wtl::Encoding ENC>
+  using native_char_t = std::conditional_t<ENC == wtl::Encoding::UTF16, wchar_t, char>;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct WtlGraphics - Drawing vocabulary of the GDI device context  (See hw1::render::Graphics)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct WtlGraphics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    using char_t        = ::TCHAR;
+    using DeviceContext = wtl::DeviceContext;
+    using POINT         = ::POINT;
+    using PointL        = wtl::PointL;
+    using SizeL         = wtl::SizeL;
+    using RectL         = wtl::RectL;
+    using TriangleL     = wtl::TriangleL;
+    using Colour        = wtl::Colour;
+    using StockBrush    = wtl::StockBrush;
+    using HatchStyle    = wtl::HatchStyle;
+    using PenStyle      = wtl::PenStyle;
+    using DrawingMode   = wtl::DrawingMode;
+    using DrawTextFlags = wtl::DrawTextFlags;
+    using FontWeight    = wtl::FontWeight;
+    using HPen          = wtl::HPen;
+    using HBrush        = wtl::HBrush;
+    using HFont         = wtl::HFont;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    template <typename CHR, unsigned LEN>
+    static decltype(auto) c_str(const CHR (&str)[LEN])
+    {
+      return wtl::c_str(str);
+    }
+
+    //! Get the shared screen context  (Used for font creation)
+    static DeviceContext& screenDC()
+    {
+      return DeviceContext::ScreenDC;
+    }
+
+    //! GDI does not count primitives  (Used by HW1_PROFILE_SCOPE)
+    static const uint64_t* primitives(const DeviceContext& dc)
+    {
+      return nullptr;
+    }
+
+    //! GDI output is not transformed  (The window always paints with the identity view)
+    static void transform(DeviceContext& dc, const render::Transform& view)
+    {
+    }
+
+    //! Copy the invalidated area of a frame drawn by the software renderer to the device context
+    static void present(DeviceContext& dc, const render::Framebuffer& frame, const RectL& rc)
+    {
+      const render::RectL area = render::RectL(rc.left, rc.top, rc.right, rc.bottom).intersect(frame.bounds());
+      if (area.empty())
+        return;
+
+      // Pass only the invalidated rows
+      const ::BITMAPINFO info = bitmapInfo(frame, area.height());
+      ::SetDIBitsToDevice(dc.handle(), area.left, area.top, area.width(), area.height(), area.left, 0, 0, area.height(), frame.row(area.top), &info, DIB_RGB_COLORS);
+    }
+
+    //! Copy a frame drawn by the software renderer to the device context, scaled to a size  (Used while a resize settles)
+    static void present(DeviceContext& dc, const render::Framebuffer& frame, int32_t width, int32_t height)
+    {
+      if (!frame.width() || !frame.height())
+        return;
+
+      const ::BITMAPINFO info = bitmapInfo(frame, frame.height());
+      ::StretchDIBits(dc.handle(), 0, 0, width, height, 0, 0, frame.width(), frame.height(), frame.row(0), &info, DIB_RGB_COLORS, SRCCOPY);
+    }
+
+    template <int32_t W, int32_t H>
+    static void ellipse(DeviceContext& dc, PointL pt)
+    {
+      dc.ellipse(RectL(pt, SizeL(W,H)));
+    }
+
+    template <int32_t W, int32_t H>
+    static void triangle(DeviceContext& dc, PointL pt)
+    {
+      dc.triangle(TriangleL(pt, W, H));
+    }
+
+    template <typename SHAPE>
+    static void polygon(DeviceContext& dc)
+    {
+      dc.polygon(SHAPE::Points);
+    }
+
+    //! The GDI wrapper accepts only fixed-size vertex arrays, so runtime arrays are passed to GDI directly
+    static void polygon(DeviceContext& dc, const POINT* pts, int32_t count)
+    {
+      if (count >= 3)
+        ::Polygon(dc.handle(), pts, count);
+    }
+
+  private:
+    //! Describe rows of a frame as a top-down 32-bit DIB whose rows are the framebuffer pitch  (0xAARRGGBB is BGRA in memory)
+    static ::BITMAPINFO bitmapInfo(const render::Framebuffer& frame, int32_t rows)
+    {
+      ::BITMAPINFO info = {};
+      info.bmiHeader.biSize = sizeof(info.bmiHeader);
+      info.bmiHeader.biWidth = frame.pitch();
+      info.bmiHeader.biHeight = -rows;
+      info.bmiHeader.biPlanes = 1;
+      info.bmiHeader.biBitCount = 32;
+      info.bmiHeader.biCompression = BI_RGB;
+      return info;
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct GdiTextWriter - Draws the text of software frames with GDI fonts  (See render::DeviceContext::setTextWriter)
+  //!
+  //! The pixels beneath the text are copied into a memory bitmap, GDI draws the text over them
+  //! with the named font, colours and mix mode, and the result is copied back. Fonts and the
+  //! bitmap are created upon first use and kept, so a writer must be used by one thread only.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct GdiTextWriter
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  private:
+    //! \struct Font - GDI font created for a font description
+    struct Font
+    {
+      render::HFont  Desc;      //!< Font description
+      ::HFONT        Handle;    //!< GDI font
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    ::HDC              Memory = nullptr;     //!< Memory device context  (Created upon first use)
+    ::HBITMAP          Bitmap = nullptr;     //!< Top-down 32-bit DIB section selected into Memory
+    ::HGDIOBJ          Original = nullptr;   //!< Bitmap originally selected into Memory
+    uint32_t*          Bits = nullptr;       //!< First pixel of Bitmap
+    int32_t            Width = 0,            //!< Bitmap dimensions
+                       Height = 0;
+    std::vector<Font>  Fonts;                //!< Fonts created so far
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    GdiTextWriter() = default;
+    GdiTextWriter(const GdiTextWriter&) = delete;
+    GdiTextWriter& operator= (const GdiTextWriter&) = delete;
+
+    ~GdiTextWriter()
+    {
+      for (const Font& f : Fonts)
+        ::DeleteObject(f.Handle);
+      if (Memory)
+      {
+        ::SelectObject(Memory, Original);
+        ::DeleteObject(Bitmap);
+        ::DeleteDC(Memory);
+      }
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // GdiTextWriter::operator()
+    //! Draw text with the font, colours, mix mode and clipping rectangle of a software context
+    //!
+    //! \param[in,out] target - Render target
+    //! \param[in] dc - Software device context
+    //! \param[in] text - Text  (Lines separated by '\n')
+    //! \param[in] rc - Layout rectangle  (Device coordinates)
+    //! \param[in] flags - Alignment flags  (Values match the DT_ flags of DrawText)
+    //! \return bool - False if the GDI objects could not be created  (The bitmap font is used instead)
+    ///////////////////////////////////////////////////////////////////////////////
+    bool operator() (render::Framebuffer& target, const render::DeviceContext& dc, const char* text, const render::RectL& rc, render::DrawTextFlags flags)
+    {
+      const render::RectL area = rc.intersect(dc.clipRect());
+      if (area.empty())
+        return true;
+
+      ::HFONT font = find(dc.font());
+      if (!font || !reserve(area.width(), area.height()))
+        return false;
+
+      // Copy the pixels beneath the text
+      for (int32_t y = 0; y < area.height(); ++y)
+        std::memcpy(Bits + size_t(y)*Width, target.row(area.top+y) + area.left, size_t(area.width()) * sizeof(uint32_t));
+
+      // Draw over them  (Output beyond the copied area is discarded)
+      ::RECT layout = { rc.left - area.left, rc.top - area.top, rc.right - area.left, rc.bottom - area.top };
+      ::SelectObject(Memory, font);
+      ::SetTextColor(Memory, colorref(dc.textColour()));
+      ::SetBkColor(Memory, colorref(dc.backColour()));
+      ::SetBkMode(Memory, dc.mode() == render::DrawingMode::Opaque ? OPAQUE : TRANSPARENT);
+      ::DrawTextA(Memory, text, -1, &layout, ::UINT(flags) | DT_NOPREFIX);
+      ::GdiFlush();
+
+      // Copy back  (GDI clears the alpha of the pixels it draws)
+      for (int32_t y = 0; y < area.height(); ++y)
+      {
+        const uint32_t* src = Bits + size_t(y)*Width;
+        uint32_t* dst = target.row(area.top+y) + area.left;
+        for (int32_t x = 0; x < area.width(); ++x)
+          dst[x] = src[x] | 0xFF000000;
+      }
+      return true;
+    }
+
+  private:
+    //! Convert a colour (0x00RRGGBB) into a COLORREF (0x00BBGGRR)
+    static ::COLORREF colorref(render::Colour c)
+    {
+      return RGB((uint32_t(c) >> 16) & 0xFF, (uint32_t(c) >> 8) & 0xFF, uint32_t(c) & 0xFF);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // GdiTextWriter::find
+    //! Find or create the GDI font of a font description
+    //!
+    //! \param[in] desc - Font description  (Height in points, as passed to wtl::DeviceContext::getFont by the GDI scene)
+    //! \return ::HFONT - GDI font, or nullptr if it cannot be created
+    ///////////////////////////////////////////////////////////////////////////////
+    ::HFONT find(const render::HFont& desc)
+    {
+      for (const Font& f : Fonts)
+        if (f.Desc.height == desc.height && f.Desc.weight == desc.weight && std::strcmp(f.Desc.face, desc.face) == 0)
+          return f.Handle;
+
+      ::HDC screen = ::GetDC(nullptr);
+      const int32_t pixels = -::MulDiv(desc.height, ::GetDeviceCaps(screen, LOGPIXELSY), 72);
+      ::ReleaseDC(nullptr, screen);
+
+      // Greyscale anti-aliasing  (ClearType would assume the pixel layout of the screen)
+      ::HFONT handle = ::CreateFontA(pixels, 0, 0, 0, int32_t(desc.weight), FALSE, FALSE, FALSE, DEFAULT_CHARSET, OUT_DEFAULT_PRECIS,
+                                     CLIP_DEFAULT_PRECIS, ANTIALIASED_QUALITY, DEFAULT_PITCH|FF_DONTCARE, desc.face);
+      if (handle)
+        Fonts.push_back(Font{desc, handle});
+      return handle;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // GdiTextWriter::reserve
+    //! Ensure the memory bitmap is at least a given size
+    //!
+    //! \return bool - False if the bitmap cannot be created
+    ///////////////////////////////////////////////////////////////////////////////
+    bool reserve(int32_t width, int32_t height)
+    {
+      if (width <= Width && height <= Height)
+        return true;
+
+      if (!Memory && !(Memory = ::CreateCompatibleDC(nullptr)))
+        return false;
+
+      ::BITMAPINFO info = {};
+      info.bmiHeader.biSize = sizeof(info.bmiHeader);
+      info.bmiHeader.biWidth = std::max(width, Width);
+      info.bmiHeader.biHeight = -std::max(height, Height);
+      info.bmiHeader.biPlanes = 1;
+      info.bmiHeader.biBitCount = 32;
+      info.bmiHeader.biCompression = BI_RGB;
+
+      void* bits = nullptr;
+      ::HBITMAP bitmap = ::CreateDIBSection(Memory, &info, DIB_RGB_COLORS, &bits, nullptr, 0);
+      if (!bitmap)
+        return false;
+
+      // Replace the previous bitmap
+      ::HGDIOBJ previous = ::SelectObject(Memory, bitmap);
+      if (Bitmap)
+        ::DeleteObject(Bitmap);
+      else
+        Original = previous;
+      Bitmap = bitmap;
+      Bits = static_cast<uint32_t*>(bits);
+      Width = int32_t(info.bmiHeader.biWidth);
+      Height = -int32_t(info.bmiHeader.biHeight);
+      return true;
+    }
+  };
+
+} // namespace hw1
+
+#endif
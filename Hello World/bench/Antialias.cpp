@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Antialias.cpp
+//! \brief Compares analytic-coverage anti-aliasing with 4x and 16x supersampling
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::max
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::log10
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct SampledDC - Device context rendering at a multiple of the output resolution
+//!
+//! Pen widths are scaled with the view, so outlines cover the same area at every resolution.
+//! When 'PLAIN' is set hatched brushes are drawn solid and text is omitted, leaving only the
+//! geometry whose edges are anti-aliased  (Hatching and glyphs are not resolution independent)
+////////////////////////////////////////////////////////////////////////////////
+template <int32_t FACTOR, bool PLAIN>
+struct SampledDC : render::DeviceContext
+{
+  using render::DeviceContext::DeviceContext;
+  using render::DeviceContext::operator+=;
+
+  SampledDC& operator+= (const render::HPen& p)
+  {
+    render::HPen scaled = p;
+    scaled.width = std::max(1, p.width) * FACTOR;
+    render::DeviceContext::operator+=(scaled);
+    return *this;
+  }
+
+  SampledDC& operator+= (const render::HBrush& b)
+  {
+    render::HBrush solid = b;
+    solid.hatched = solid.hatched && !PLAIN;
+    render::DeviceContext::operator+=(solid);
+    return *this;
+  }
+
+  void write(const char* text, const render::RectL& area, render::DrawTextFlags flags)
+  {
+    if (!PLAIN)
+      render::DeviceContext::write(text, area, flags);
+  }
+};
+
+//! \struct Sampled - Software renderer bound to a SampledDC
+template <int32_t FACTOR, bool PLAIN>
+struct Sampled : render::Graphics
+{
+  using DeviceContext = SampledDC<FACTOR,PLAIN>;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::downsample
+//! Average each FACTOR x FACTOR block of samples into one output pixel  (Box filter)
+////////////////////////////////////////////////////////////////////////////////
+void downsample(const render::Framebuffer& src, int32_t factor, render::Framebuffer& dst)
+{
+  const uint32_t area = uint32_t(factor * factor);
+  for (int32_t y = 0; y < dst.height(); ++y)
+  {
+    uint32_t* out = dst.row(y);
+    for (int32_t x = 0; x < dst.width(); ++x)
+    {
+      uint32_t sum[4] = {};
+      for (int32_t sy = 0; sy < factor; ++sy)
+      {
+        const uint32_t* in = src.row(y*factor + sy) + x*factor;
+        for (int32_t sx = 0; sx < factor; ++sx)
+          for (int32_t c = 0; c < 4; ++c)
+            sum[c] += (in[sx] >> 8*c) & 0xFF;
+      }
+      uint32_t pixel = 0;
+      for (int32_t c = 0; c < 4; ++c)
+        pixel |= ((sum[c] + area/2) / area) << 8*c;
+      out[x] = pixel;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::paintAt
+//! Paint the scene at a multiple of the output resolution and resolve it into the output
+//!
+//! \param[in] factor - Samples per pixel along each axis  (1 paints the output directly)
+//! \param[in] antialias - Whether to anti-alias edges with analytic coverage
+////////////////////////////////////////////////////////////////////////////////
+template <int32_t FACTOR, bool PLAIN>
+void paintAt(render::Framebuffer& out, render::Framebuffer& samples, bool antialias)
+{
+  Scene<Sampled<FACTOR,PLAIN>> scene;
+  scene.setView(render::Transform(float(FACTOR), 0, 0));
+  render::Framebuffer& target = FACTOR == 1 ? out : samples;
+  SampledDC<FACTOR,PLAIN> dc(target);
+  dc.setAntialias(antialias);
+  scene.paint(dc, target.bounds(), true);
+  if (FACTOR != 1)
+    downsample(samples, FACTOR, out);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::compare
+//! Measure the mean and peak per-channel difference between two images, and their PSNR
+////////////////////////////////////////////////////////////////////////////////
+void compare(const render::Framebuffer& img, const render::Framebuffer& ref, double& mean, int32_t& peak, double& psnr)
+{
+  double abs = 0, sq = 0;
+  peak = 0;
+  for (int32_t y = 0; y < ref.height(); ++y)
+    for (int32_t x = 0; x < ref.width(); ++x)
+      for (int32_t c = 0; c < 3; ++c)
+      {
+        const int32_t d = std::abs(int32_t((img.at(x,y) >> 8*c) & 0xFF) - int32_t((ref.at(x,y) >> 8*c) & 0xFF));
+        abs += d, sq += double(d) * d, peak = std::max(peak, d);
+      }
+  const double n = 3.0 * ref.width() * ref.height();
+  mean = abs / n;
+  psnr = sq ? 10 * std::log10(255.0 * 255.0 / (sq / n)) : 99.0;
+}
+
+//! \struct Mode - Anti-aliasing method under test
+struct Mode
+{
+  const char*  Name;
+  bool         Analytic;   //!< Whether edges use analytic coverage
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::run
+//! Paint the scene with one method, timing it on the full scene and scoring it on plain geometry
+////////////////////////////////////////////////////////////////////////////////
+template <int32_t FACTOR>
+void run(const Mode& mode, int32_t repeats, const render::Framebuffer& reference, double& baseline)
+{
+  using clock = std::chrono::steady_clock;
+  const int32_t width = reference.width(), height = reference.height();
+  render::Framebuffer out(width, height),
+                      samples(FACTOR == 1 ? 1 : width*FACTOR, FACTOR == 1 ? 1 : height*FACTOR);
+
+  // Time the complete scene, text and hatching included
+  paintAt<FACTOR,false>(out, samples, mode.Analytic);    // Warm up
+  const auto start = clock::now();
+  for (int32_t n = 0; n < repeats; ++n)
+    paintAt<FACTOR,false>(out, samples, mode.Analytic);
+  const double ms = std::chrono::duration<double, std::milli>(clock::now() - start).count() / repeats;
+  if (!baseline)
+    baseline = ms;
+
+  // Score the edges of the plain geometry against the reference
+  double mean, psnr;
+  int32_t peak;
+  paintAt<FACTOR,true>(out, samples, mode.Analytic);
+  compare(out, reference, mean, peak, psnr);
+  std::printf("%-16s %10.3f %8.2fx %10.3f %6d %8.2f\n", mode.Name, ms, ms / baseline, mean, peak, psnr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Paints the 640x480 scene aliased, with analytic coverage and supersampled, and scores each
+//! against 64x supersampling
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [repeats]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const int32_t repeats = argc > 1 ? std::atoi(argv[1]) : 50;
+  const int32_t width = 640, height = 480;
+
+  // Reference: 8x8 samples per pixel
+  render::Framebuffer reference(width, height), samples(width*8, height*8);
+  paintAt<8,true>(reference, samples, false);
+
+  std::printf("%-16s %10s %9s %10s %6s %8s\n", "mode", "ms/frame", "cost", "mean err", "peak", "PSNR dB");
+  double baseline = 0;
+  run<1>(Mode{"aliased",     false}, repeats,               reference, baseline);
+  run<1>(Mode{"analytic",    true},  repeats,               reference, baseline);
+  run<2>(Mode{"4x SSAA",     false}, std::max(1, repeats/4), reference, baseline);
+  run<4>(Mode{"16x SSAA",    false}, std::max(1, repeats/8), reference, baseline);
+  return 0;
+}
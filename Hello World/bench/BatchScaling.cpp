@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\BatchScaling.cpp
+//! \brief Compares immediate drawing of many trees and eggs with drawing them in batches
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::min, std::max
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtol
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Result - Cost of drawing a set of instances
+////////////////////////////////////////////////////////////////////////////////
+struct Result
+{
+  uint64_t  StateChanges;   //!< Render state changes
+  double    Micros;         //!< Elapsed time per instance (microseconds)
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::run
+//! Clears the target, then times a drawing function
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+Result run(render::Framebuffer& target, render::DeviceContext& dc, size_t instances, FUNC&& draw)
+{
+  using clock = std::chrono::steady_clock;
+
+  target.fill(target.bounds(), 0);
+  dc.resetStats();
+
+  const auto start = clock::now();
+  draw();
+  const double elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+  return Result{dc.stats().StateChanges, elapsed / instances};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::compare
+//! Times immediate and batched drawing alternately, keeping the best of between 3 and 25 runs of each
+//!
+//! \param[out] immediate - Cost of immediate drawing
+//! \param[out] batched - Cost of batched drawing
+//! \return bool - True if both drew the same pixels
+////////////////////////////////////////////////////////////////////////////////
+template <typename IMMEDIATE, typename BATCHED>
+bool compare(render::Framebuffer& target, render::Framebuffer& reference, render::DeviceContext& dc, size_t instances,
+             IMMEDIATE&& drawImmediate, BATCHED&& drawBatched, Result& immediate, Result& batched)
+{
+  const size_t repeats = std::min<size_t>(25, std::max<size_t>(3, 100000 / instances));
+  bool match = true;
+  for (size_t n = 0; n < repeats; ++n)
+  {
+    const Result i = run(target, dc, instances, drawImmediate);
+    reference = target;
+    const Result b = run(target, dc, instances, drawBatched);
+    match &= target == reference;
+
+    immediate = n && immediate.Micros < i.Micros ? immediate : i;
+    batched = n && batched.Micros < b.Micros ? batched : b;
+  }
+  return match;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::sweep
+//! Draws increasing numbers of trees and eggs scattered across a canvas, immediately and in batches
+//!
+//! \param[in] size - Canvas dimensions
+//! \return bool - True if batched drawing matched immediate drawing
+////////////////////////////////////////////////////////////////////////////////
+bool sweep(int32_t size)
+{
+  static constexpr size_t counts[] = { 5, 50, 500, 5000, 50000, 100000 };
+
+  render::Framebuffer target(size, size), reference(size, size);
+  render::DeviceContext dc(target);
+  scene_t scene;
+  std::mt19937 rng(11);
+  bool identical = true;
+
+  std::printf("\n== %dx%d canvas\n", size, size);
+  std::printf("%-6s %8s %14s %14s %12s %12s %8s\n", "kind", "count", "immed.states", "batch.states", "immed(us)", "batch(us)", "match");
+  for (size_t count : counts)
+  {
+    // Scatter trees across the canvas  (Leaves and trunks of neighbours overlap)
+    std::vector<render::PointL> trees(count);
+    for (auto& pt : trees)
+      pt = render::PointL(int32_t(rng() % (size-50)), 50 + int32_t(rng() % (size-85)));
+
+    Result immediate{}, batched{};
+    bool match = compare(target, reference, dc, count, [&] { for (const auto& pt : trees) scene.drawTree(dc, pt, true); },
+                                                       [&] { scene.drawTrees(dc, trees, true); }, immediate, batched);
+    identical &= match;
+    std::printf("%-6s %8zu %14llu %14llu %12.3f %12.3f %8s\n", "trees", count, (unsigned long long)immediate.StateChanges,
+                (unsigned long long)batched.StateChanges, immediate.Micros, batched.Micros, match ? "yes" : "NO");
+
+    // Scatter eggs with random colours
+    std::vector<scene_t::EggInstance> eggs(count);
+    for (auto& egg : eggs)
+    {
+      egg.Position = render::PointL(int32_t(rng() % (size-20)), int32_t(rng() % (size-30)));
+      egg.Style = scene_t::EggAttributes{uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11)};
+    }
+
+    match = compare(target, reference, dc, count, [&] { for (const auto& egg : eggs) scene.drawEggs(dc, render::span<const scene_t::EggInstance>(&egg, 1), true); },
+                                                  [&] { scene.drawEggs(dc, eggs, true); }, immediate, batched);
+    identical &= match;
+    std::printf("%-6s %8zu %14llu %14llu %12.3f %12.3f %8s\n", "eggs", count, (unsigned long long)immediate.StateChanges,
+                (unsigned long long)batched.StateChanges, immediate.Micros, batched.Micros, match ? "yes" : "NO");
+  }
+  return identical;
+}
+
+//! \var MinCanvas - Smallest canvas  (Holds a tree or an egg with room to scatter it)
+constexpr int32_t MinCanvas = 100;
+
+//! \var MaxCanvas - Largest canvas
+constexpr int32_t MaxCanvas = 16384;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::parseCanvas
+//! Parse a canvas size, which must be a whole number within [MinCanvas, MaxCanvas]
+////////////////////////////////////////////////////////////////////////////////
+bool parseCanvas(const char* arg, int32_t& size)
+{
+  char* end;
+  const long value = std::strtol(arg, &end, 10);
+  if (end == arg || *end || value < MinCanvas || value > MaxCanvas)
+    return false;
+  size = int32_t(value);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Draws increasing numbers of trees and eggs immediately and in batches, sparsely and densely overlapping
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [canvas size] [dense canvas size]
+//! \return int - 0 if every batch matched, 1 if any differed or the command line is invalid
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  int32_t size = 4096,
+          dense = 256;
+  if ((argc > 1 && !parseCanvas(argv[1], size)) || (argc > 2 && !parseCanvas(argv[2], dense)) || argc > 3)
+  {
+    std::printf("usage: BatchScaling [canvas size] [dense canvas size]  (Each %d to %d pixels)\n", MinCanvas, MaxCanvas);
+    return 1;
+  }
+
+  // Instances overlap densely upon the small canvas  (Every primitive lies beneath many others)
+  const bool sparseMatch = sweep(size);
+  const bool denseMatch = sweep(dense);
+  return sparseMatch && denseMatch ? 0 : 1;
+}
@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Culling.cpp
+//! \brief Measures viewport culling and level-of-detail substitution at increasing object counts
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::sqrt
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtoul
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"     //!< hw1::render::Graphics
+#include "../render/PointGrid.h"    //!< hw1::render::PointGrid
+#include "../SceneFile.h"           //!< hw1::SceneFile
+#include "../Scene.h"               //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::fastest
+//! Measure the fastest of several repetitions, in milliseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double fastest(int32_t repeats, FUNC&& func)
+{
+  double best = 1e30;
+  for (int32_t n = 0; n < repeats; ++n)
+  {
+    const auto start = steady::now();
+    func();
+    best = std::min(best, std::chrono::duration<double, std::milli>(steady::now() - start).count());
+  }
+  return best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::generate
+//! Generate a square world of scattered trees and eggs  (One object per 1600 square pixels)
+////////////////////////////////////////////////////////////////////////////////
+SceneWriter generate(uint32_t objects)
+{
+  std::mt19937 rng(11);
+  SceneWriter w;
+  w.Width = w.Height = std::max(2048, int32_t(std::sqrt(double(objects)) * 40));
+  for (uint32_t n = 0; n < objects; ++n)
+    if (n % 3 == 0)
+      w.tree(int32_t(rng() % uint32_t(w.Width-50)), 50 + int32_t(rng() % uint32_t(w.Height-85)));
+    else
+      w.egg(int32_t(rng() % uint32_t(w.Width-20)), int32_t(rng() % uint32_t(w.Height-30)),
+            uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+  return w;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Generates worlds of increasing size, then compares linear and indexed culling and paints
+//! views at several zoom levels with and without level-of-detail substitution
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [largest object count]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const uint32_t largest = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 4000000;
+  const render::RectL viewport(0, 0, 1024, 768);
+  bool consistent = true;
+
+  std::printf("%10s %10s %10s %12s %12s %8s\n", "objects", "build(ms)", "index(MB)", "linear(ms)", "grid(ms)", "match");
+  std::vector<std::vector<uint64_t>> images;
+  for (uint32_t objects : { 10000u, 100000u, 1000000u, 4000000u })
+  {
+    if (objects > largest)
+      break;
+    images.push_back(generate(objects).build());
+    SceneFile file;
+    file.attach(images.back().data(), images.back().size()*8);
+
+    // Positions of eggs intersecting a viewport at the centre of the world
+    const SceneFile::Positions eggs = file.eggs();
+    const render::RectL centre(file.width()/2, file.height()/2, file.width()/2 + viewport.width(), file.height()/2 + viewport.height());
+    const render::RectL area(centre.left-19, centre.top-29, centre.right, centre.bottom);
+
+    std::vector<uint32_t> linear, indexed;
+    const double scan = fastest(5, [&] {
+      linear.clear();
+      for (uint32_t idx = 0; idx < eggs.Count; ++idx)
+        if (area.contains(render::PointL(eggs.X[idx], eggs.Y[idx])))
+          linear.push_back(idx);
+    });
+    render::PointGrid grid;
+    const double build = fastest(1, [&] { grid = render::PointGrid(eggs.X, eggs.Y, eggs.Count, scene_t::IndexCellSize); });
+    const double query = fastest(5, [&] { grid.query(area, indexed); });
+    consistent &= linear == indexed;
+
+    std::printf("%10u %10.2f %10.2f %12.3f %12.4f %8s\n", objects, build, grid.memory() / 1e6, scan, query, linear == indexed ? "yes" : "NO");
+  }
+
+  // Paint views of each world: 1:1 at the centre, zoomed out 10x, and the entire world
+  std::printf("\n%10s %8s %6s %10s %10s %10s %12s %12s\n", "objects", "scale", "lod", "drawn", "simplified", "culled", "paint(ms)", "speedup");
+  for (const std::vector<uint64_t>& image : images)
+  {
+    SceneFile file;
+    file.attach(image.data(), image.size()*8);
+    scene_t scene(file);
+    const uint32_t objects = file.count(SceneFile::Trees) + file.count(SceneFile::Eggs);
+
+    for (float scale : { 1.0f, 0.1f, float(viewport.height()) / file.height() })
+    {
+      // Centre of world at centre of viewport
+      scene.setView(render::Transform(scale, viewport.width()/2 - scale*file.width()/2, viewport.height()/2 - scale*file.height()/2));
+
+      double withLod = 0;
+      for (bool lod : { true, false })
+      {
+        scene.setDetail(lod ? scene_t::LevelOfDetail() : scene_t::LevelOfDetail{0.0f, 0.0f});
+        render::Framebuffer target(viewport.width(), viewport.height());
+        render::DeviceContext dc(target);
+        scene.paint(dc, viewport, true);      // Builds the index upon first use
+
+        const int32_t repeats = lod || objects < 1000000 ? 5 : 1;
+        const double ms = fastest(repeats, [&] { scene.paint(dc, viewport, true); });
+        if (lod)
+          withLod = ms;
+
+        const scene_t::PaintStats& stats = scene.stats();
+        consistent &= stats.Drawn + stats.Simplified + stats.Culled == objects;
+        std::printf("%10u %8.4f %6s %10u %10u %10u %12.3f", objects, scale, lod ? "on" : "off", stats.Drawn, stats.Simplified, stats.Culled, ms);
+        if (lod)
+          std::printf("\n");
+        else
+          std::printf(" %11.1fx\n", ms / withLod);
+      }
+    }
+  }
+  return consistent ? 0 : 1;
+}
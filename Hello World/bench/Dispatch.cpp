@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Dispatch.cpp
+//! \brief Measures event and command dispatch throughput and the allocations made by registration
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::malloc
+#include <functional>         //!< std::function
+#include <map>                //!< std::map
+#include <memory>             //!< std::unique_ptr
+#include <new>                //!< std::bad_alloc
+#include <vector>             //!< std::vector
+#include "../Commands.h"      //!< hw1::CommandTable
+#include "../Delegate.h"      //!< hw1::Event
+
+using namespace hw1;
+using steady = std::chrono::steady_clock;
+
+//! \var Allocations - Number of calls to global operator new
+static size_t Allocations = 0;
+
+void* operator new(size_t n)
+{
+  ++Allocations;
+  if (void* p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept              { std::free(p); }
+void operator delete(void* p, size_t) noexcept      { std::free(p); }
+
+//! \var Messages - Number of messages dispatched per handler set
+constexpr size_t Messages = 2000000;
+
+//! \var Commands - Number of commands registered
+constexpr uint16_t Commands = 200;
+
+//! \var FirstCommand - Id of the first command
+constexpr uint16_t FirstCommand = 0xE100;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Window - Receives messages
+////////////////////////////////////////////////////////////////////////////////
+struct Window
+{
+  uint64_t Handled = 0;
+
+  bool onMessage(uint32_t msg, uintptr_t w)  { Handled += w; return msg == 1; }
+  bool onIgnore(uint32_t, uintptr_t)        { return false; }
+  void onCommand()                          { ++Handled; }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Handler - Polymorphic handler  (Heap allocated, as by a conventional message map)
+////////////////////////////////////////////////////////////////////////////////
+struct Handler
+{
+  virtual ~Handler() = default;
+  virtual bool handle(uint32_t msg, uintptr_t w) = 0;
+};
+
+struct MessageHandler : Handler
+{
+  Window* Wnd;
+  explicit MessageHandler(Window* wnd) : Wnd(wnd)  {}
+  bool handle(uint32_t msg, uintptr_t w) override  { return Wnd->onMessage(msg, w); }
+};
+
+struct IgnoreHandler : Handler
+{
+  Window* Wnd;
+  explicit IgnoreHandler(Window* wnd) : Wnd(wnd)  {}
+  bool handle(uint32_t msg, uintptr_t w) override  { return Wnd->onIgnore(msg, w); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct CommandBase - Polymorphic command  (Heap allocated, found by map)
+////////////////////////////////////////////////////////////////////////////////
+struct CommandBase
+{
+  uint16_t    Id, Group;
+  const char* Name;
+  CommandBase(uint16_t id, uint16_t group, const char* name) : Id(id), Group(group), Name(name)  {}
+  virtual ~CommandBase() = default;
+  virtual void execute() = 0;
+};
+
+struct WindowCommand : CommandBase
+{
+  std::function<void ()> Action;
+  WindowCommand(uint16_t id, const char* name, std::function<void ()> action) : CommandBase(id, 0, name), Action(std::move(action))  {}
+  void execute() override  { Action(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::measure
+//! Time a workload and count its allocations
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double measure(FUNC&& fn, size_t& allocations)
+{
+  const size_t before = Allocations;
+  const auto start = steady::now();
+  fn();
+  const double secs = std::chrono::duration<double>(steady::now() - start).count();
+  allocations = Allocations - before;
+  return secs;
+}
+
+void report(const char* name, double setup, size_t regs, double secs, size_t dispatchAllocs, size_t count, uint64_t check)
+{
+  std::printf("%-22s %14.2f %12.1f %14zu %12llu\n", name, setup / regs, count / secs / 1e6, dispatchAllocs, (unsigned long long)check);
+}
+
+int main()
+{
+  std::printf("== Events  (3 handlers; the last handles the message)\n");
+  std::printf("%-22s %14s %12s %14s %12s\n", "dispatch", "allocs/handler", "Mmsg/s", "dispatch allocs", "checksum");
+
+  // Virtual handlers allocated individually
+  {
+    Window wnd;
+    std::vector<std::unique_ptr<Handler>> handlers;
+    size_t setup, during;
+    measure([&] { handlers.reserve(3);
+                  handlers.emplace_back(new IgnoreHandler(&wnd));
+                  handlers.emplace_back(new IgnoreHandler(&wnd));
+                  handlers.emplace_back(new MessageHandler(&wnd)); }, setup);
+    const double secs = measure([&] { for (size_t n = 0; n < Messages; ++n)
+                                        for (auto& h : handlers)
+                                          if (h->handle(uint32_t(n & 1), n))
+                                            break; }, during);
+    report("virtual (new)", double(setup), 3, secs, during, Messages, wnd.Handled);
+  }
+
+  // std::function handlers capturing enough state to escape the small-buffer
+  {
+    Window wnd;
+    std::vector<std::function<bool (uint32_t, uintptr_t)>> handlers;
+    size_t setup, during;
+    uint64_t salt[2] = {0, 0};
+    measure([&] { handlers.reserve(3);
+                  handlers.emplace_back([&wnd, salt](uint32_t m, uintptr_t w) { return wnd.onIgnore(m, w + salt[0]); });
+                  handlers.emplace_back([&wnd, salt](uint32_t m, uintptr_t w) { return wnd.onIgnore(m, w + salt[1]); });
+                  handlers.emplace_back([&wnd, salt](uint32_t m, uintptr_t w) { return wnd.onMessage(m, w + salt[0]); }); }, setup);
+    const double secs = measure([&] { for (size_t n = 0; n < Messages; ++n)
+                                        for (auto& h : handlers)
+                                          if (h(uint32_t(n & 1), n))
+                                            break; }, during);
+    report("std::function", double(setup), 3, secs, during, Messages, wnd.Handled);
+  }
+
+  // Inline delegates within an event
+  {
+    Window wnd;
+    Event<uint32_t, uintptr_t> event;
+    size_t setup, during;
+    uint64_t salt[2] = {0, 0};
+    measure([&] { event += Event<uint32_t, uintptr_t>::handler_t::bind<Window, &Window::onIgnore>(&wnd);
+                  event += [&wnd, salt](uint32_t m, uintptr_t w) { return wnd.onIgnore(m, w + salt[1]); };
+                  event += Event<uint32_t, uintptr_t>::handler_t::bind<Window, &Window::onMessage>(&wnd); }, setup);
+    const double secs = measure([&] { for (size_t n = 0; n < Messages; ++n)
+                                        event.raise(uint32_t(n & 1), n); }, during);
+    report("hw1::Event", double(setup), 3, secs, during, Messages, wnd.Handled);
+  }
+
+  std::printf("\n== Commands  (%u commands, executed round-robin by id)\n", unsigned(Commands));
+  std::printf("%-22s %14s %12s %14s %12s\n", "table", "allocs/command", "Mcmd/s", "dispatch allocs", "checksum");
+
+  // Map of heap-allocated commands
+  {
+    Window wnd;
+    std::map<uint16_t, std::unique_ptr<CommandBase>> table;
+    size_t setup, during;
+    measure([&] { for (uint16_t id = 0; id < Commands; ++id)
+                    table.emplace(uint16_t(FirstCommand + id), std::unique_ptr<CommandBase>(new WindowCommand(uint16_t(FirstCommand + id), "Command", [&wnd] { wnd.onCommand(); }))); }, setup);
+    const double secs = measure([&] { for (size_t n = 0; n < Messages; ++n)
+                                      {
+                                        auto pos = table.find(uint16_t(FirstCommand + n % Commands));
+                                        if (pos != table.end())
+                                          pos->second->execute();
+                                      } }, during);
+    report("map<unique_ptr>", double(setup), Commands, secs, during, Messages, wnd.Handled);
+  }
+
+  // Arena-backed command table
+  {
+    Window wnd;
+    size_t setup, during;
+    CommandTable table(FirstCommand, Commands);   // Reserves its index  (Two allocations)
+    measure([&] { for (uint16_t id = 0; id < Commands; ++id)
+                    table.add(uint16_t(FirstCommand + id), 0, "Command", Delegate<void ()>::bind<Window, &Window::onCommand>(&wnd)); }, setup);
+    const double secs = measure([&] { for (size_t n = 0; n < Messages; ++n)
+                                        table.execute(uint16_t(FirstCommand + n % Commands)); }, during);
+    report("hw1::CommandTable", double(setup + 2), Commands, secs, during, Messages, wnd.Handled);
+  }
+  return 0;
+}
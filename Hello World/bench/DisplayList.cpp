@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\DisplayList.cpp
+//! \brief Measures recording, serialization and replay throughput of display lists
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"       //!< hw1::render::Graphics
+#include "../render/DisplayList.h"    //!< hw1::render::DisplayList
+#include "../render/TileRenderer.h"   //!< hw1::render::TileRenderer
+#include "../Scene.h"                 //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::timeFrames
+//! Measure the average time of an operation, in microseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double timeFrames(int32_t frames, FUNC&& func)
+{
+  using clock = std::chrono::steady_clock;
+
+  // Warm up
+  func();
+
+  const auto start = clock::now();
+  for (int32_t n = 0; n < frames; ++n)
+  {
+    func();
+  }
+  return std::chrono::duration<double, std::micro>(clock::now() - start).count() / frames;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Records the scene, round-trips it through the binary encoding, then replays it
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [frames] [file to save the last recorded list to]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  struct Workload { const char* Name; int32_t Width, Height; size_t Eggs; };
+  static constexpr Workload workloads[] = { {"scene", 640, 480, 0}, {"+10k eggs", 1920, 1080, 10000}, {"+100k eggs", 3840, 2160, 100000} };
+
+  const int32_t frames = argc > 1 ? std::atoi(argv[1]) : 200;
+  const char*   path   = argc > 2 ? argv[2] : nullptr;
+  bool identical = true;
+
+  std::printf("%-11s %9s %10s %11s %11s %11s %11s %11s %11s %8s\n", "workload", "commands", "bytes", "paint(us)", "record(us)",
+              "encode MB/s", "decode MB/s", "replay(us)", "tiled(us)", "match");
+  for (const Workload& w : workloads)
+  {
+    const int32_t n = std::max(3, int32_t(frames / (1 + w.Eggs / 1000)));
+
+    // Scatter extra eggs across the frame
+    std::mt19937 rng(11);
+    std::vector<scene_t::EggInstance> eggs(w.Eggs);
+    for (auto& egg : eggs)
+    {
+      egg.Position = render::PointL(int32_t(rng() % (w.Width-20)), int32_t(rng() % (w.Height-30)));
+      egg.Style = scene_t::EggAttributes{uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11)};
+    }
+
+    scene_t scene;
+    render::Framebuffer reference(w.Width, w.Height), target(w.Width, w.Height), tiled(w.Width, w.Height);
+    auto draw = [&](render::DeviceContext& dc) {
+      scene.paint(dc, reference.bounds(), true);
+      for (size_t first = 0; first < eggs.size(); first += 4096)
+        scene.drawEggs(dc, render::span<const scene_t::EggInstance>(&eggs[first], std::min<size_t>(4096, eggs.size()-first)), true);
+    };
+
+    // Draw through the scene's C++ drawing functions
+    render::DeviceContext direct(reference);
+    const double painted = timeFrames(n, [&] { draw(direct); });
+
+    // Record, then round-trip through the binary encoding
+    render::DisplayList recorded, loaded;
+    const double recording = timeFrames(n, [&] { recorded.record(reference.bounds(), draw); });
+
+    std::vector<uint8_t> bytes;
+    const double encoding = timeFrames(n, [&] { recorded.serialize(bytes); }),
+                 decoding = timeFrames(n, [&] { loaded.deserialize(bytes.data(), bytes.size()); });
+    bool match = loaded.mismatch(recorded) == recorded.size() && loaded.size() == recorded.size();
+
+    // Replay without running the scene's code or random number generator
+    render::DeviceContext dc(target);
+    const double replayed = timeFrames(n, [&] { loaded.replay(dc); });
+    match &= target == reference;
+
+    render::TileRenderer renderer;
+    const double replayedTiled = timeFrames(n, [&] { renderer.replay(tiled, loaded.Commands); });
+    match &= tiled == reference;
+
+    identical &= match;
+    std::printf("%-11s %9zu %10zu %11.1f %11.1f %11.1f %11.1f %11.1f %11.1f %8s\n", w.Name, recorded.size(), bytes.size(), painted, recording,
+                bytes.size() / encoding, bytes.size() / decoding, replayed, replayedTiled, match ? "yes" : "NO");
+
+    if (path && &w == &workloads[0] && !loaded.save(path))
+    {
+      std::printf("unable to write %s\n", path);
+      return 1;
+    }
+  }
+
+  // Lists of different frames report where they diverge
+  render::DisplayList first, second;
+  scene_t one(1), two(2);
+  first.record(render::RectL(0, 0, 640, 480), [&](render::DeviceContext& dc) { one.paint(dc, dc.clipRect(), true); });
+  second.record(render::RectL(0, 0, 640, 480), [&](render::DeviceContext& dc) { two.paint(dc, dc.clipRect(), true); });
+  std::printf("frames with different eggs diverge at command %zu of %zu\n", first.mismatch(second), first.size());
+
+  return identical ? 0 : 1;
+}
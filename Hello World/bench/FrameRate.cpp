@@ -0,0 +1,46 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\FrameRate.cpp
+//! \brief Measures headless frames-per-second of the scene using the software renderer
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Renders the scene repeatedly and reports the frame rate
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [width] [height] [frames]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  using namespace hw1;
+  using clock = std::chrono::steady_clock;
+
+  const int32_t width  = argc > 1 ? std::atoi(argv[1]) : 640,
+                height = argc > 2 ? std::atoi(argv[2]) : 480,
+                frames = argc > 3 ? std::atoi(argv[3]) : 2000;
+
+  render::Framebuffer target(width, height);
+  render::DeviceContext dc(target);
+  Scene<render::Graphics> scene;
+
+  // Warm up
+  scene.paint(dc, target.bounds(), true);
+
+  // Render
+  const auto start = clock::now();
+  for (int32_t n = 0; n < frames; ++n)
+    scene.paint(dc, target.bounds(), true);
+  const double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+  std::printf("%dx%d  frames=%d  elapsed=%.3fs  fps=%.1f  us/frame=%.2f\n",
+              width, height, frames, elapsed, frames / elapsed, elapsed * 1e6 / frames);
+  return 0;
+}
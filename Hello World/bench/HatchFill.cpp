@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\HatchFill.cpp
+//! \brief Compares the precomputed hatch fill kernel with per-pixel pattern lookup
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <vector>             //!< std::vector
+#include "../render/Types.h"          //!< hw1::render::HatchStyle
+#include "../render/Spans.h"          //!< hw1::render::fillHatch
+#include "../render/DeviceContext.h"  //!< hw1::render::DeviceContext::hatchRow
+
+using namespace hw1;
+
+//! \alias kernel_t - Signature of pattern fill kernels
+using kernel_t = void (*)(uint32_t*, int32_t, int32_t, uint8_t, uint32_t, uint32_t, bool);
+
+////////////////////////////////////////////////////////////////////////////////
+// ::fillRows
+//! Fill a block of rows with a hatch style, each starting at a different pattern phase
+////////////////////////////////////////////////////////////////////////////////
+void fillRows(kernel_t kernel, std::vector<uint32_t>& pixels, int32_t width, int32_t rows, render::HatchStyle style, bool opaque)
+{
+  for (int32_t y = 0; y < rows; ++y)
+    kernel(pixels.data() + size_t(y)*width, width - (y & 7), y*3 & 7, render::DeviceContext::hatchRow(style, y),
+           0xFF00FF00, 0xFF8B4513, opaque);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::throughput
+//! Measure a kernel in millions of pixels per second
+////////////////////////////////////////////////////////////////////////////////
+double throughput(kernel_t kernel, std::vector<uint32_t>& pixels, int32_t width, int32_t rows, int32_t repeats, render::HatchStyle style, bool opaque)
+{
+  using clock = std::chrono::steady_clock;
+  const auto start = clock::now();
+  for (int32_t n = 0; n < repeats; ++n)
+    fillRows(kernel, pixels, width, rows, style, opaque);
+  const double elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  return double(width) * rows * repeats / elapsed / 1e6;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Fills spans of each hatch style with both kernels, verifying identical output
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [span width] [repeats]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  static constexpr const char* names[] = { "Horizontal", "Vertical", "ForwardDiagonal", "BackwardDiagonal", "Cross", "CrossDiagonal" };
+  const int32_t width   = argc > 1 ? std::atoi(argv[1]) : 640,
+                repeats = argc > 2 ? std::atoi(argv[2]) : 200,
+                rows    = 256;
+
+  std::vector<uint32_t> reference(size_t(width)*rows), pixels(size_t(width)*rows);
+  bool identical = true;
+
+  std::printf("span width %d\n", width);
+  std::printf("%-18s %-12s %14s %14s %9s %6s\n", "style", "mode", "lookup(Mp/s)", "hatch(Mp/s)", "speedup", "match");
+  for (int32_t s = 0; s < render::NumHatchStyles; ++s)
+    for (bool opaque : { true, false })
+    {
+      const auto style = render::HatchStyle(s);
+
+      // Verify  (Transparent fills preserve the existing background)
+      for (size_t i = 0; i < pixels.size(); ++i)
+        reference[i] = pixels[i] = uint32_t(i * 2654435761u);
+      fillRows(render::fillPattern, reference, width, rows, style, opaque);
+      fillRows(render::fillHatch, pixels, width, rows, style, opaque);
+      const bool match = pixels == reference;
+      identical &= match;
+
+      const double lookup = throughput(render::fillPattern, reference, width, rows, repeats, style, opaque),
+                   hatch  = throughput(render::fillHatch, pixels, width, rows, repeats, style, opaque);
+      std::printf("%-18s %-12s %14.1f %14.1f %8.2fx %6s\n", names[s], opaque ? "opaque" : "transparent",
+                  lookup, hatch, hatch / lookup, match ? "yes" : "NO");
+    }
+  return identical ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\HitTest.cpp
+//! \brief Measures hit-testing throughput against scene size
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::sqrt
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtoul
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"     //!< hw1::render::Graphics
+#include "../render/HitTest.h"      //!< hw1::render::insidePolygon
+#include "../SceneFile.h"           //!< hw1::SceneFile
+#include "../Scene.h"               //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::generate
+//! Generate a square world of rivers, signs, trees, bunnies and eggs  (One object per 1600 square pixels)
+////////////////////////////////////////////////////////////////////////////////
+SceneWriter generate(uint32_t objects)
+{
+  std::mt19937 rng(17);
+  SceneWriter w;
+  w.Width = w.Height = std::max(2048, int32_t(std::sqrt(double(objects)) * 40));
+  auto x = [&](int32_t margin) { return int32_t(rng() % uint32_t(w.Width - margin)); };
+  auto y = [&](int32_t margin) { return int32_t(rng() % uint32_t(w.Height - margin)); };
+
+  // A river for every 64 square tiles of 1024 pixels
+  for (int32_t n = 0; n < (w.Width / 1024) * (w.Height / 1024) / 64 + 1; ++n)
+  {
+    const int32_t left = x(600), top = y(300);
+    const int32_t xy[] = { left, top+50, left+200, top+30, left+400, top+10, left+600, top,
+                           left+600, top+50, left+480, top+60, left+280, top+110, left+120, top+170, left, top+180 };
+    w.polygon(xy, 9);
+  }
+
+  for (uint32_t n = 0; n < objects; ++n)
+    switch (n % 100)
+    {
+    case 0:   w.sign(x(200), y(170));              break;
+    case 1:   w.bunny(x(60), 60 + y(140));         break;
+    default:
+      if (n % 3 == 0)
+        w.tree(x(50), 50 + y(85));
+      else
+        w.egg(x(20), y(30), uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+    }
+  return w;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::reference
+//! Find the topmost object at a point by testing every object  (Reverse painter's order)
+////////////////////////////////////////////////////////////////////////////////
+scene_t::Hit reference(const SceneFile& file, render::PointL pt)
+{
+  const SceneFile::Kind kinds[] = { SceneFile::Eggs, SceneFile::Bunnies, SceneFile::Trees, SceneFile::Signs };
+  const scene_t::Item items[] = { scene_t::Item::Eggs, scene_t::Item::Bunny, scene_t::Item::Tree, scene_t::Item::Sign };
+  const SceneFile::Positions positions[] = { file.eggs(), file.bunnies(), file.trees(), file.signs() };
+
+  for (uint32_t k = 0; k < 4; ++k)
+    for (uint32_t idx = file.count(kinds[k]); idx-- > 0; )
+      if (scene_t::contains(items[k], render::PointL(positions[k].X[idx], positions[k].Y[idx]), pt))
+        return scene_t::Hit{items[k], idx};
+
+  const uint32_t* first = file.column<uint32_t>(SceneFile::PolygonFirst);
+  const render::POINT* verts = reinterpret_cast<const render::POINT*>(file.column<int32_t>(SceneFile::Vertices));
+  for (uint32_t idx = file.count(SceneFile::Polygons); idx-- > 0; )
+    if (render::insidePolygon(verts + first[idx], int32_t(first[idx+1] - first[idx]), pt))
+      return scene_t::Hit{scene_t::Item::River, idx};
+  return scene_t::Hit{};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Generates worlds of increasing size, then measures hit-testing random points through the
+//! spatial index against testing every object
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [largest object count] [number of queries]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const uint32_t largest = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 1000000,
+                 queries = argc > 2 ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 1000000;
+  bool consistent = true;
+
+  std::printf("%10s %10s %14s %14s %10s %8s\n", "objects", "hits(%)", "indexed(q/s)", "linear(q/s)", "speedup", "match");
+  for (uint32_t objects : { 1000u, 10000u, 100000u, 1000000u, 4000000u })
+  {
+    if (objects > largest)
+      break;
+    const std::vector<uint64_t> image = generate(objects).build();
+    SceneFile file;
+    file.attach(image.data(), image.size()*8);
+    scene_t scene(file);
+    scene.hitTest(render::PointL());      // Builds the index upon first use
+
+    // Random points across the world, as the mouse would visit them
+    std::mt19937 rng(23);
+    std::vector<render::PointL> points(queries);
+    for (render::PointL& pt : points)
+      pt = render::PointL(int32_t(rng() % uint32_t(file.width())), int32_t(rng() % uint32_t(file.height())));
+
+    uint32_t hits = 0;
+    const steady::time_point start = steady::now();
+    for (const render::PointL& pt : points)
+      hits += scene.hitTest(pt) ? 1 : 0;
+    const double indexed = queries / std::chrono::duration<double>(steady::now() - start).count();
+
+    // Test every object for a sample of the points  (Bounded to a few seconds)
+    const uint32_t sample = std::min<uint32_t>(queries, std::max<uint32_t>(100, 200000000 / objects));
+    bool match = true;
+    const steady::time_point begin = steady::now();
+    for (uint32_t n = 0; n < sample; ++n)
+    {
+      const scene_t::Hit expected = reference(file, points[n]),
+                         actual = scene.hitTest(points[n]);
+      match &= expected.Kind == actual.Kind && expected.Index == actual.Index;
+    }
+    const double linear = sample / std::chrono::duration<double>(steady::now() - begin).count();
+    consistent &= match;
+
+    std::printf("%10u %10.1f %14.0f %14.0f %9.0fx %8s\n", objects, 100.0 * hits / queries, indexed, linear, indexed / linear, match ? "yes" : "NO");
+  }
+  return consistent ? 0 : 1;
+}
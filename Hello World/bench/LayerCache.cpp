@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\LayerCache.cpp
+//! \brief Compares repaint cost with and without cached static layers
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::max
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"     //!< hw1::render::Graphics
+#include "../render/LayerCache.h"   //!< hw1::render::LayerCache
+#include "../Scene.h"               //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::timeFrames
+//! Measure the average time of painting a frame, in microseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double timeFrames(int32_t frames, FUNC&& paint)
+{
+  using clock = std::chrono::steady_clock;
+
+  // Warm up
+  paint();
+
+  const auto start = clock::now();
+  for (int32_t n = 0; n < frames; ++n)
+  {
+    paint();
+  }
+  return std::chrono::duration<double, std::micro>(clock::now() - start).count() / frames;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Repaints the scene uncached, from cached static layers, and after every resize
+//!
+//! Each resolution is repainted in full and within the bounds of the dynamic layers (as when
+//! only the eggs are invalidated), with the scene's own five trees and with a forest of extra
+//! trees in the static layer.
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [frames at 640x480] [forest size]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  struct Resolution { const char* Name; int32_t Width, Height; };
+  static constexpr Resolution resolutions[] = { {"640x480", 640, 480}, {"1080p", 1920, 1080}, {"4K", 3840, 2160} };
+  const int32_t frames = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const size_t  forest = argc > 2 ? size_t(std::atoi(argv[2])) : 2000;
+
+  bool identical = true;
+
+  std::printf("%-8s %6s %8s %12s %12s %12s %12s %9s %8s\n", "size", "trees", "region", "uncached", "blit+draw", "cached", "resized", "speedup", "match");
+  for (const Resolution& res : resolutions)
+    for (size_t extra : { size_t(0), forest })
+    {
+      scene_t scene;
+      const render::RectL frame(0, 0, res.Width, res.Height),
+                          dynamic = scene.layerBounds(scene_t::Layer::Dynamic);
+
+      // Scatter extra trees across the frame
+      std::mt19937 rng(11);
+      std::vector<render::PointL> trees(extra);
+      for (auto& pt : trees)
+        pt = render::PointL(int32_t(rng() % (res.Width-50)), 50 + int32_t(rng() % (res.Height-85)));
+
+      auto drawStatic  = [&](render::DeviceContext& dc, const render::RectL& rc) {
+        scene.paint(dc, rc, true, scene_t::Layer::Static);
+        if (!trees.empty())
+          scene.drawTrees(dc, trees, true);
+      };
+      auto drawDynamic = [&](render::DeviceContext& dc, const render::RectL& rc) { scene.paint(dc, rc, true, scene_t::Layer::Dynamic); };
+
+      for (const render::RectL& region : { frame, dynamic })
+      {
+        const int32_t n = std::max(5, int32_t(int64_t(frames) * 640*480 / (int64_t(region.width()) * region.height())
+                                              / (extra ? 20 : 1)));
+
+        // Draw every layer on every paint
+        render::Framebuffer reference(res.Width, res.Height);
+        render::DeviceContext direct(reference);
+        direct.setClip(region);
+        const double uncached = timeFrames(n, [&] {
+          drawStatic(direct, region);
+          drawDynamic(direct, region);
+        });
+
+        // Restore the static layers, then draw the dynamic layers directly over them
+        render::Framebuffer target(res.Width, res.Height);
+        render::DeviceContext dc(target);
+        dc.setClip(region);
+        render::LayerCache cache;
+        const double blitted = timeFrames(n, [&] {
+          render::blit(target, cache.update(render::SizeL(res.Width, res.Height), drawStatic), region);
+          drawDynamic(dc, region);
+        });
+        bool match = target == reference;
+
+        // Paint through the cache, drawing the dynamic layers only within their bounds
+        render::Framebuffer composited(res.Width, res.Height);
+        render::LayerCache layers;
+        const double cached = timeFrames(n, [&] { layers.paint(composited, region, dynamic, drawStatic, drawDynamic); });
+        match &= composited == reference;
+
+        // Resizing invalidates the cache on every paint
+        const double resized = timeFrames(std::max(5, n / 10), [&] {
+          layers.invalidate();
+          layers.paint(composited, region, dynamic, drawStatic, drawDynamic);
+        });
+        match &= composited == reference;
+
+        identical &= match;
+        std::printf("%-8s %6zu %8s %10.1fus %10.1fus %10.1fus %10.1fus %8.2fx %8s\n", res.Name, extra + 5, region == frame ? "full" : "dynamic",
+                    uncached, blitted, cached, resized, uncached / cached, match ? "yes" : "NO");
+      }
+    }
+  return identical ? 0 : 1;
+}
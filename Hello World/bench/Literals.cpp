@@ -0,0 +1,111 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Literals.cpp
+//! \brief Compares string literals transcoded at runtime with literals transcoded at compile time
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::malloc
+#include <cstring>            //!< std::strlen
+#include <new>                //!< std::bad_alloc
+#include <string>             //!< std::wstring
+#include "../Literal.h"       //!< hw1::literal
+
+using namespace hw1;
+using steady = std::chrono::steady_clock;
+
+//! \var Allocations - Number of calls to global operator new
+static size_t Allocations = 0;
+
+void* operator new(size_t n)
+{
+  ++Allocations;
+  if (void* p = std::malloc(n ? n : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept              { std::free(p); }
+void operator delete(void* p, size_t) noexcept      { std::free(p); }
+
+//! \var Iterations - Number of calls per path
+constexpr size_t Iterations = 2000000;
+
+//! \var SignText - Text of the sign drawn by every paint
+#define SIGN_TEXT "\n Hello World 1" "\n\n From Windows" "\n\n Template Library"
+
+static_assert(literal<wchar_t>(SIGN_TEXT).size() == sizeof(SIGN_TEXT)-1, "Transcoded at compile time");
+
+////////////////////////////////////////////////////////////////////////////////
+// ::widen
+//! Convert a narrow string to UTF-16 at runtime  (As a String<UTF16> constructed from a narrow literal)
+////////////////////////////////////////////////////////////////////////////////
+std::wstring widen(const char* str)
+{
+  std::wstring out(std::strlen(str), L'\0');
+  for (size_t idx = 0; str[idx]; ++idx)
+    out[idx] = wchar_t(uint8_t(str[idx]));
+  return out;
+}
+
+//! \var Sink - Prevents the compiler discarding results
+volatile uintptr_t Sink;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::measure
+//! Time a path and report nanoseconds and allocations per call
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+void measure(const char* name, FUNC&& fn)
+{
+  uint64_t check = 0;
+  const size_t before = Allocations;
+  const auto start = steady::now();
+  for (size_t n = 0; n < Iterations; ++n)
+    check += fn();
+  const double secs = std::chrono::duration<double>(steady::now() - start).count();
+  std::printf("%-34s %10.2f %12.2f %10llu\n", name, secs * 1e9 / Iterations, double(Allocations - before) / Iterations, (unsigned long long)check);
+}
+
+int main()
+{
+  std::printf("%-34s %10s %12s %10s\n", "path", "ns/call", "allocs/call", "checksum");
+
+  // Application name: returned by value from a narrow literal
+  measure("name(): narrow literal", [] {
+    std::wstring s = widen("Hello World 1");
+    Sink = uintptr_t(s.data());
+    return s.size();
+  });
+
+  // Application name: returned by value from a compile-time UTF-16 literal
+  measure("name(): compile-time literal", [] {
+    static constexpr auto text = literal<wchar_t>("Hello World 1");
+    std::wstring s = text.c_str();
+    Sink = uintptr_t(s.data());
+    return s.size();
+  });
+
+  // Application name: read through a pointer to the compile-time literal  (HelloWorldApp::Name)
+  measure("Name: compile-time literal pointer", [] {
+    static constexpr auto text = literal<wchar_t>("Hello World 1");
+    Sink = uintptr_t(text.c_str());
+    return text.size();
+  });
+
+  // Sign text: converted for a UTF-16 device context upon every paint
+  measure("drawSign: narrow literal", [] {
+    std::wstring s = widen(SIGN_TEXT);
+    Sink = uintptr_t(s.data());
+    return s.size();
+  });
+
+  // Sign text: viewed from read-only data
+  measure("drawSign: compile-time literal", [] {
+    static constexpr auto text = literal<wchar_t>(SIGN_TEXT);
+    Sink = uintptr_t(text.c_str());
+    return text.size();
+  });
+  return 0;
+}
@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\OfflineRender.cpp
+//! \brief Renders batches of scene variants to image files without a window, reporting throughput and memory
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::min
+#include <atomic>             //!< std::atomic
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstring>            //!< std::strcmp
+#include <memory>             //!< std::shared_ptr
+#include <random>             //!< std::mt19937
+#include <sstream>            //!< std::istringstream
+#include <string>             //!< std::string
+#include <vector>             //!< std::vector
+#if defined(_WIN32)
+  #include <windows.h>        //!< GetCurrentProcess
+  #include <psapi.h>          //!< GetProcessMemoryInfo
+  #pragma comment(lib, "psapi")
+#else
+  #include <sys/resource.h>   //!< getrusage
+#endif
+#include "../render/Graphics.h"         //!< hw1::render::Graphics
+#include "../render/StreamRenderer.h"   //!< hw1::render::StreamRenderer
+#include "../ImageFile.h"               //!< hw1::ImageWriter
+#include "../MappedFile.h"              //!< hw1::MappedFile
+#include "../Scene.h"                   //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+//! \var ChunkSize - Maximum eggs submitted per batch  (Bounds the cost of state-sorting dense batches)
+static constexpr size_t ChunkSize = 4096;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Variant - Scene variant rendered to a single image
+////////////////////////////////////////////////////////////////////////////////
+struct Variant
+{
+  int32_t   Width,
+            Height;
+  uint64_t  Seed;         //!< Seed of the scene's egg row and of the scattered eggs
+  uint32_t  Eggs;         //!< Eggs scattered in addition to the scene's own row
+
+  std::string name(const std::string& folder, const char* mode, ImageFormat format) const
+  {
+    return folder + "/offline_" + mode + "_" + std::to_string(Width) + "x" + std::to_string(Height)
+         + "_s" + std::to_string(Seed) + "_e" + std::to_string(Eggs) + (format == ImageFormat::PNG ? ".png" : ".ppm");
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Options - Command line options
+////////////////////////////////////////////////////////////////////////////////
+struct Options
+{
+  std::vector<render::SizeL>  Sizes = { {640,480}, {1920,1080}, {3840,2160} };
+  std::vector<uint64_t>       Seeds = { 1, 2, 3 };
+  std::vector<uint32_t>       Eggs  = { 0, 10000 };
+  ImageFormat  Format     = ImageFormat::PPM;
+  int32_t      BandHeight = render::StreamRenderer::DefaultBandHeight;
+  unsigned     Bands      = render::StreamRenderer::DefaultBands;
+  uint32_t     VerifyLimit = 3840*2160;    //!< Largest image compared against direct rendering  (Pixels)
+  std::string  Folder     = ".";           //!< Output folder
+  bool         Keep       = false;         //!< Whether to keep the images
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::peakResident
+//! Get the peak resident memory of the process, in megabytes
+////////////////////////////////////////////////////////////////////////////////
+double peakResident()
+{
+#if defined(_WIN32)
+  PROCESS_MEMORY_COUNTERS counters = { sizeof(counters) };
+  ::GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters));
+  return counters.PeakWorkingSetSize / 1048576.0;
+#else
+  struct rusage usage;
+  ::getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;     // Kilobytes
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Painter - Draws a scene variant  (As MainWindow::drawFrame, scaled to fit the image)
+////////////////////////////////////////////////////////////////////////////////
+struct Painter
+{
+  scene_t                             Scene;
+  std::vector<scene_t::EggInstance>   Eggs;
+  render::RectL                       Extent;
+
+  explicit Painter(const Variant& v) : Scene(v.Seed), Eggs(v.Eggs), Extent(0, 0, v.Width, v.Height)
+  {
+
+    // Fit the 640x480 layout to the image, centred
+    const float scale = std::min(v.Width / 640.0f, v.Height / 480.0f);
+    Scene.setView(render::Transform(scale, (v.Width - 640*scale) / 2, (v.Height - 480*scale) / 2));
+
+    // Scatter eggs across the image
+    std::mt19937 rng(uint32_t(v.Seed));
+    for (auto& egg : Eggs)
+    {
+      egg.Position = render::PointL(int32_t(rng() % std::max(1, v.Width-20)), int32_t(rng() % std::max(1, v.Height-30)));
+      egg.Style = scene_t::EggAttributes{uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11)};
+    }
+  }
+
+  void operator() (render::DeviceContext& dc)
+  {
+    Scene.paint(dc, Extent, true);
+    for (size_t first = 0; first < Eggs.size(); first += ChunkSize)
+      Scene.drawEggs(dc, render::span<const scene_t::EggInstance>(&Eggs[first], std::min(ChunkSize, Eggs.size()-first)), true);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::parseOptions
+//! Parse the command line
+//!
+//! \return bool - False if the command line is invalid
+////////////////////////////////////////////////////////////////////////////////
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+  auto list = [](const char* arg, auto&& parse) {
+    std::vector<decltype(parse(std::string()))> values;
+    std::istringstream in(arg);
+    for (std::string item; std::getline(in, item, ','); )
+      if (!item.empty())
+        values.push_back(parse(item));
+    return values;
+  };
+  auto count = [](const std::string& s) { return uint32_t(std::stoul(s)); };
+  auto size  = [](const std::string& s) { return render::SizeL(std::stoi(s), std::stoi(s.substr(s.find('x')+1))); };
+
+  for (int idx = 1; idx < argc; ++idx)
+  {
+    const char* arg = argv[idx];
+    const char* val = idx+1 < argc ? argv[idx+1] : nullptr;
+
+    if (!std::strcmp(arg, "--png"))
+      opt.Format = ImageFormat::PNG;
+    else if (!std::strcmp(arg, "--keep"))
+      opt.Keep = true;
+    else if (!val)
+      return false;
+    else if (!std::strcmp(arg, "--sizes"))
+      opt.Sizes = list(argv[++idx], size);
+    else if (!std::strcmp(arg, "--seeds"))
+      opt.Seeds = list(argv[++idx], [](const std::string& s) { return uint64_t(std::stoull(s)); });
+    else if (!std::strcmp(arg, "--eggs"))
+      opt.Eggs = list(argv[++idx], count);
+    else if (!std::strcmp(arg, "--band"))
+      opt.BandHeight = int32_t(std::stoi(argv[++idx]));
+    else if (!std::strcmp(arg, "--bands"))
+      opt.Bands = count(argv[++idx]);
+    else if (!std::strcmp(arg, "--verify"))
+      opt.VerifyLimit = count(argv[++idx]);
+    else if (!std::strcmp(arg, "--out"))
+      opt.Folder = argv[++idx];
+    else
+      return false;
+  }
+  return !opt.Sizes.empty() && !opt.Seeds.empty() && !opt.Eggs.empty() && opt.BandHeight > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::renderBatch
+//! Render every variant to a file through a stream renderer
+//!
+//! \return double - Elapsed seconds, including encoding of the last image
+////////////////////////////////////////////////////////////////////////////////
+double renderBatch(const std::vector<Variant>& variants, const Options& opt, bool pipelined, const char* mode, std::atomic<uint32_t>& failures)
+{
+  render::StreamRenderer renderer(opt.BandHeight, opt.Bands, pipelined);
+
+  const auto start = steady::now();
+  for (const Variant& v : variants)
+  {
+    const std::string path = v.name(opt.Folder, mode, opt.Format);
+    auto image = std::make_shared<ImageWriter>();
+    if (!image->create(path.c_str(), opt.Format, v.Width, v.Height))
+    {
+      std::fprintf(stderr, "unable to create %s\n", path.c_str());
+      ++failures;
+      continue;
+    }
+
+    // Stream each band's rows into the mapped file, completing it after the last row
+    Painter paint(v);
+    renderer.render(v.Width, v.Height, paint, [image, &failures] (const render::Framebuffer& band, int32_t rows) {
+      for (int32_t y = band.top(); y < band.top() + rows; ++y)
+        if (!image->write(band.row(y)))
+          ++failures;
+      if (image->complete() && !image->close())
+        ++failures;
+    });
+  }
+  renderer.finish();
+  return std::chrono::duration<double>(steady::now() - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::matches
+//! Compare a streamed image with the same variant drawn directly into a full frame
+////////////////////////////////////////////////////////////////////////////////
+bool matches(const Variant& v, const Options& opt, const char* mode)
+{
+  render::Framebuffer frame(v.Width, v.Height);
+  render::DeviceContext dc(frame);
+  Painter paint(v);
+  paint(dc);
+
+  const std::string path = v.name(opt.Folder, "direct", opt.Format);
+  ImageWriter image;
+  if (!image.create(path.c_str(), opt.Format, v.Width, v.Height))
+    return false;
+  for (int32_t y = 0; y < v.Height; ++y)
+    image.write(frame.row(y));
+  image.close();
+
+  MappedFile direct, streamed;
+  const bool same = direct.open(path.c_str()) && streamed.open(v.name(opt.Folder, mode, opt.Format).c_str())
+                 && direct.size() == streamed.size() && std::equal(direct.data(), direct.data() + direct.size(), streamed.data());
+  direct.close();
+  std::remove(path.c_str());
+  return same;
+}
+
+int main(int argc, char* argv[])
+{
+  Options opt;
+  if (!parseOptions(argc, argv, opt))
+  {
+    std::printf("usage: OfflineRender [--sizes 640x480,...] [--seeds 1,2,...] [--eggs 0,10000,...] [--png]\n"
+                "                     [--band rows] [--bands count] [--verify max-pixels] [--out folder] [--keep]\n");
+    return 1;
+  }
+
+  std::vector<Variant> variants;
+  uint64_t pixels = 0, largest = 0;
+  for (auto& sz : opt.Sizes)
+    for (auto seed : opt.Seeds)
+      for (auto eggs : opt.Eggs)
+      {
+        variants.push_back(Variant{sz.width, sz.height, seed, eggs});
+        pixels += uint64_t(sz.width) * sz.height;
+        largest = std::max(largest, uint64_t(sz.width) * sz.height);
+      }
+
+  uint64_t bytes = 0;
+  for (const Variant& v : variants)
+    bytes += ImageWriter::fileSize(opt.Format, v.Width, v.Height);
+
+  std::printf("== OfflineRender  (%zu images, %s, bands of %d rows x %u)\n", variants.size(),
+              opt.Format == ImageFormat::PNG ? "png" : "ppm", opt.BandHeight, opt.Bands);
+  std::printf("%-10s %8s %10s %10s %10s %14s\n", "mode", "images", "seconds", "images/s", "MB/s", "peak RSS(MB)");
+
+  std::atomic<uint32_t> failures{0};
+  const char* modes[] = { "serial", "pipelined" };
+  for (bool pipelined : { false, true })
+  {
+    const char* mode = modes[pipelined];
+    const double secs = renderBatch(variants, opt, pipelined, mode, failures);
+    std::printf("%-10s %8zu %10.3f %10.2f %10.1f %14.1f\n", mode, variants.size(), secs, variants.size() / secs,
+                bytes / secs / 1048576, peakResident());
+  }
+
+  // Compare the streamed images with direct rendering, then remove them
+  uint32_t verified = 0, matched = 0;
+  for (const Variant& v : variants)
+  {
+    if (uint64_t(v.Width) * v.Height <= opt.VerifyLimit)
+    {
+      ++verified;
+      matched += matches(v, opt, "serial") && matches(v, opt, "pipelined");
+    }
+    if (!opt.Keep)
+      for (const char* mode : modes)
+        std::remove(v.name(opt.Folder, mode, opt.Format).c_str());
+  }
+
+  std::printf("\nlargest image: %.1f MB as a full framebuffer; %.1f Mpixels rendered per mode\n",
+              largest * 4 / 1048576.0, pixels / 1e6);
+  std::printf("verified:      %u of %zu variants match direct rendering (%u mismatches), %u failures\n",
+              matched, variants.size(), verified - matched, unsigned(failures));
+  return failures || matched != verified ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\PanZoom.cpp
+//! \brief Measures batched pan/zoom transforms of structure-of-arrays coordinates
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::pow
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtoul
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"     //!< hw1::render::Graphics
+#include "../render/Transform.h"    //!< hw1::render::Transform
+#include "../SceneFile.h"           //!< hw1::SceneFile
+#include "../Scene.h"               //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+//! \var Sink - Prevents transformed coordinates being optimised away
+volatile int32_t Sink;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::fastest
+//! Measure the fastest of several repetitions, in milliseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double fastest(int32_t repeats, FUNC&& func)
+{
+  double best = 1e30;
+  for (int32_t n = 0; n < repeats; ++n)
+  {
+    const auto start = steady::now();
+    func();
+    best = std::min(best, std::chrono::duration<double, std::milli>(steady::now() - start).count());
+  }
+  return best;
+}
+
+//! \var MaxCount - Largest number of coordinates or scene objects
+constexpr unsigned long MaxCount = 100000000;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::parseCount
+//! Parse a count, which must be a whole number within [1, MaxCount]
+////////////////////////////////////////////////////////////////////////////////
+bool parseCount(const char* arg, uint32_t& count)
+{
+  char* end;
+  const unsigned long value = std::strtoul(arg, &end, 10);
+  if (end == arg || *end || *arg == '-' || value < 1 || value > MaxCount)
+    return false;
+  count = uint32_t(value);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Compares mapping coordinates one object at a time with mapping contiguous arrays, then
+//! pans and zooms across a large scene file
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [number of coordinates] [number of scene objects]
+//! \return int - 0 if batches match the objects mapped singly, 1 if any differed or the command line is invalid
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  uint32_t count = 4000000,
+           objects = 1000000;
+  if ((argc > 1 && !parseCount(argv[1], count)) || (argc > 2 && !parseCount(argv[2], objects)) || argc > 3)
+  {
+    std::printf("usage: PanZoom [number of coordinates] [number of scene objects]  (Each 1 to %lu)\n", MaxCount);
+    return 1;
+  }
+  bool identical = true;
+
+  // Scattered positions within a large world
+  std::mt19937 rng(3);
+  std::vector<int32_t> xs(count), ys(count), outX(count), outY(count), refX(count), refY(count);
+  for (uint32_t idx = 0; idx < count; ++idx)
+    xs[idx] = int32_t(rng() % 100000) - 20000, ys[idx] = int32_t(rng() % 100000) - 20000;
+
+  std::printf("%8s %10s %14s %14s %10s %8s\n", "format", "scale", "object(ms)", "batch(ms)", "Mcoord/s", "match");
+  for (render::Arithmetic format : { render::Arithmetic::Float, render::Arithmetic::Fixed })
+    for (float scale : { 1.0f, 0.37f, 2.5f })
+    {
+      const render::Transform view(scale, 13.25f, -7.5f, format);
+
+      // One object at a time  (Array of structures)
+      const double object = fastest(3, [&] {
+        for (uint32_t idx = 0; idx < count; ++idx)
+        {
+          const render::PointL pt = view(render::PointL(xs[idx], ys[idx]));
+          refX[idx] = pt.x, refY[idx] = pt.y;
+        }
+      });
+
+      // Contiguous arrays  (Structure of arrays)
+      const double batch = fastest(3, [&] {
+        view.mapX(xs.data(), outX.data(), count);
+        view.mapY(ys.data(), outY.data(), count);
+      });
+      Sink = outX[count/2] + refX[count/2];
+
+      const bool match = outX == refX && outY == refY;
+      identical &= match;
+      std::printf("%8s %10.2f %14.3f %14.3f %10.0f %8s\n", format == render::Arithmetic::Fixed ? "fixed" : "float", scale,
+                  object, batch, 2.0 * count / batch / 1e3, match ? "yes" : "NO");
+    }
+
+  // Pan and zoom out from 1:1 to the entire world over 30 frames
+  SceneWriter w;
+  w.Width = w.Height = std::max(2048, int32_t(std::sqrt(double(objects)) * 40));
+  for (uint32_t n = 0; n < objects; ++n)
+    if (n % 3 == 0)
+      w.tree(int32_t(rng() % uint32_t(w.Width-50)), 50 + int32_t(rng() % uint32_t(w.Height-85)));
+    else
+      w.egg(int32_t(rng() % uint32_t(w.Width-20)), int32_t(rng() % uint32_t(w.Height-30)),
+            uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+  const std::vector<uint64_t> image = w.build();
+  SceneFile file;
+  file.attach(image.data(), image.size()*8);
+
+  std::printf("\n%8s %10s %12s %12s %12s\n", "format", "objects", "frames", "mean(ms)", "worst(ms)");
+  const render::RectL viewport(0, 0, 1024, 768);
+  for (render::Arithmetic format : { render::Arithmetic::Float, render::Arithmetic::Fixed })
+  {
+    scene_t scene(file);
+    render::Framebuffer target(viewport.width(), viewport.height());
+    render::DeviceContext dc(target);
+    scene.paint(dc, viewport, true);    // Builds the index upon first use
+
+    const int32_t frames = 30;
+    const float fit = float(viewport.height()) / file.height();
+    double total = 0, worst = 0;
+    for (int32_t f = 0; f < frames; ++f)
+    {
+      const float scale = std::pow(fit, float(f) / (frames-1)),
+                  cx = file.width() * (0.25f + 0.25f * f / (frames-1)),
+                  cy = file.height() * 0.5f;
+      scene.setView(render::Transform(scale, viewport.width()/2 - scale*cx, viewport.height()/2 - scale*cy, format));
+      const double ms = fastest(1, [&] { scene.paint(dc, viewport, true); });
+      total += ms;
+      worst = std::max(worst, ms);
+    }
+    std::printf("%8s %10u %12d %12.3f %12.3f\n", format == render::Arithmetic::Fixed ? "fixed" : "float", objects, frames, total / frames, worst);
+  }
+  return identical ? 0 : 1;
+}
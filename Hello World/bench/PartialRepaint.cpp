@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\PartialRepaint.cpp
+//! \brief Replays invalidation rectangles to measure damage-tracked repainting
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Trace - Named sequence of invalidated rectangles
+////////////////////////////////////////////////////////////////////////////////
+struct Trace
+{
+  const char*                 Name;
+  std::vector<render::RectL>  Rects;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::makeTraces
+//! Generate invalidation traces typical of window interaction
+////////////////////////////////////////////////////////////////////////////////
+std::vector<Trace> makeTraces(const render::RectL& client)
+{
+  std::vector<Trace> traces;
+  std::mt19937 rng(7);
+
+  // 20-pixel horizontal strips (eg. scrolling or a tooltip sweeping down)
+  Trace rows{"20px rows", {}};
+  for (int32_t y = 0; y < client.bottom; y += 20)
+    rows.Rects.emplace_back(client.left, y, client.right, y+20);
+  traces.push_back(rows);
+
+  // 20-pixel vertical strips (eg. dragging a window across)
+  Trace cols{"20px columns", {}};
+  for (int32_t x = 0; x < client.right; x += 20)
+    cols.Rects.emplace_back(x, client.top, x+20, client.bottom);
+  traces.push_back(cols);
+
+  // Random 64x64 blocks (eg. caret, hover highlights)
+  Trace blocks{"64x64 blocks", {}};
+  for (int32_t n = 0; n < 64; ++n)
+  {
+    const int32_t x = int32_t(rng() % (client.width()-64)),
+                  y = int32_t(rng() % (client.height()-64));
+    blocks.Rects.emplace_back(x, y, x+64, y+64);
+  }
+  traces.push_back(blocks);
+
+  // Entire client area
+  traces.push_back(Trace{"full", {client}});
+  return traces;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Replays each trace with whole-window and damage-tracked repainting
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [iterations]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  using clock = std::chrono::steady_clock;
+  const int32_t iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+
+  render::Framebuffer target(640, 480);
+  render::DeviceContext dc(target);
+  Scene<render::Graphics> scene;
+
+  std::printf("%-14s %8s %12s %12s %8s %10s %10s\n", "trace", "rects", "full(us)", "partial(us)", "speedup", "drawn", "culled");
+  for (const Trace& trace : makeTraces(target.bounds()))
+  {
+    // Whole-window: every invalidation repaints the entire scene
+    auto start = clock::now();
+    for (int32_t n = 0; n < iterations; ++n)
+      for (size_t r = 0; r < trace.Rects.size(); ++r)
+      {
+        dc.setClip(target.bounds());
+        scene.paint(dc, target.bounds(), true);
+      }
+    const double full = std::chrono::duration<double, std::micro>(clock::now() - start).count() / iterations;
+
+    // Damage-tracked: clip to the invalidated rectangle and cull objects outside it
+    uint64_t drawn = 0, culled = 0;
+    start = clock::now();
+    for (int32_t n = 0; n < iterations; ++n)
+      for (const render::RectL& rc : trace.Rects)
+      {
+        dc.setClip(rc);
+        scene.paint(dc, rc, true);
+        drawn += scene.stats().Drawn;
+        culled += scene.stats().Culled;
+      }
+    const double partial = std::chrono::duration<double, std::micro>(clock::now() - start).count() / iterations;
+
+    std::printf("%-14s %8zu %12.1f %12.1f %7.1fx %10.1f %10.1f\n", trace.Name, trace.Rects.size(), full, partial, full / partial,
+                double(drawn) / iterations, double(culled) / iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Profile.cpp
+//! \brief Profiles the draw functions of the scene and writes a Chrome trace
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef HW1_PROFILE
+  #define HW1_PROFILE
+#endif
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Paints the scene repeatedly, then prints per-function histograms and writes a trace
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [frames] [trace file]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  using namespace hw1;
+
+  const int32_t frames = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const char*   path   = argc > 2 ? argv[2] : "paint_trace.json";
+
+  render::Framebuffer target(640, 480);
+  render::DeviceContext dc(target);
+  Scene<render::Graphics> scene;
+
+  for (int32_t n = 0; n < frames; ++n)
+  {
+    scene.paint(dc, target.bounds(), true);
+
+    // Drain periodically so the per-thread ring never fills
+    if (n % 100 == 99)
+      profile::Profiler::instance().collect();
+  }
+
+  std::printf("%s", profile::Profiler::instance().report().c_str());
+  if (!profile::Profiler::instance().writeTrace(path))
+  {
+    std::printf("unable to write %s\n", path);
+    return 1;
+  }
+  std::printf("trace written to %s\n", path);
+  return 0;
+}
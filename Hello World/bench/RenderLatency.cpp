@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\RenderLatency.cpp
+//! \brief Simulates the UI message loop with synchronous and off-thread rendering
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::sort
+#include <atomic>             //!< std::atomic
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::sqrt
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtoul
+#include <cstring>            //!< std::memcpy
+#include <random>             //!< std::mt19937
+#include <thread>             //!< std::this_thread
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"       //!< hw1::render::Graphics
+#include "../render/RenderThread.h"   //!< hw1::render::RenderThread
+#include "../SceneFile.h"             //!< hw1::SceneFile
+#include "../Scene.h"                 //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+//! \struct LoopStats - Measurements of one simulated UI loop
+struct LoopStats
+{
+  std::vector<double>  Latency,     //!< Milliseconds from each input to presentation of a frame reflecting it
+                       Blocking;    //!< Milliseconds spent in each message handler
+  uint64_t             Frames = 0;  //!< Frames presented
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::millis
+//! Get the time between two points, in milliseconds
+////////////////////////////////////////////////////////////////////////////////
+double millis(steady::time_point from, steady::time_point to)
+{
+  return std::chrono::duration<double, std::milli>(to - from).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::percentile
+//! Get a percentile of a set of measurements
+////////////////////////////////////////////////////////////////////////////////
+double percentile(std::vector<double> v, double p)
+{
+  if (v.empty())
+    return 0;
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size()-1, size_t(p * (v.size()-1) + 0.5))];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::present
+//! Copy a frame to the simulated window surface  (Stands in for the GDI blit)
+////////////////////////////////////////////////////////////////////////////////
+void present(const render::Framebuffer& frame, render::Framebuffer& window)
+{
+  for (int32_t y = 0; y < frame.height(); ++y)
+    std::memcpy(window.row(y), frame.row(y), frame.width() * sizeof(uint32_t));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::simulate
+//! Run the UI loop, delivering a pan input at a fixed interval
+//!
+//! \param[in] threaded - Whether frames are rendered on a render thread
+//! \param[in] inputs - Number of inputs
+//! \param[in] interval - Time between inputs
+//! \param[in] draw - Draws a frame panned by an offset
+////////////////////////////////////////////////////////////////////////////////
+template <typename DRAW>
+LoopStats simulate(bool threaded, int32_t inputs, steady::duration interval, DRAW&& draw)
+{
+  const int32_t width = 1024, height = 768;
+  render::Framebuffer window(width, height), frame(width, height);
+  std::atomic<int32_t> pan{0};
+  std::vector<steady::time_point> arrivals;     // Arrival time of each input, by sequence number - 1
+  LoopStats stats;
+
+  // Idle until sized: a sized render thread draws without a request, so it would race the UI thread's draws
+  render::RenderThread renderer(0, 0, [&](render::Framebuffer& target) { draw(target, pan.load()); });
+  if (threaded)
+    renderer.resize(width, height);
+  size_t pending = 0;                           // First input not yet reflected by a presented frame
+
+  const steady::time_point start = steady::now();
+  for (int32_t n = 0; n < inputs || pending < arrivals.size(); )
+  {
+    // [INPUT] Pan the view, then request a repaint
+    const steady::time_point due = start + n * interval;
+    if (n < inputs && steady::now() >= due)
+    {
+      const steady::time_point begin = steady::now();
+      arrivals.push_back(due);
+      pan.store(n++ * 4);
+      if (threaded)
+        renderer.request();
+      else
+      {
+        // [WM_PAINT] Draw synchronously
+        draw(frame, pan.load());
+        present(frame, window);
+        for (++stats.Frames; pending < arrivals.size(); ++pending)
+          stats.Latency.push_back(millis(arrivals[pending], steady::now()));
+      }
+      stats.Blocking.push_back(millis(begin, steady::now()));
+      continue;
+    }
+
+    // [WM_PAINT] Present the newest complete frame
+    if (threaded && renderer.present())
+    {
+      const steady::time_point begin = steady::now();
+      present(renderer.frame().Pixels, window);
+      for (++stats.Frames; pending < renderer.frame().Sequence; ++pending)
+        stats.Latency.push_back(millis(arrivals[pending], steady::now()));
+      stats.Blocking.push_back(millis(begin, steady::now()));
+      continue;
+    }
+
+    // Idle until the next message
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Compares input-to-present latency and UI-thread blocking with rendering on the UI thread
+//! and on a render thread
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [number of scene objects] [number of inputs] [input interval in ms]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const uint32_t objects = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 100000;
+  const int32_t  inputs = argc > 2 ? std::atoi(argv[2]) : 120,
+                 interval = argc > 3 ? std::atoi(argv[3]) : 8;
+
+  // A large world viewed in full detail, so that each frame is expensive
+  std::mt19937 rng(5);
+  SceneWriter w;
+  w.Width = w.Height = std::max(2048, int32_t(std::sqrt(double(objects)) * 40));
+  for (uint32_t n = 0; n < objects; ++n)
+    if (n % 3 == 0)
+      w.tree(int32_t(rng() % uint32_t(w.Width-50)), 50 + int32_t(rng() % uint32_t(w.Height-85)));
+    else
+      w.egg(int32_t(rng() % uint32_t(w.Width-20)), int32_t(rng() % uint32_t(w.Height-30)),
+            uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+  const std::vector<uint64_t> image = w.build();
+  SceneFile file;
+  file.attach(image.data(), image.size()*8);
+
+  std::printf("%d inputs every %d ms, %u objects\n", inputs, interval, objects);
+  std::printf("%10s %8s %12s %12s %12s %14s %14s\n", "mode", "frames", "latency p50", "latency p95", "latency max", "blocking mean", "blocking max");
+  for (bool threaded : { false, true })
+  {
+    scene_t scene(file);
+    scene.setDetail(scene_t::LevelOfDetail{0.0f, 0.0f});
+    const float scale = 0.25f;
+    auto draw = [&](render::Framebuffer& target, int32_t pan) {
+      render::DeviceContext dc(target);
+      scene.setView(render::Transform(scale, -float(pan), 0.0f));
+      scene.paint(dc, target.bounds(), true);
+    };
+
+    const LoopStats stats = simulate(threaded, inputs, std::chrono::milliseconds(interval), draw);
+    double total = 0;
+    for (double b : stats.Blocking)
+      total += b;
+    std::printf("%10s %8llu %12.2f %12.2f %12.2f %14.3f %14.3f\n", threaded ? "threaded" : "ui thread", (unsigned long long)stats.Frames,
+                percentile(stats.Latency, 0.5), percentile(stats.Latency, 0.95), percentile(stats.Latency, 1.0),
+                total / std::max<size_t>(1, stats.Blocking.size()), percentile(stats.Blocking, 1.0));
+  }
+  return 0;
+}
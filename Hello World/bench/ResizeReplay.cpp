@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\ResizeReplay.cpp
+//! \brief Replays window resize traces and compares frames rendered with frames requested
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::min
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cmath>              //!< std::sqrt
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtoul
+#include <fstream>            //!< std::ifstream
+#include <random>             //!< std::mt19937
+#include <sstream>            //!< std::istringstream
+#include <string>             //!< std::string
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"          //!< hw1::render::Graphics
+#include "../render/ResizeCoalescer.h"   //!< hw1::render::ResizeCoalescer
+#include "../SceneFile.h"                //!< hw1::SceneFile
+#include "../Scene.h"                    //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+using render::ResizeCoalescer;
+
+//! \struct Event - Recorded window message
+struct Event
+{
+  //! \enum Kind - Message kind
+  enum Kind { Size, Paint, Input };
+
+  int32_t  Time;            //!< Milliseconds since the start of the trace
+  Kind     Type;            //!< Message kind
+  int32_t  Width = 0,       //!< New client width  (WM_SIZE only)
+           Height = 0;      //!< New client height  (WM_SIZE only)
+};
+
+//! \struct Trace - Named sequence of window messages
+struct Trace
+{
+  std::string         Name;     //!< Trace name
+  std::vector<Event>  Events;   //!< Messages, in time order
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::load
+//! Load a trace file
+//!
+//! Each line holds a time in milliseconds followed by 'size <width> <height>', 'paint' or
+//! 'input'; blank lines and lines beginning '#' are ignored.
+////////////////////////////////////////////////////////////////////////////////
+bool load(const char* path, Trace& trace)
+{
+  std::ifstream in(path);
+  if (!in)
+    return false;
+
+  trace.Name = path;
+  for (std::string line; std::getline(in, line); )
+  {
+    std::istringstream fields(line);
+    std::string kind;
+    Event e{};
+    if (line.empty() || line[0] == '#' || !(fields >> e.Time >> kind))
+      continue;
+    if (kind == "size" && fields >> e.Width >> e.Height)
+      e.Type = Event::Size;
+    else if (kind == "paint")
+      e.Type = Event::Paint;
+    else if (kind == "input")
+      e.Type = Event::Input;
+    else
+      return false;
+    trace.Events.push_back(e);
+  }
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::drag
+//! Synthesize a trace of the user dragging a window border, as recorded on Windows
+//!
+//! The modal sizing loop delivers WM_SIZE at the mouse rate, each followed by WM_PAINT
+//! because the class redraws upon resize.
+//!
+//! \param[in] name - Trace name
+//! \param[in] duration - Length of the drag, in milliseconds
+//! \param[in] rate - Milliseconds between mouse moves
+//! \param[in] pause - Milliseconds the mouse rests half-way through  (Zero for none)
+//! \param[in] input - Milliseconds between content changes during the drag  (Zero for none)
+////////////////////////////////////////////////////////////////////////////////
+Trace drag(const char* name, int32_t duration, int32_t rate, int32_t pause, int32_t input)
+{
+  Trace trace{name, {}};
+  trace.Events.push_back(Event{0, Event::Paint});
+
+  std::mt19937 rng(11);
+  int32_t t = 50, next = input;
+  for (int32_t elapsed = 0; elapsed < duration; elapsed += rate, t += rate)
+  {
+    if (pause && elapsed >= duration/2 && elapsed < duration/2 + rate)
+      t += pause;
+
+    // Grow from 640x480 to roughly 1280x960, with the jitter of a hand-held mouse
+    const int32_t width = 640 + 640*elapsed/duration + int32_t(rng() % 3),
+                  height = 480 + 480*elapsed/duration + int32_t(rng() % 3);
+    trace.Events.push_back(Event{t, Event::Size, width, height});
+    trace.Events.push_back(Event{t, Event::Paint});
+    for (; input && next <= elapsed; next += input)
+      trace.Events.push_back(Event{t, Event::Input});
+  }
+  return trace;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::maximize
+//! Synthesize a trace of the window being maximized and restored
+////////////////////////////////////////////////////////////////////////////////
+Trace maximize()
+{
+  return Trace{"maximize", { Event{0, Event::Paint},
+                             Event{500, Event::Size, 1920, 1017}, Event{500, Event::Paint},
+                             Event{1500, Event::Size, 640, 480}, Event{1500, Event::Paint} }};
+}
+
+//! \struct ReplayStats - Result of replaying a trace
+struct ReplayStats
+{
+  int32_t  Requested = 0,    //!< Messages that would each have re-rendered  (WM_SIZE, WM_PAINT and input)
+           Rendered = 0,     //!< Frames rendered
+           Stretched = 0;    //!< Presents of a frame scaled to a different size
+  double   RenderMs = 0,     //!< Time spent rendering
+           PresentMs = 0,    //!< Time spent presenting
+           MinGapMs = 1e9;   //!< Shortest time between the start of consecutive renders
+  bool     Correct = false;  //!< Whether the final frame matches a direct render at the final size
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::replay
+//! Replay a trace in simulated time, rendering real frames
+//!
+//! \param[in] trace - Trace to replay
+//! \param[in] coalesce - Whether renders are paced by a ResizeCoalescer  (Otherwise every message re-renders)
+//! \param[in] draw - Draws a frame
+////////////////////////////////////////////////////////////////////////////////
+template <typename DRAW>
+ReplayStats replay(const Trace& trace, bool coalesce, DRAW&& draw)
+{
+  const steady::time_point origin = steady::time_point() + std::chrono::hours(1);
+  ResizeCoalescer pacing(640, 480);
+  render::Framebuffer frame, window(640, 480), reference;
+  ReplayStats stats;
+  int32_t lastRender = -1;
+
+  auto now = [&](int32_t ms) { return origin + std::chrono::milliseconds(ms); };
+  auto timed = [](double& total, auto&& func) {
+    const steady::time_point start = steady::now();
+    func();
+    total += std::chrono::duration<double, std::milli>(steady::now() - start).count();
+  };
+  auto render = [&](int32_t t) {
+    if (lastRender >= 0)
+      stats.MinGapMs = std::min(stats.MinGapMs, double(t - lastRender));
+    lastRender = t;
+    ++stats.Rendered;
+    pacing.rendering(now(t));
+    frame.resize(pacing.width(), pacing.height());
+    timed(stats.RenderMs, [&] { draw(frame); });
+  };
+  auto present = [&] {
+    timed(stats.PresentMs, [&] {
+      if (frame.width() == window.width() && frame.height() == window.height())
+        window = frame;
+      else
+      {
+        window.stretch(frame);
+        ++stats.Stretched;
+      }
+    });
+  };
+
+  // Advance in the render thread's wake interval, delivering messages as they fall due
+  const int32_t end = trace.Events.empty() ? 0 : trace.Events.back().Time;
+  size_t next = 0;
+  for (int32_t t = 0; next < trace.Events.size() || (coalesce && pacing.pending()); ++t)
+  {
+    for (; next < trace.Events.size() && trace.Events[next].Time <= t; ++next)
+    {
+      const Event& e = trace.Events[next];
+      ++stats.Requested;
+      if (e.Type == Event::Size)
+      {
+        pacing.resize(e.Width, e.Height, now(t));
+        window.resize(e.Width, e.Height);
+      }
+      else if (e.Type == Event::Input)
+        pacing.invalidate();
+
+      if (!coalesce)
+        render(t);
+      if (e.Type == Event::Paint)
+        present();
+    }
+
+    // Render thread draws once due; the completed frame invalidates the window
+    if (coalesce && pacing.ready(now(t)))
+    {
+      render(t);
+      present();
+    }
+    if (t > end + 10000)
+      break;
+  }
+
+  reference.resize(window.width(), window.height());
+  draw(reference);
+  stats.Correct = window == reference;
+  return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Replays resize traces with every message re-rendering the scene, as with a class that
+//! redraws upon resize, and with renders coalesced while the size settles
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [number of scene objects] [trace files...]  (Synthesized traces are used when none are given)
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const uint32_t objects = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 2000;
+
+  std::vector<Trace> traces;
+  for (int32_t arg = 2; arg < argc; ++arg)
+  {
+    Trace trace;
+    if (!load(argv[arg], trace))
+    {
+      std::fprintf(stderr, "Unable to read trace '%s'\n", argv[arg]);
+      return 1;
+    }
+    traces.push_back(std::move(trace));
+  }
+  if (traces.empty())
+  {
+    traces.push_back(drag("drag 125Hz", 2000, 8, 0, 0));
+    traces.push_back(drag("drag 1kHz", 2000, 1, 0, 0));
+    traces.push_back(drag("drag+pause", 2000, 8, 300, 0));
+    traces.push_back(drag("drag+input", 2000, 8, 0, 40));
+    traces.push_back(maximize());
+  }
+
+  // Scene spanning the largest window
+  std::mt19937 rng(5);
+  SceneWriter w;
+  w.Width = 1920;
+  w.Height = 1080;
+  for (uint32_t n = 0; n < objects; ++n)
+    if (n % 3 == 0)
+      w.tree(int32_t(rng() % uint32_t(w.Width-50)), 50 + int32_t(rng() % uint32_t(w.Height-85)));
+    else
+      w.egg(int32_t(rng() % uint32_t(w.Width-20)), int32_t(rng() % uint32_t(w.Height-30)),
+            uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+  const std::vector<uint64_t> image = w.build();
+  SceneFile file;
+  file.attach(image.data(), image.size()*8);
+  scene_t scene(file);
+  auto draw = [&](render::Framebuffer& target) {
+    render::DeviceContext dc(target);
+    scene.paint(dc, target.bounds(), true);
+  };
+
+  std::printf("%u objects\n", objects);
+  std::printf("%-12s %10s %9s %9s %9s %11s %11s %11s %8s\n", "trace", "mode", "requested", "rendered", "stretched",
+              "render ms", "present ms", "min gap ms", "correct");
+  for (const Trace& trace : traces)
+    for (bool coalesce : { false, true })
+    {
+      const ReplayStats stats = replay(trace, coalesce, draw);
+      std::printf("%-12s %10s %9d %9d %9d %11.1f %11.1f %11.1f %8s\n", trace.Name.c_str(), coalesce ? "coalesced" : "immediate",
+                  stats.Requested, stats.Rendered, stats.Stretched, stats.RenderMs, stats.PresentMs,
+                  stats.Rendered > 1 ? stats.MinGapMs : 0.0, stats.Correct ? "yes" : "NO");
+    }
+  return 0;
+}
@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\ResourceChurn.cpp
+//! \brief Counts pen, brush and font creations during steady-state repainting
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Paints the scene repeatedly and reports object creations per frame
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [frames]
+//! \return int - 0 if steady-state frames created no objects, otherwise 1
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  using namespace hw1;
+  using clock = std::chrono::steady_clock;
+  const int32_t frames = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+  render::Framebuffer target(640, 480);
+  render::DeviceContext dc(target);
+  Scene<render::Graphics> scene;
+
+  // First paint populates the pool
+  const uint64_t initial = render::objectsCreated();
+  scene.paint(dc, target.bounds(), true);
+  const uint64_t warmup = render::objectsCreated() - initial;
+
+  // Steady state should select pooled objects only
+  const uint64_t before = render::objectsCreated();
+  int32_t lastCreation = 0;
+  const auto start = clock::now();
+  for (int32_t n = 1; n <= frames; ++n)
+  {
+    const uint64_t count = render::objectsCreated();
+    scene.paint(dc, target.bounds(), true);
+    if (render::objectsCreated() != count)
+      lastCreation = n;
+  }
+  const double elapsed = std::chrono::duration<double, std::micro>(clock::now() - start).count();
+  const uint64_t steady = render::objectsCreated() - before;
+
+  const PoolStats& stats = scene.resources().stats();
+  std::printf("first frame:   %llu objects created\n", (unsigned long long)warmup);
+  std::printf("steady state:  %llu objects created over %d frames (%.4f/frame), %.2f us/frame\n",
+              (unsigned long long)steady, frames, double(steady) / frames, elapsed / frames);
+  std::printf("last creation: frame %d  (%d subsequent frames created nothing)\n", lastCreation, frames - lastCreation);
+  std::printf("pool:          size=%zu hits=%llu misses=%llu creations=%llu evictions=%llu hit-rate=%.2f%%\n",
+              scene.resources().size(), (unsigned long long)stats.Hits, (unsigned long long)stats.Misses,
+              (unsigned long long)stats.Creations, (unsigned long long)stats.Evictions,
+              100.0 * stats.Hits / double(stats.Hits + stats.Misses));
+  return steady ? 1 : 0;
+}
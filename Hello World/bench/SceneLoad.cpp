@@ -0,0 +1,302 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\SceneLoad.cpp
+//! \brief Compares loading scenes from memory-mapped binary files and from text
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::strtol
+#include <cstring>            //!< std::strncmp
+#include <filesystem>         //!< std::filesystem
+#include <random>             //!< std::mt19937
+#include <string>             //!< std::string
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../SceneFile.h"         //!< hw1::SceneFile
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+using steady = std::chrono::steady_clock;
+
+//! \var Sink - Prevents reads of mapped pages being optimised away
+volatile uint64_t Sink;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::millis
+//! Get the time elapsed since a point, in milliseconds
+////////////////////////////////////////////////////////////////////////////////
+double millis(steady::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(steady::now() - start).count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::river
+//! Add the river of the built-in scene
+////////////////////////////////////////////////////////////////////////////////
+void river(SceneWriter& w, int32_t dx, int32_t dy)
+{
+  int32_t xy[2 * sizeof(scene_t::River::Points) / sizeof(scene_t::River::Points[0])];
+  for (size_t v = 0; v < sizeof(xy)/sizeof(xy[0])/2; ++v)
+  {
+    xy[2*v] = scene_t::River::Points[v].x + dx;
+    xy[2*v+1] = scene_t::River::Points[v].y + dy;
+  }
+  w.polygon(xy, uint32_t(sizeof(xy)/sizeof(xy[0])/2));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::generate
+//! Generate a scene of rivers, signs, bunnies, trees and eggs
+////////////////////////////////////////////////////////////////////////////////
+SceneWriter generate(uint32_t objects, int32_t size)
+{
+  std::mt19937 rng(5);
+  SceneWriter w;
+  w.Width = w.Height = size;
+
+  // Copies of the built-in landscape across the extent, then scattered trees and eggs
+  for (int32_t y = 0; y + 480 <= size && objects > 3; y += 480)
+    for (int32_t x = 0; x + 640 <= size && objects > 3; x += 640, objects -= 3)
+    {
+      river(w, x, y);
+      w.sign(x+80, y+80);
+      w.bunny(x+320, y+340);
+    }
+  for (uint32_t n = 0; n < objects; ++n)
+    if (n % 3 == 0)
+      w.tree(int32_t(rng() % uint32_t(size-50)), 50 + int32_t(rng() % uint32_t(size-85)));
+    else
+      w.egg(int32_t(rng() % uint32_t(size-20)), int32_t(rng() % uint32_t(size-30)),
+            uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11));
+  return w;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::saveText
+//! Write a scene in the text format  (One object per line)
+////////////////////////////////////////////////////////////////////////////////
+bool saveText(const SceneWriter& w, const char* path)
+{
+  FILE* out = std::fopen(path, "w");
+  if (!out)
+    return false;
+
+  std::fprintf(out, "scene %d %d\n", w.Width, w.Height);
+  const auto& first = w.Columns32[SceneFile::PolygonFirst];
+  const auto& verts = w.Columns32[SceneFile::Vertices];
+  for (size_t p = 0; p+1 < first.size(); ++p)
+  {
+    std::fprintf(out, "polygon %d", first[p+1] - first[p]);
+    for (int32_t v = first[p]; v < first[p+1]; ++v)
+      std::fprintf(out, " %d %d", verts[2*v], verts[2*v+1]);
+    std::fprintf(out, "\n");
+  }
+  for (size_t i = 0; i < w.Columns32[SceneFile::SignX].size(); ++i)
+    std::fprintf(out, "sign %d %d\n", w.Columns32[SceneFile::SignX][i], w.Columns32[SceneFile::SignY][i]);
+  for (size_t i = 0; i < w.Columns32[SceneFile::BunnyX].size(); ++i)
+    std::fprintf(out, "bunny %d %d\n", w.Columns32[SceneFile::BunnyX][i], w.Columns32[SceneFile::BunnyY][i]);
+  for (size_t i = 0; i < w.Columns32[SceneFile::TreeX].size(); ++i)
+    std::fprintf(out, "tree %d %d\n", w.Columns32[SceneFile::TreeX][i], w.Columns32[SceneFile::TreeY][i]);
+  for (size_t i = 0; i < w.Columns32[SceneFile::EggX].size(); ++i)
+    std::fprintf(out, "egg %d %d %u %u %u %u\n", w.Columns32[SceneFile::EggX][i], w.Columns32[SceneFile::EggY][i],
+                 w.Columns8[SceneFile::EggHatch][i], w.Columns8[SceneFile::EggFill][i],
+                 w.Columns8[SceneFile::EggOutline][i], w.Columns8[SceneFile::EggBack][i]);
+  return std::fclose(out) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::loadText
+//! Read and parse a scene in the text format into the binary layout
+////////////////////////////////////////////////////////////////////////////////
+std::vector<uint64_t> loadText(const char* path)
+{
+  std::string text;
+  if (FILE* in = std::fopen(path, "rb"))
+  {
+    char block[65536];
+    for (size_t n; (n = std::fread(block, 1, sizeof(block), in)) != 0; )
+      text.append(block, n);
+    std::fclose(in);
+  }
+
+  SceneWriter w;
+  std::vector<int32_t> xy;
+  for (const char* pos = text.c_str(); *pos; )
+  {
+    char* end;
+    auto next = [&] { const long v = std::strtol(pos, &end, 10); pos = end; return int32_t(v); };
+    if (!std::strncmp(pos, "tree", 4))         { pos += 4; const int32_t x = next(); w.tree(x, next()); }
+    else if (!std::strncmp(pos, "egg", 3))     { pos += 3; const int32_t x = next(), y = next(), h = next(), f = next(), o = next();
+                                                 w.egg(x, y, uint8_t(h), uint8_t(f), uint8_t(o), uint8_t(next())); }
+    else if (!std::strncmp(pos, "sign", 4))    { pos += 4; const int32_t x = next(); w.sign(x, next()); }
+    else if (!std::strncmp(pos, "bunny", 5))   { pos += 5; const int32_t x = next(); w.bunny(x, next()); }
+    else if (!std::strncmp(pos, "scene", 5))   { pos += 5; w.Width = next(); w.Height = next(); }
+    else if (!std::strncmp(pos, "polygon", 7))
+    {
+      pos += 7;
+      xy.resize(size_t(2 * next()));
+      for (auto& v : xy)
+        v = next();
+      w.polygon(xy.data(), uint32_t(xy.size() / 2));
+    }
+    while (*pos && *pos++ != '\n')
+      ;
+  }
+  return w.build();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::paintFile
+//! Paint a viewport of a scene file
+////////////////////////////////////////////////////////////////////////////////
+render::Framebuffer paintFile(const SceneFile& file, const render::RectL& viewport, scene_t::Layer layers = scene_t::Layer::All)
+{
+  render::Framebuffer target(viewport.width(), viewport.height());
+  render::DeviceContext dc(target);
+  scene_t scene(file);
+  scene.paint(dc, viewport, true, layers);
+  return target;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Generates scenes of increasing size, then loads each from binary and text files
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [largest object count] [directory for generated files  (Created if missing, temporary by default)]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  namespace fs = std::filesystem;
+  const uint32_t largest = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 4000000;
+  std::error_code err;
+  const fs::path folder = argc > 2 ? fs::path(argv[2]) : fs::temp_directory_path(err);
+  if (fs::create_directories(folder, err), err)
+  {
+    std::printf("unable to create %s: %s\n", folder.string().c_str(), err.message().c_str());
+    return 1;
+  }
+  bool identical = true;
+
+  // Sizes grow twentyfold from 10,000 objects, ending at exactly the largest requested
+  std::vector<uint32_t> sizes;
+  for (uint32_t objects = 10000; objects < largest; objects *= 20)
+    sizes.push_back(objects);
+  sizes.push_back(largest);
+
+  // The built-in layout expressed as a file draws the same static layer
+  {
+    SceneWriter w;
+    river(w, 0, 0);
+    w.sign(80, 80);
+    for (auto pt : { render::PointL(450,125), render::PointL(350,130), render::PointL(425,155), render::PointL(360,180), render::PointL(410,210) })
+      w.tree(pt.x, pt.y);
+    w.bunny(320, 340);
+    const std::vector<uint64_t> image = w.build();
+
+    SceneFile file;
+    scene_t builtin;
+    render::Framebuffer expected(640, 480);
+    render::DeviceContext dc(expected);
+    builtin.paint(dc, expected.bounds(), true, scene_t::Layer::Static);
+    const bool match = file.attach(image.data(), image.size()*8) && paintFile(file, expected.bounds(), scene_t::Layer::Static) == expected;
+    identical &= match;
+    std::printf("built-in layout as a scene file: %s\n", match ? "identical" : "DIFFERENT");
+  }
+
+  // A comb of the largest polygon a scene file permits crosses each scanline more often than the rasterizer's stack holds
+  {
+    const int32_t teeth = (SceneFile::MaxVertices - 2) / 4;
+    std::vector<int32_t> xy;
+    for (int32_t t = 0; t < teeth; ++t)
+      xy.insert(xy.end(), { 4*t, 10,  4*t+2, 10,  4*t+2, 100,  4*t+4, 100 });
+    xy.insert(xy.end(), { 4*teeth, 110,  0, 110 });
+
+    SceneWriter w;
+    w.polygon(xy.data(), uint32_t(xy.size() / 2));
+    const std::vector<uint64_t> image = w.build();
+    SceneFile file;
+    const bool loaded = file.attach(image.data(), image.size()*8);
+
+    // Scan convert the polygon read from the file, then test every pixel centre against it
+    const render::POINT* pts = reinterpret_cast<const render::POINT*>(file.column<int32_t>(SceneFile::Vertices));
+    const int32_t count = int32_t(file.vertices());
+    std::vector<render::PointF> verts;
+    for (int32_t v = 0; v < count; ++v)
+      verts.push_back(render::PointF{ float(pts[v].x), float(pts[v].y) });
+    const render::RectL area(0, 0, 4*teeth + 8, 120);
+    std::vector<uint8_t> filled(area.width() * area.height());
+    render::Rasterizer::polygon(verts.data(), count, area, [&](int32_t y, int32_t x0, int32_t x1) {
+      for (int32_t x = x0; x < x1; ++x)
+        filled[y * area.width() + x] ^= 1;
+    });
+    int32_t wrong = 0;
+    for (int32_t y = 0; y < area.height(); ++y)
+      for (int32_t x = 0; x < area.width(); ++x)
+        wrong += filled[y * area.width() + x] != uint8_t(render::insidePolygon(pts, count, render::PointL(x,y)));
+    identical &= loaded && !wrong;
+    std::printf("%d-vertex comb (%d crossings per scanline): %s\n", count, 2*teeth, loaded && !wrong ? "filled exactly" : "WRONG PIXELS");
+  }
+
+  std::printf("%10s %12s %12s %10s %12s %12s %10s %8s\n", "objects", "binary", "text", "open(ms)", "touch(ms)", "parse(ms)", "speedup", "match");
+  for (const uint32_t objects : sizes)
+  {
+    const int32_t size = objects >= 1000000 ? 16384 : 4096;
+    const std::string binPath = (folder / ("scene_" + std::to_string(objects) + ".hw1s")).string(),
+                      txtPath = (folder / ("scene_" + std::to_string(objects) + ".txt")).string();
+    {
+      const SceneWriter w = generate(objects, size);
+      if (!w.save(binPath.c_str()) || !saveText(w, txtPath.c_str()))
+      {
+        std::printf("unable to write %s\n", folder.string().c_str());
+        return 1;
+      }
+    }
+
+    // Map the binary file  (Validates the header only)
+    auto start = steady::now();
+    SceneFile mapped;
+    if (!mapped.open(binPath.c_str()))
+    {
+      std::printf("unable to open %s\n", binPath.c_str());
+      return 1;
+    }
+    const double opened = millis(start);
+
+    // Read every byte once, faulting in each page
+    start = steady::now();
+    uint64_t sum = 0;
+    for (size_t idx = 0; idx < mapped.size(); idx += 64)
+      sum += mapped.data()[idx];
+    const double touched = millis(start);
+    Sink = sum;
+
+    // Parse the text file into the same layout
+    start = steady::now();
+    const std::vector<uint64_t> image = loadText(txtPath.c_str());
+    SceneFile parsed;
+    parsed.attach(image.data(), image.size()*8);
+    const double parsing = millis(start);
+
+    // Both draw the same pixels
+    const render::RectL viewport(0, 0, 1024, 768);
+    const bool match = mapped.size() == parsed.size() && std::equal(mapped.data(), mapped.data() + mapped.size(), parsed.data())
+                    && paintFile(mapped, viewport) == paintFile(parsed, viewport);
+    identical &= match;
+
+    FILE* txt = std::fopen(txtPath.c_str(), "rb");
+    std::fseek(txt, 0, SEEK_END);
+    const long txtBytes = std::ftell(txt);
+    std::fclose(txt);
+
+    std::printf("%10u %11.1fM %11.1fM %10.3f %12.3f %12.1f %9.0fx %8s\n", objects, mapped.size() / 1e6, txtBytes / 1e6, opened,
+                touched, parsing, parsing / (opened + touched), match ? "yes" : "NO");
+    std::remove(binPath.c_str());
+    std::remove(txtPath.c_str());
+  }
+  return identical ? 0 : 1;
+}
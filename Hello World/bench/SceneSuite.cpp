@@ -0,0 +1,340 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\SceneSuite.cpp
+//! \brief Headless benchmark suite sweeping the scene over resolution, instances and threads
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::sort
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atof
+#include <cstring>            //!< std::strcmp
+#include <map>                //!< std::map
+#include <memory>             //!< std::unique_ptr
+#include <random>             //!< std::mt19937
+#include <sstream>            //!< std::istringstream
+#include <string>             //!< std::string
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"       //!< hw1::render::Graphics
+#include "../render/TileRenderer.h"   //!< hw1::render::TileRenderer
+#include "../Scene.h"                 //!< hw1::Scene
+
+using namespace hw1;
+using scene_t = Scene<render::Graphics>;
+
+//! \var ChunkSize - Maximum instances submitted per batch  (Bounds the cost of state-sorting dense batches)
+static constexpr size_t ChunkSize = 4096;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Config - Single point of the sweep
+////////////////////////////////////////////////////////////////////////////////
+struct Config
+{
+  int32_t   Width,
+            Height;
+  uint32_t  Eggs,         //!< Eggs scattered in addition to the scene's own row
+            Trees;        //!< Trees scattered in addition to the scene's own five
+  unsigned  Threads;      //!< Render threads  (1 = draw directly without tiling)
+
+  std::string key() const
+  {
+    return std::to_string(Width) + "x" + std::to_string(Height) + "/e" + std::to_string(Eggs)
+         + "/t" + std::to_string(Trees) + "/j" + std::to_string(Threads);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Result - Measurement of a single configuration
+////////////////////////////////////////////////////////////////////////////////
+struct Result
+{
+  Config    Params;
+  uint32_t  Frames;       //!< Frames measured
+  double    Median,       //!< Median frame time (ms)
+            Fastest;      //!< Fastest frame time (ms)
+  uint32_t  Checksum;     //!< FNV-1a hash of the final frame
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Options - Command line options
+////////////////////////////////////////////////////////////////////////////////
+struct Options
+{
+  std::vector<render::SizeL>  Sizes   = { {640,480}, {1920,1080}, {3840,2160} };
+  std::vector<uint32_t>       Eggs    = { 0, 1000, 10000, 100000, 1000000 },
+                              Trees   = { 0, 100, 1000, 10000 };
+  std::vector<unsigned>       Threads = { 1, 2, 4 };
+  bool         Full      = false;     //!< Sweep the cartesian product rather than each axis in turn
+  double       Seconds   = 0.25;      //!< Measurement budget per configuration
+  double       Threshold = 0.15;      //!< Permitted slowdown relative to the baseline
+  std::string  Csv,                   //!< Output file  (Default: stdout)
+               Baseline;              //!< Baseline file to compare against
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::checksum
+//! Calculate the FNV-1a hash of the visible pixels of a frame
+////////////////////////////////////////////////////////////////////////////////
+uint32_t checksum(const render::Framebuffer& frame)
+{
+  uint32_t hash = 2166136261u;
+  for (int32_t y = 0; y < frame.height(); ++y)
+    for (const uint32_t* px = frame.row(y), *end = px + frame.width(); px != end; ++px)
+      hash = (hash ^ *px) * 16777619u;
+  return hash;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::parseList
+//! Parse a comma separated list of values
+////////////////////////////////////////////////////////////////////////////////
+template <typename T, typename PARSE>
+std::vector<T> parseList(const char* arg, PARSE&& parse)
+{
+  std::vector<T> values;
+  std::istringstream in(arg);
+  for (std::string item; std::getline(in, item, ','); )
+    if (!item.empty())
+      values.push_back(parse(item));
+  return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::parseOptions
+//! Parse the command line
+//!
+//! \return bool - False if the command line is invalid
+////////////////////////////////////////////////////////////////////////////////
+bool parseOptions(int argc, char* argv[], Options& opt)
+{
+  auto count = [](const std::string& s) { return uint32_t(std::stoul(s)); };
+  auto size  = [](const std::string& s) { return render::SizeL(std::stoi(s), std::stoi(s.substr(s.find('x')+1))); };
+
+  for (int idx = 1; idx < argc; ++idx)
+  {
+    const char* arg = argv[idx];
+    const char* val = idx+1 < argc ? argv[idx+1] : nullptr;
+
+    if (!std::strcmp(arg, "--full"))
+      opt.Full = true;
+    else if (!std::strcmp(arg, "--quick"))
+      opt.Seconds = 0.05;
+    else if (!val)
+      return false;
+    else if (!std::strcmp(arg, "--sizes"))
+      opt.Sizes = parseList<render::SizeL>(argv[++idx], size);
+    else if (!std::strcmp(arg, "--eggs"))
+      opt.Eggs = parseList<uint32_t>(argv[++idx], count);
+    else if (!std::strcmp(arg, "--trees"))
+      opt.Trees = parseList<uint32_t>(argv[++idx], count);
+    else if (!std::strcmp(arg, "--threads"))
+      opt.Threads = parseList<unsigned>(argv[++idx], count);
+    else if (!std::strcmp(arg, "--seconds"))
+      opt.Seconds = std::atof(argv[++idx]);
+    else if (!std::strcmp(arg, "--threshold"))
+      opt.Threshold = std::atof(argv[++idx]);
+    else if (!std::strcmp(arg, "--csv"))
+      opt.Csv = argv[++idx];
+    else if (!std::strcmp(arg, "--baseline"))
+      opt.Baseline = argv[++idx];
+    else
+      return false;
+  }
+  return !opt.Sizes.empty() && !opt.Eggs.empty() && !opt.Trees.empty() && !opt.Threads.empty();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::sweep
+//! Generate the configurations to measure
+//!
+//! By default each axis is varied in turn around the first value of every other axis;
+//! a full sweep measures every combination.
+////////////////////////////////////////////////////////////////////////////////
+std::vector<Config> sweep(const Options& opt)
+{
+  std::vector<Config> configs;
+  const Config base{opt.Sizes[0].width, opt.Sizes[0].height, opt.Eggs[0], opt.Trees[0], opt.Threads[0]};
+
+  if (opt.Full)
+  {
+    for (auto& sz : opt.Sizes)
+      for (auto eggs : opt.Eggs)
+        for (auto trees : opt.Trees)
+          for (auto threads : opt.Threads)
+            configs.push_back(Config{sz.width, sz.height, eggs, trees, threads});
+    return configs;
+  }
+
+  configs.push_back(base);
+  for (size_t idx = 1; idx < opt.Sizes.size(); ++idx)
+    configs.push_back(Config{opt.Sizes[idx].width, opt.Sizes[idx].height, base.Eggs, base.Trees, base.Threads});
+  for (size_t idx = 1; idx < opt.Eggs.size(); ++idx)
+    configs.push_back(Config{base.Width, base.Height, opt.Eggs[idx], base.Trees, base.Threads});
+  for (size_t idx = 1; idx < opt.Trees.size(); ++idx)
+    configs.push_back(Config{base.Width, base.Height, base.Eggs, opt.Trees[idx], base.Threads});
+  for (size_t idx = 1; idx < opt.Threads.size(); ++idx)
+    configs.push_back(Config{base.Width, base.Height, base.Eggs, base.Trees, opt.Threads[idx]});
+  return configs;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::measure
+//! Render the scene with a configuration until the time budget is spent
+////////////////////////////////////////////////////////////////////////////////
+Result measure(const Config& cfg, double seconds)
+{
+  using clock = std::chrono::steady_clock;
+
+  // Scatter additional instances across the frame  (Same positions for every run)
+  std::mt19937 rng(11);
+  std::vector<render::PointL> trees(cfg.Trees);
+  for (auto& pt : trees)
+    pt = render::PointL(int32_t(rng() % std::max(1, cfg.Width-50)), 50 + int32_t(rng() % std::max(1, cfg.Height-85)));
+
+  std::vector<scene_t::EggInstance> eggs(cfg.Eggs);
+  for (auto& egg : eggs)
+  {
+    egg.Position = render::PointL(int32_t(rng() % std::max(1, cfg.Width-20)), int32_t(rng() % std::max(1, cfg.Height-30)));
+    egg.Style = scene_t::EggAttributes{uint8_t(rng() % 6), uint8_t(rng() % 11), uint8_t(rng() % 11), uint8_t(rng() % 11)};
+  }
+
+  scene_t scene;
+  render::Framebuffer target(cfg.Width, cfg.Height);
+
+  auto draw = [&](render::DeviceContext& dc) {
+    scene.paint(dc, target.bounds(), true);
+    for (size_t first = 0; first < trees.size(); first += ChunkSize)
+      scene.drawTrees(dc, render::span<const render::PointL>(&trees[first], std::min(ChunkSize, trees.size()-first)), true);
+    for (size_t first = 0; first < eggs.size(); first += ChunkSize)
+      scene.drawEggs(dc, render::span<const scene_t::EggInstance>(&eggs[first], std::min(ChunkSize, eggs.size()-first)), true);
+  };
+
+  std::unique_ptr<render::TileRenderer> renderer;
+  std::unique_ptr<render::DeviceContext> direct;
+  if (cfg.Threads > 1)
+    renderer.reset(new render::TileRenderer(cfg.Threads));
+  else
+    direct.reset(new render::DeviceContext(target));
+
+  // Every frame draws the same eggs; the first is a warm-up
+  std::vector<double> times;
+  double total = 0;
+  for (bool warm = false; ; warm = true)
+  {
+    const auto start = clock::now();
+    if (renderer)
+      renderer->render(target, draw);
+    else
+      draw(*direct);
+    const double elapsed = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+    if (!warm)
+      continue;
+    times.push_back(elapsed);
+    total += elapsed / 1000;
+
+    // Spend the budget, but measure slow configurations at least three times if it is not exceeded fourfold
+    if (times.size() >= 10000 || (total >= seconds && (times.size() >= 3 || total >= 4*seconds)))
+      break;
+  }
+
+  std::sort(times.begin(), times.end());
+  return Result{cfg, uint32_t(times.size()), times[times.size()/2], times.front(), checksum(target)};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::loadBaseline
+//! Read the fastest frame time and checksum of each configuration from a previous run
+////////////////////////////////////////////////////////////////////////////////
+bool loadBaseline(const std::string& path, std::map<std::string,std::pair<double,uint32_t>>& baseline)
+{
+  FILE* in = std::fopen(path.c_str(), "r");
+  if (!in)
+    return false;
+
+  char line[512], key[128];
+  double fastest;
+  uint32_t hash;
+  while (std::fgets(line, sizeof(line), in))
+  {
+    // key,width,height,eggs,trees,threads,frames,median_ms,fastest_ms,mpixels_per_s,checksum
+    if (line[0] == '#' || !std::strncmp(line, "key,", 4))
+      continue;
+    if (std::sscanf(line, "%127[^,],%*d,%*d,%*u,%*u,%*u,%*u,%*f,%lf,%*f,%x", key, &fastest, &hash) == 3)
+      baseline[key] = std::make_pair(fastest, hash);
+  }
+  std::fclose(in);
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Sweeps the scene over resolution, egg count, tree count and thread count, writing CSV
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [--sizes WxH,..] [--eggs N,..] [--trees N,..] [--threads N,..] [--full] [--quick]
+//!                   [--seconds S] [--csv file] [--baseline file] [--threshold fraction]
+//! \return int - 0 if successful, 1 if the command line is invalid, 2 if any configuration regressed
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  Options opt;
+  if (!parseOptions(argc, argv, opt))
+  {
+    std::fprintf(stderr, "usage: %s [--sizes WxH,..] [--eggs N,..] [--trees N,..] [--threads N,..] [--full] [--quick]\n"
+                         "          [--seconds S] [--csv file] [--baseline file] [--threshold fraction]\n", argv[0]);
+    return 1;
+  }
+
+  std::map<std::string,std::pair<double,uint32_t>> baseline;
+  if (!opt.Baseline.empty() && !loadBaseline(opt.Baseline, baseline))
+  {
+    std::fprintf(stderr, "unable to read baseline %s\n", opt.Baseline.c_str());
+    return 1;
+  }
+
+  FILE* out = opt.Csv.empty() ? stdout : std::fopen(opt.Csv.c_str(), "w");
+  if (!out)
+  {
+    std::fprintf(stderr, "unable to write %s\n", opt.Csv.c_str());
+    return 1;
+  }
+
+  // Results are written as they complete; progress and comparisons go to stderr
+  std::fprintf(out, "# Scene benchmark: extra eggs/trees are scattered in addition to the scene's own; threads=1 draws without tiling\n");
+  std::fprintf(out, "key,width,height,eggs,trees,threads,frames,median_ms,fastest_ms,mpixels_per_s,checksum\n");
+
+  uint32_t regressions = 0,
+           changed = 0;
+  for (const Config& cfg : sweep(opt))
+  {
+    const Result r = measure(cfg, opt.Seconds);
+    const double mpixels = double(cfg.Width) * cfg.Height / (r.Median * 1000);
+    std::fprintf(out, "%s,%d,%d,%u,%u,%u,%u,%.4f,%.4f,%.2f,%08x\n", cfg.key().c_str(), cfg.Width, cfg.Height, cfg.Eggs,
+                 cfg.Trees, cfg.Threads, r.Frames, r.Median, r.Fastest, mpixels, r.Checksum);
+    std::fflush(out);
+
+    // Compare fastest frames, which are least disturbed by other processes
+    std::fprintf(stderr, "%-28s %10.3f ms", cfg.key().c_str(), r.Fastest);
+    auto prev = baseline.find(cfg.key());
+    if (prev != baseline.end())
+    {
+      const double ratio = r.Fastest / prev->second.first;
+      const bool slower = ratio > 1 + opt.Threshold,
+                 differs = r.Checksum != prev->second.second;
+      regressions += slower;
+      changed += differs;
+      std::fprintf(stderr, "  baseline %10.3f ms  %+7.1f%%%s%s", prev->second.first, (ratio-1)*100,
+                   slower ? "  REGRESSION" : "", differs ? "  OUTPUT CHANGED" : "");
+    }
+    std::fprintf(stderr, "\n");
+  }
+
+  if (out != stdout)
+    std::fclose(out);
+
+  if (!baseline.empty())
+    std::fprintf(stderr, "%u regression(s) beyond %.0f%%, %u changed output(s)\n", regressions, opt.Threshold*100, changed);
+  return regressions || changed ? 2 : 0;
+}
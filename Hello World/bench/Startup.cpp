@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Startup.cpp
+//! \brief Measures the time to first frame of a headless window, in fresh processes
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>          //!< std::sort
+#include <chrono>             //!< std::chrono::milliseconds
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <cstring>            //!< std::strcmp
+#include <memory>             //!< std::unique_ptr
+#include <string>             //!< std::string
+#include <thread>             //!< std::this_thread
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"       //!< hw1::render::Graphics
+#include "../render/RenderThread.h"   //!< hw1::render::RenderThread
+#include "../Scene.h"                 //!< hw1::Scene
+#include "../Startup.h"               //!< hw1::Startup
+
+#if defined(_WIN32)
+  #define popen   _popen
+  #define pclose  _pclose
+#endif
+
+using namespace hw1;
+
+//! \var WindowWidth, WindowHeight - Size of the window, which the render thread was created with
+constexpr int32_t WindowWidth = 640, WindowHeight = 480;
+
+//! \var ClientWidth, ClientHeight - Size of the client area once the window is created  (Less the frame, caption and menu)
+constexpr int32_t ClientWidth = 624, ClientHeight = 421;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct HeadlessWindow - Stands in for MainWindow: a scene drawn by a render thread
+////////////////////////////////////////////////////////////////////////////////
+struct HeadlessWindow
+{
+  Scene<render::Graphics>  Landscape;
+  render::RenderThread     Renderer;
+
+  HeadlessWindow(int32_t width, int32_t height) : Renderer(width, height, [this] (render::Framebuffer& frame) { drawFrame(frame); })
+  {}
+
+  //! Draw the scene exactly as MainWindow::drawFrame does
+  void drawFrame(render::Framebuffer& frame)
+  {
+    const uint64_t start = Startup::instance().elapsed();
+    render::DeviceContext dc(frame);
+    dc.setAntialias(true);
+    Landscape.paint(dc, frame.bounds(), true);
+    Startup::instance().frameDrawn(start);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::child
+//! Start up once, then print the times the first frame, and the first frame at the client
+//! size, were shown, followed by the timeline
+//!
+//! \param[in] sized - Whether the render thread waits for the client size  (Otherwise it draws at the window size upon construction)
+//! \param[in] create - Time blocked creating the window  (Stands in for class registration, creation and showing)
+////////////////////////////////////////////////////////////////////////////////
+int child(bool sized, std::chrono::milliseconds create)
+{
+  Startup& startup = Startup::instance();
+  std::unique_ptr<HeadlessWindow> window;
+  {
+    HW1_STARTUP_PHASE("construct");
+    window.reset(sized ? new HeadlessWindow(0, 0) : new HeadlessWindow(WindowWidth, WindowHeight));
+  }
+
+  // Create the window: the client size is known upon creation, but previously reached the renderer only upon the first paint
+  {
+    HW1_STARTUP_PHASE("create");
+    std::this_thread::sleep_for(create);
+  }
+  if (sized)
+    window->Renderer.resize(ClientWidth, ClientHeight);
+  else
+    window->Renderer.request();
+
+  // Paint until a frame at the client size is shown
+  uint64_t exact = 0;
+  while (!exact)
+  {
+    window->Renderer.resize(ClientWidth, ClientHeight);
+    if (window->Renderer.present())
+    {
+      startup.frameShown();
+      if (window->Renderer.frame().Pixels.width() == ClientWidth)
+        exact = startup.elapsed();
+    }
+    std::this_thread::yield();
+  }
+
+  std::printf("%llu %llu %llu\n%s", (unsigned long long)startup.shown(), (unsigned long long)exact,
+              (unsigned long long)window->Renderer.rendered(), startup.report().c_str());
+  return 0;
+}
+
+//! \struct Sample - Times reported by one process
+struct Sample
+{
+  double    Shown,      //!< First frame shown (Milliseconds)
+            Exact;      //!< First frame at the client size shown (Milliseconds)
+  uint64_t  Frames;     //!< Frames drawn
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::launch
+//! Start up in a fresh process
+//!
+//! \param[in] self - Path of this executable
+//! \param[out] timeline - Timeline reported by the process
+////////////////////////////////////////////////////////////////////////////////
+Sample launch(const char* self, bool sized, int32_t create, std::string& timeline)
+{
+  const std::string command = std::string("\"") + self + "\" --child " + (sized ? "1 " : "0 ") + std::to_string(create);
+  Sample s{0, 0, 0};
+  if (FILE* out = popen(command.c_str(), "r"))
+  {
+    unsigned long long shown = 0, exact = 0, frames = 0;
+    char line[256];
+    if (std::fgets(line, sizeof(line), out) && std::sscanf(line, "%llu %llu %llu", &shown, &exact, &frames) == 3)
+      s = Sample{shown / 1e6, exact / 1e6, frames};
+    for (timeline.clear(); std::fgets(line, sizeof(line), out); )
+      timeline += line;
+    pclose(out);
+  }
+  return s;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::median
+//! Get the median of a set of measurements
+////////////////////////////////////////////////////////////////////////////////
+double median(std::vector<double> v)
+{
+  std::sort(v.begin(), v.end());
+  return v.empty() ? 0 : v[v.size()/2];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Starts fresh processes whose render thread draws the first frame at the window size upon
+//! construction, or at the client size once the window is created, and reports the median
+//! time to first frame of each
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [processes] [create (ms)]  or  --child sized create
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  // Origin of the timeline
+  Startup::instance();
+
+  if (argc > 3 && !std::strcmp(argv[1], "--child"))
+    return child(std::atoi(argv[2]) != 0, std::chrono::milliseconds(std::atoi(argv[3])));
+
+  const int32_t processes = argc > 1 ? std::atoi(argv[1]) : 15,
+                create = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  // Steady-state frame, for comparison with the first
+  HeadlessWindow warm(0, 0);
+  render::Framebuffer frame(ClientWidth, ClientHeight);
+  warm.drawFrame(frame);
+  const auto start = std::chrono::steady_clock::now();
+  for (int32_t n = 0; n < 100; ++n)
+    warm.drawFrame(frame);
+  const double steady = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / 100;
+
+  std::printf("%d processes, window creation blocked for %d ms, steady-state frame %.3f ms\n", processes, create, steady);
+  std::printf("%-14s %14s %14s %8s\n", "renderer", "shown(ms)", "client(ms)", "frames");
+  std::string timeline;
+  for (bool sized : {false, true})
+  {
+    std::vector<double> shown, exact, frames;
+    for (int32_t n = 0; n < processes; ++n)
+    {
+      const Sample s = launch(argv[0], sized, create, timeline);
+      shown.push_back(s.Shown);
+      exact.push_back(s.Exact);
+      frames.push_back(double(s.Frames));
+    }
+    std::printf("%-14s %14.3f %14.3f %8.0f\n", sized ? "client size" : "window size", median(shown), median(exact), median(frames));
+  }
+  std::printf("\ntimeline of the last process:\n%s", timeline.c_str());
+  return 0;
+}
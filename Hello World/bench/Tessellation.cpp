@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\Tessellation.cpp
+//! \brief Compares painting from compile-time span tables with rasterizing on every call
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::timeIt
+//! Measure the average duration of a function, in microseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double timeIt(int32_t repeats, FUNC&& func)
+{
+  using clock = std::chrono::steady_clock;
+  func();     // Warm up
+  const auto start = clock::now();
+  for (int32_t n = 0; n < repeats; ++n)
+    func();
+  return std::chrono::duration<double, std::micro>(clock::now() - start).count() / repeats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::compare
+//! Run a workload with precomputed and dynamic tessellation and report both
+////////////////////////////////////////////////////////////////////////////////
+template <typename WORK>
+bool compare(const char* name, int32_t width, int32_t height, int32_t repeats, WORK&& work)
+{
+  render::Framebuffer precomputed(width, height), dynamic(width, height);
+  // Both scenes choose the same eggs
+  Scene<render::Graphics> fast;
+  Scene<render::DynamicGraphics> slow;
+  render::DeviceContext fastDC(precomputed), slowDC(dynamic);
+
+  const double before = timeIt(repeats, [&] { work(slow, slowDC, dynamic); }),
+               after  = timeIt(repeats, [&] { work(fast, fastDC, precomputed); });
+  const bool match = precomputed == dynamic;
+  std::printf("%-16s %14.2f %14.2f %8.2fx %6s\n", name, before, after, before / after, match ? "yes" : "NO");
+  return match;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Paints the scene and crowds of bunnies, trees and eggs with both tessellation strategies
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [instances] [repeats]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const int32_t instances = argc > 1 ? std::atoi(argv[1]) : 2000,
+                repeats   = argc > 2 ? std::atoi(argv[2]) : 20,
+                size      = 2048;
+
+  std::printf("span tables:  river=%zu  tree=%zu  egg=%zu  body=%zu  eye=%zu\n",
+              render::ShapeSpans<Scene<render::Graphics>::River, 2>::Table.Count,
+              render::ShapeSpans<render::TriangleShape<50,50>, 2>::Table.Count,
+              render::EllipseSpans<20,30,2>::Table.Count,
+              render::EllipseSpans<60,80,2>::Table.Count,
+              render::EllipseSpans<10,10,2>::Table.Count);
+
+  // Scatter instance positions  (Including partially off-screen)
+  std::mt19937 rng(5);
+  std::vector<render::PointL> positions(instances);
+  for (auto& pt : positions)
+    pt = render::PointL(int32_t(rng() % (size+100)) - 50, int32_t(rng() % (size+100)) - 50);
+
+  bool identical = true;
+  std::printf("%-16s %14s %14s %9s %6s\n", "workload", "dynamic(us)", "tables(us)", "speedup", "match");
+  identical &= compare("scene 640x480", 640, 480, repeats*50, [](auto& scene, auto& dc, auto& target) {
+    scene.paint(dc, target.bounds(), true);
+  });
+  identical &= compare("bunnies", size, size, repeats, [&](auto& scene, auto& dc, auto&) {
+    for (const auto& pt : positions)
+      scene.drawEasterBunny(dc, pt, true);
+  });
+  identical &= compare("trees", size, size, repeats, [&](auto& scene, auto& dc, auto&) {
+    for (const auto& pt : positions)
+      scene.drawTree(dc, pt, true);
+  });
+  identical &= compare("eggs (x8)", size, size, repeats, [&](auto& scene, auto& dc, auto&) {
+    for (const auto& pt : positions)
+      scene.drawEasterEggs(dc, pt, 8, true);
+  });
+  return identical ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\TextLayout.cpp
+//! \brief Measures text-heavy scenes with and without the text layout cache
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <random>             //!< std::mt19937
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"   //!< hw1::render::Graphics
+#include "../Scene.h"             //!< hw1::Scene
+
+using namespace hw1;
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Draws thousands of signs (and numbered labels) with and without the text cache
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [signs] [frames]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  using clock = std::chrono::steady_clock;
+
+  const int32_t signs  = argc > 1 ? std::atoi(argv[1]) : 2000,
+                frames = argc > 2 ? std::atoi(argv[2]) : 10,
+                size   = 4096;
+
+  // Scatter signs across the canvas
+  std::mt19937 rng(3);
+  std::vector<render::PointL> positions(signs);
+  for (auto& pt : positions)
+    pt = render::PointL(int32_t(rng() % (size-200)), int32_t(rng() % (size-170)));
+
+  Scene<render::Graphics> scene;
+  render::Framebuffer uncached(size, size), cached(size, size);
+  const render::HFont labelFont = render::DeviceContext::screenDC().getFont("MS Shell Dlg 2", 12);
+  char label[16];
+
+  auto frame = [&](render::DeviceContext& dc, bool labels) {
+    for (int32_t idx = 0; idx < signs; ++idx)
+    {
+      scene.drawSign(dc, positions[idx], true);
+      if (labels)
+      {
+        // Unique strings defeat layout reuse  (Glyphs are still shared)
+        std::snprintf(label, sizeof(label), "#%d", idx);
+        dc += labelFont;
+        dc.write(label, render::RectL(positions[idx], render::SizeL(200,20)), render::DrawTextFlags::Right);
+        dc.clear();
+      }
+    }
+  };
+
+  auto measure = [&](render::Framebuffer& target, render::TextCache* textCache, bool labels) {
+    render::DeviceContext dc(target);
+    dc.setTextCache(textCache);
+    frame(dc, labels);     // Warm up
+    const auto start = clock::now();
+    for (int32_t n = 0; n < frames; ++n)
+      frame(dc, labels);
+    return std::chrono::duration<double, std::micro>(clock::now() - start).count() / (double(frames) * signs);
+  };
+
+  bool identical = true;
+  std::printf("%-14s %7s %12s %12s %9s %9s %10s %10s %8s %6s\n", "scene", "signs", "direct(us)", "cached(us)", "speedup",
+              "hit-rate", "glyph.hit", "glyph.miss", "glyphs", "match");
+  for (bool labels : { false, true })
+  {
+    render::TextCache cache;
+    const double direct = measure(uncached, nullptr, labels),
+                 fast = measure(cached, &cache, labels);
+    const render::TextStats stats = cache.stats();
+    const bool match = cached == uncached;
+    identical &= match;
+
+    std::printf("%-14s %7d %12.3f %12.3f %8.2fx %8.1f%% %10llu %10llu %8zu %6s\n", labels ? "signs+labels" : "signs", signs,
+                direct, fast, direct / fast, 100.0 * stats.LayoutHits / std::max<uint64_t>(1, stats.LayoutHits + stats.LayoutMisses),
+                (unsigned long long)stats.GlyphHits, (unsigned long long)stats.GlyphMisses, cache.glyphs(), match ? "yes" : "NO");
+  }
+  return identical ? 0 : 1;
+}
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\bench\TileScaling.cpp
+//! \brief Measures scaling of tile-parallel rendering with the number of threads
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdio>             //!< std::printf
+#include <cstdlib>            //!< std::atoi
+#include <thread>             //!< std::thread::hardware_concurrency
+#include <vector>             //!< std::vector
+#include "../render/Graphics.h"       //!< hw1::render::Graphics
+#include "../render/TileRenderer.h"   //!< hw1::render::TileRenderer
+#include "../Scene.h"                 //!< hw1::Scene
+
+using namespace hw1;
+
+////////////////////////////////////////////////////////////////////////////////
+//! \struct Resolution - Named frame size
+////////////////////////////////////////////////////////////////////////////////
+struct Resolution
+{
+  const char*  Name;
+  int32_t      Width,
+               Height,
+               Frames;      //!< Frames rendered per measurement
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// ::timeFrames
+//! Measure the average time of rendering a frame, in milliseconds
+////////////////////////////////////////////////////////////////////////////////
+template <typename FUNC>
+double timeFrames(int32_t frames, FUNC&& render)
+{
+  using clock = std::chrono::steady_clock;
+
+  // Warm up
+  render();
+
+  const auto start = clock::now();
+  for (int32_t n = 0; n < frames; ++n)
+  {
+    render();
+  }
+  return std::chrono::duration<double, std::milli>(clock::now() - start).count() / frames;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ::main
+//! Renders the scene directly and in tiles using 1 to N threads
+//!
+//! \param[in] argc - Number of arguments
+//! \param[in] argv - [max threads] [include 16K (0/1)]
+////////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+  const unsigned maxThreads = argc > 1 ? unsigned(std::atoi(argv[1])) : std::max(1u, std::thread::hardware_concurrency());
+  const bool     huge       = argc > 2 ? std::atoi(argv[2]) != 0 : true;
+
+  std::vector<Resolution> resolutions = { {"640x480", 640, 480, 500}, {"4K", 3840, 2160, 20} };
+  if (huge)
+    resolutions.push_back({"16K", 15360, 8640, 3});
+
+  std::vector<unsigned> threadCounts;
+  for (unsigned t = 1; t < maxThreads; t *= 2)
+    threadCounts.push_back(t);
+  threadCounts.push_back(maxThreads);
+
+  Scene<render::Graphics> scene;
+  bool identical = true;
+
+  std::printf("%-8s %8s %8s %12s %10s %8s\n", "size", "threads", "tiles", "ms/frame", "speedup", "match");
+  for (const Resolution& res : resolutions)
+  {
+    render::Framebuffer reference(res.Width, res.Height);
+    {
+      render::DeviceContext dc(reference);
+      const double direct = timeFrames(res.Frames, [&] { scene.paint(dc, reference.bounds(), true); });
+      std::printf("%-8s %8s %8s %12.3f %9.2fx %8s\n", res.Name, "direct", "-", direct, 1.0, "-");
+    }
+
+    double single = 0;
+    for (unsigned threads : threadCounts)
+    {
+      render::Framebuffer target(res.Width, res.Height);
+      render::TileRenderer renderer(threads);
+      const double elapsed = timeFrames(res.Frames, [&] {
+        renderer.render(target, [&](render::DeviceContext& dc) { scene.paint(dc, target.bounds(), true); });
+      });
+      if (threads == 1)
+        single = elapsed;
+
+      const bool match = target == reference;
+      identical &= match;
+      std::printf("%-8s %8u %8zu %12.3f %9.2fx %8s\n", res.Name, threads, renderer.tiles(), elapsed, single / elapsed, match ? "yes" : "NO");
+    }
+  }
+  return identical ? 0 : 1;
+}
@@ -18,6 +18,9 @@
 ////////////////////////////////////////////////////////////////////////////////
 int32_t WINAPI _tWinMain(::HINSTANCE instance, ::HINSTANCE prevInstance, PWSTR cmdLine, int32_t showMode)
 {
+  // Start the startup timeline  (Phases and the time to first frame are measured from here)
+  hw1::Startup::instance();
+
   try
   {
     hw1::application_t program(instance);
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\CommandList.h
+//! \brief Defines a recorded sequence of drawing commands
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_COMMAND_LIST_H
+#define RENDER_COMMAND_LIST_H
+
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::HPen
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct CommandList - Drawing commands captured by a recording DeviceContext
+  //!
+  //! Each command references a snapshot of the device state (pen, brush, font, colours,
+  //! mix mode and clipping rectangle) in effect when it was issued, and carries the
+  //! bounding rectangle of the pixels it can touch. Consecutive commands issued with the
+  //! same state share one snapshot. Polygon vertices and text are stored in shared arrays.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct CommandList
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \enum Opcode - Command types
+    enum class Opcode : uint8_t { Fill, Rect, Ellipse, Polygon, Write };
+
+    //! \struct DrawState - Device state used by a command
+    struct DrawState
+    {
+      RectL         Clip;         //!< Clipping rectangle
+      HPen          Pen;          //!< Selected pen
+      HBrush        Brush;        //!< Selected brush
+      HFont         Font;         //!< Selected font
+      Colour        BackColour;   //!< Background colour
+      Colour        TextColour;   //!< Text colour
+      DrawingMode   Mode;         //!< Background mix mode
+
+      bool operator== (const DrawState& r) const
+      {
+        return Clip == r.Clip && Pen.style == r.Pen.style && Pen.width == r.Pen.width && Pen.colour == r.Pen.colour
+            && Brush.colour == r.Brush.colour && Brush.hatch == r.Brush.hatch && Brush.hatched == r.Brush.hatched
+            && Font.height == r.Font.height && Font.weight == r.Font.weight
+            && BackColour == r.BackColour && TextColour == r.TextColour && Mode == r.Mode;
+      }
+    };
+
+    //! \struct Command - Recorded drawing command
+    struct Command
+    {
+      Opcode          Op;         //!< Command type
+      DrawTextFlags   Flags;      //!< Text alignment  (Write only)
+      uint32_t        State;      //!< Index of device state
+      RectL           Rect;       //!< Shape or layout rectangle  (Unused by Polygon)
+      HBrush          Brush;      //!< Fill brush  (Fill only)
+      uint32_t        Offset,     //!< First vertex or character  (Polygon/Write only)
+                      Count;      //!< Number of vertices or characters  (Polygon/Write only)
+      RectL           Bounds;     //!< Pixels that may be touched  (Already clipped)
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    std::vector<DrawState>  States;       //!< Distinct consecutive device states
+    std::vector<Command>    Commands;     //!< Commands in issue order
+    std::vector<POINT>      Points;       //!< Polygon vertices
+    std::vector<char>       Text;         //!< Text  (Null terminated)
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool    empty() const { return Commands.empty(); }
+    size_t  size() const  { return Commands.size(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandList::bounds const
+    //! Calculate the area touched by all commands
+    ///////////////////////////////////////////////////////////////////////////////
+    RectL bounds() const
+    {
+      RectL r;
+      for (const Command& cmd : Commands)
+        r = r.unite(cmd.Bounds);
+      return r;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandList::clear
+    //! Discard all commands  (Retains storage)
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      States.clear();
+      Commands.clear();
+      Points.clear();
+      Text.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // CommandList::add
+    //! Append a command
+    //!
+    //! \param[in] state - Device state
+    //! \param[in] cmd - Command  (State index is assigned)
+    ///////////////////////////////////////////////////////////////////////////////
+    void add(const DrawState& state, Command cmd)
+    {
+      if (States.empty() || !(States.back() == state))
+        States.push_back(state);
+
+      cmd.State = uint32_t(States.size()-1);
+      Commands.push_back(cmd);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,568 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Coverage.h
+//! \brief Defines anti-aliased scan conversion by accumulating the signed area of edges
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_COVERAGE_H
+#define RENDER_COVERAGE_H
+
+#include <algorithm>          //!< std::min
+#include <cmath>              //!< std::floor
+#include <cstring>            //!< std::memset
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+#include "Rasterizer.h"       //!< hw1::render::PointF
+#include "Spans.h"            //!< hw1::render::fillHatch
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Coverage - Computes the exact area of each pixel covered by a path of line segments
+  //!
+  //! In the style of font rasterizers, each edge deposits into an accumulation buffer the
+  //! signed area it sweeps within each pixel it crosses, relative to the pixel to its
+  //! left. A running sum along each row then yields the winding-weighted coverage of every
+  //! pixel, which is clamped to [0,1] (the non-zero rule; identical to the alternate rule
+  //! for the simple shapes drawn by the scene). The running sum is vectorized as an
+  //! in-register prefix sum.
+  //!
+  //! Rows are processed in strips of StripHeight so the buffer stays small for shapes of
+  //! any size, and edges are clamped horizontally to the clipping rectangle so a shape
+  //! extending far beyond it costs no more than the visible part.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Coverage
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var StripHeight - Rows accumulated at once
+    static constexpr int32_t StripHeight = 16;
+
+    //! \var Tolerance - Largest distance between an ellipse and its polygonal approximation  (Pixels)
+    static constexpr float Tolerance = 0.02f;
+
+    //! \var MaxArcSegments - Upper bound on segments approximating an ellipse
+    static constexpr int32_t MaxArcSegments = 512;
+
+  private:
+    //! \struct Edge - Directed line segment
+    struct Edge
+    {
+      PointF  a, b;
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    std::vector<Edge>     Edges;      //!< Edges of current path
+    std::vector<float>    Cells;      //!< Accumulation buffer  (One strip)
+    std::vector<uint8_t>  Alpha;      //!< Coverage of one row  (0-255)
+    float                 MinX = 0, MinY = 0,   //!< Extent of current path
+                          MaxX = 0, MaxY = 0;
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool  empty() const  { return Edges.empty(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //! Begin a new path
+    void clear()
+    {
+      Edges.clear();
+    }
+
+    //! Add an edge to the path
+    void line(PointF a, PointF b)
+    {
+      if (a.y == b.y)
+        return;
+      if (Edges.empty())
+        MinX = MaxX = a.x, MinY = MaxY = a.y;
+      MinX = std::min(MinX, std::min(a.x, b.x)), MaxX = std::max(MaxX, std::max(a.x, b.x));
+      MinY = std::min(MinY, std::min(a.y, b.y)), MaxY = std::max(MaxY, std::max(a.y, b.y));
+      Edges.push_back(Edge{a, b});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::polygon
+    //! Add a closed polygon to the path
+    //!
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    //! \param[in] reverse - [optional] Whether to add the edges in reverse  (Subtracts the polygon from an enclosing one)
+    ///////////////////////////////////////////////////////////////////////////////
+    void polygon(const PointF* pts, int32_t count, bool reverse = false)
+    {
+      for (int32_t i = 0, j = count-1; i < count; j = i++)
+        reverse ? line(pts[i], pts[j]) : line(pts[j], pts[i]);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::ellipse
+    //! Add an ellipse, approximated by a polygon within Tolerance, to the path
+    //!
+    //! \param[in] cx - Centre
+    //! \param[in] cy - Centre
+    //! \param[in] ra - Horizontal radius
+    //! \param[in] rb - Vertical radius
+    //! \param[in] reverse - [optional] Whether to add the edges in reverse  (Subtracts the ellipse from an enclosing one)
+    ///////////////////////////////////////////////////////////////////////////////
+    void ellipse(float cx, float cy, float ra, float rb, bool reverse = false)
+    {
+      if (ra <= 0 || rb <= 0)
+        return;
+
+      // Choose the angle subtended by a chord whose sagitta equals the tolerance
+      const float r = std::max(ra, rb),
+                  step = r > Tolerance ? 2 * std::acos(1 - Tolerance / r) : 1.0f;
+      const int32_t n = std::min(MaxArcSegments, std::max(8, int32_t(std::ceil(6.2831853f / step))));
+
+      // Rotate the unit vector incrementally
+      const float c = std::cos(6.2831853f / n), s = (reverse ? -1 : 1) * std::sin(6.2831853f / n);
+      float ux = 1, uy = 0;
+      PointF prev{cx + ra, cy};
+      for (int32_t i = 1; i <= n; ++i)
+      {
+        const float nx = ux*c - uy*s;
+        uy = ux*s + uy*c;
+        ux = nx;
+        const PointF next = i == n ? PointF{cx + ra, cy} : PointF{cx + ra*ux, cy + rb*uy};
+        line(prev, next);
+        prev = next;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::ellipseInterior
+    //! Add the interior of an outlined ellipse to the path  (Nothing when the outline fills it)
+    //!
+    //! \param[in] r - Bounding rectangle  (Normalized)
+    //! \param[in] pen - Outline width
+    ///////////////////////////////////////////////////////////////////////////////
+    void ellipseInterior(const RectL& r, int32_t pen)
+    {
+      const float ra = r.width() * 0.5f - pen,
+                  rb = r.height() * 0.5f - pen;
+      if (ra > 0 && rb > 0)
+        ellipse((r.left + r.right) * 0.5f, (r.top + r.bottom) * 0.5f, ra, rb);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::ellipseOutline
+    //! Add the outline of an ellipse to the path, as a ring the width of the pen
+    //!
+    //! \param[in] r - Bounding rectangle  (Normalized)
+    //! \param[in] pen - Outline width
+    ///////////////////////////////////////////////////////////////////////////////
+    void ellipseOutline(const RectL& r, int32_t pen)
+    {
+      if (!pen)
+        return;
+
+      const float cx = (r.left + r.right) * 0.5f,
+                  cy = (r.top + r.bottom) * 0.5f,
+                  ra = r.width() * 0.5f,
+                  rb = r.height() * 0.5f;
+      ellipse(cx, cy, ra, rb);
+      if (ra - pen > 0 && rb - pen > 0)
+        ellipse(cx, cy, ra - pen, rb - pen, true);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::polygonOutline
+    //! Add the outline of a polygon to the path, as one thick segment per edge
+    //!
+    //! Segments overlap at the joins; the non-zero rule covers each pixel once.
+    //!
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    //! \param[in] pen - Outline width
+    ///////////////////////////////////////////////////////////////////////////////
+    void polygonOutline(const PointF* pts, int32_t count, int32_t pen)
+    {
+      if (!pen)
+        return;
+
+      for (int32_t i = 0, j = count-1; i < count; j = i++)
+        Rasterizer::segment(pts[j], pts[i], float(pen), [this] (const PointF* quad, int32_t n) { polygon(quad, n); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::render
+    //! Resolve the coverage of the path within a clipping rectangle
+    //!
+    //! \param[in] clip - Clipping rectangle
+    //! \param[in] emit - Callable as emit(y, x0, alpha, count) for each row, receiving the coverage (0-255) of pixels x0 to x0+count
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename EMIT>
+    void render(const RectL& clip, EMIT&& emit)
+    {
+      if (Edges.empty())
+        return;
+
+      // Restrict to the clipped extent of the path
+      const int32_t left = std::max(int32_t(std::floor(MinX)), clip.left),
+                    right = std::min(int32_t(std::ceil(MaxX)), clip.right),
+                    top = std::max(int32_t(std::floor(MinY)), clip.top),
+                    bottom = std::min(int32_t(std::ceil(MaxY)), clip.bottom);
+      if (left >= right || top >= bottom)
+        return;
+
+      // Cells for each pixel plus two (Deposits beyond the right edge), rounded up to whole vectors
+      const int32_t width = right - left,
+                    stride = (width + 2 + 3) & ~3;
+      if (Cells.size() < size_t(stride) * StripHeight)
+        Cells.assign(size_t(stride) * StripHeight, 0.0f);
+      if (Alpha.size() < size_t(stride))
+        Alpha.resize(stride);
+
+      for (int32_t strip = top; strip < bottom; strip += StripHeight)
+      {
+        const int32_t rows = std::min(StripHeight, bottom - strip);
+        for (const Edge& e : Edges)
+          accumulate(e, float(left), float(right), strip, rows, stride);
+
+        for (int32_t row = 0; row < rows; ++row)
+        {
+          resolve(&Cells[size_t(row) * stride], Alpha.data(), stride);
+          emit(strip + row, left, Alpha.data(), width);
+        }
+      }
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::accumulate
+    //! Deposit the area swept by an edge within the rows of a strip
+    //!
+    //! Portions of the edge left or right of the clipped extent are projected onto its
+    //! boundary, which preserves the running sum of every pixel within it.
+    ///////////////////////////////////////////////////////////////////////////////
+    void accumulate(const Edge& e, float left, float right, int32_t strip, int32_t rows, int32_t stride)
+    {
+      // Orient downwards
+      PointF p = e.a, q = e.b;
+      float dir = 1;
+      if (p.y > q.y)
+        std::swap(p, q), dir = -1;
+
+      const float y0 = std::max(p.y, float(strip)),
+                  y1 = std::min(q.y, float(strip + rows));
+      if (y0 >= y1)
+        return;
+
+      const float dxdy = (q.x - p.x) / (q.y - p.y);
+      float x = p.x + dxdy * (y0 - p.y);
+      for (int32_t y = int32_t(std::floor(y0)); float(y) < y1; ++y)
+      {
+        const float top = std::max(float(y), y0),
+                    bottom = std::min(float(y + 1), y1),
+                    xnext = x + dxdy * (bottom - top);
+        float* cells = &Cells[size_t(y - strip) * stride];
+
+        // Split the row's segment where it crosses either boundary
+        const float xa = std::min(x, xnext), xb = std::max(x, xnext);
+        if (xa < left && xb > left)
+          crossing(cells, x, xnext, top, bottom, left, left, right, dir);
+        else if (xa < right && xb > right)
+          crossing(cells, x, xnext, top, bottom, right, left, right, dir);
+        else
+          cell(cells, std::min(std::max(x, left), right) - left, std::min(std::max(xnext, left), right) - left, (bottom - top) * dir);
+        x = xnext;
+      }
+    }
+
+    //! Deposit a segment crossing a boundary as two parts
+    void crossing(float* cells, float x, float xnext, float top, float bottom, float at, float left, float right, float dir)
+    {
+      const float t = (at - x) / (xnext - x),
+                  dy = (bottom - top) * dir;
+      cell(cells, std::min(std::max(x, left), right) - left, at - left, dy * t);
+      cell(cells, at - left, std::min(std::max(xnext, left), right) - left, dy * (1 - t));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::cell
+    //! Deposit the area swept within one row by a segment between two x-coordinates  (Relative to the row's first cell)
+    //!
+    //! \param[in,out] acc - Cells of the row
+    //! \param[in] x0 - Upper x-coordinate
+    //! \param[in] x1 - Lower x-coordinate
+    //! \param[in] d - Signed height of the segment within the row
+    ///////////////////////////////////////////////////////////////////////////////
+    static void cell(float* acc, float x0, float x1, float d)
+    {
+      if (x0 > x1)
+        std::swap(x0, x1);
+
+      const float x0floor = std::floor(x0),
+                  x1ceil = std::ceil(x1);
+      const int32_t x0i = int32_t(x0floor),
+                    x1i = int32_t(x1ceil);
+      if (x1i <= x0i + 1)
+      {
+        // Within one pixel: area right of the segment's midpoint
+        const float xmf = 0.5f * (x0 + x1) - x0floor;
+        acc[x0i] += d - d * xmf;
+        acc[x0i + 1] += d * xmf;
+        return;
+      }
+
+      // Across several pixels: trapezoids, with triangles in the first and last pixels
+      const float s = 1 / (x1 - x0),
+                  x0f = x0 - x0floor,
+                  a0 = 0.5f * s * (1 - x0f) * (1 - x0f),
+                  x1f = x1 - x1ceil + 1,
+                  am = 0.5f * s * x1f * x1f;
+      acc[x0i] += d * a0;
+      if (x1i == x0i + 2)
+        acc[x0i + 1] += d * (1 - a0 - am);
+      else
+      {
+        const float a1 = s * (1.5f - x0f);
+        acc[x0i + 1] += d * (a1 - a0);
+        for (int32_t xi = x0i + 2; xi < x1i - 1; ++xi)
+          acc[xi] += d * s;
+        const float a2 = a1 + (x1i - x0i - 3) * s;
+        acc[x1i - 1] += d * (1 - a2 - am);
+      }
+      acc[x1i] += d * am;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Coverage::resolve
+    //! Convert a row of accumulated area into coverage, clearing the row
+    //!
+    //! \param[in,out] acc - Cells of the row  (Multiple of four)
+    //! \param[out] alpha - Coverage
+    //! \param[in] count - Number of cells
+    ///////////////////////////////////////////////////////////////////////////////
+    static void resolve(float* acc, uint8_t* alpha, int32_t count)
+    {
+#if defined(__AVX2__) || defined(RENDER_SSE2)
+      const __m128 zero = _mm_setzero_ps(),
+                   one = _mm_set1_ps(1.0f),
+                   scale = _mm_set1_ps(255.0f),
+                   half = _mm_set1_ps(0.5f),
+                   sign = _mm_set1_ps(-0.0f);
+      __m128 carry = zero;
+      for (int32_t i = 0; i < count; i += 4)
+      {
+        // Prefix sum of four cells, plus the sum of all previous cells
+        __m128 x = _mm_loadu_ps(acc + i);
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)));
+        x = _mm_add_ps(x, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 8)));
+        x = _mm_add_ps(x, carry);
+        carry = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3,3,3,3));
+        _mm_storeu_ps(acc + i, zero);
+
+        // |sum| clamped to one, scaled to a byte
+        const __m128 a = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_andnot_ps(sign, x), one), scale), half);
+        const __m128i v = _mm_cvttps_epi32(a),
+                      b = _mm_packus_epi16(_mm_packs_epi32(v, v), v);
+        const int32_t bytes = _mm_cvtsi128_si32(b);
+        std::memcpy(alpha + i, &bytes, 4);
+      }
+#else
+      float sum = 0;
+      for (int32_t i = 0; i < count; ++i)
+      {
+        sum += acc[i];
+        acc[i] = 0;
+        alpha[i] = uint8_t(std::min(std::fabs(sum), 1.0f) * 255.0f + 0.5f);
+      }
+#endif
+    }
+  };
+
+  //! \var Coverage::StripHeight - Rows accumulated at once
+  constexpr int32_t  Coverage::StripHeight;
+
+  //! \var Coverage::Tolerance - Largest distance between an ellipse and its polygonal approximation
+  constexpr float  Coverage::Tolerance;
+
+  //! \var Coverage::MaxArcSegments - Upper bound on segments approximating an ellipse
+  constexpr int32_t  Coverage::MaxArcSegments;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::coveredRun
+  //! Count the fully covered pixels at the start of a run, sixteen at a time where possible
+  //!
+  //! \param[in] alpha - Coverage of each pixel  (0-255)
+  //! \param[in] count - Number of pixels
+  ///////////////////////////////////////////////////////////////////////////////
+  inline int32_t coveredRun(const uint8_t* alpha, int32_t count)
+  {
+    int32_t n = 0;
+#if defined(__AVX2__) || defined(RENDER_SSE2)
+    const __m128i full = _mm_set1_epi8(-1);
+    while (n + 16 <= count && _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + n)), full)) == 0xFFFF)
+      n += 16;
+#endif
+    while (n < count && alpha[n] == 255)
+      ++n;
+    return n;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::blendCoverage
+  //! Blends a brush into a run of pixels in proportion to their coverage
+  //!
+  //! Most pixels of a shape are fully covered, so runs of them are filled with fillHatch()
+  //! and only partially covered pixels are blended.
+  //!
+  //! \param[in,out] dst - First pixel
+  //! \param[in] alpha - Coverage of each pixel  (0-255)
+  //! \param[in] count - Number of pixels
+  //! \param[in] x - Device x-coordinate of first pixel (Selects pattern phase)
+  //! \param[in] bits - Pattern row (Bit N set => pixel N is foreground; 0xFF when solid)
+  //! \param[in] fore - Foreground pixel value
+  //! \param[in] back - Background pixel value
+  //! \param[in] opaque - Whether background pixels are blended
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void blendCoverage(uint32_t* dst, const uint8_t* alpha, int32_t count, int32_t x, uint8_t bits, uint32_t fore, uint32_t back, bool opaque)
+  {
+    for (int32_t i = 0; i < count; ++i)
+    {
+      const uint32_t a = alpha[i];
+      if (a == 255)
+      {
+        const int32_t n = coveredRun(alpha + i, count - i);
+        fillHatch(dst + i, n, x + i, bits, fore, back, opaque);
+        i += n - 1;
+        continue;
+      }
+      if (!a)
+        continue;
+
+      const bool foreground = (bits >> ((x+i) & 7)) & 1;
+      if (!foreground && !opaque)
+        continue;
+
+      // Interpolate red/blue and alpha/green pairs of channels together
+      const uint32_t src = foreground ? fore : back,
+                     w = a + (a >> 7),
+                     d = dst[i];
+      const uint32_t rb = ((src & 0x00FF00FF) * w + (d & 0x00FF00FF) * (256 - w)) >> 8,
+                     ag = ((src >> 8 & 0x00FF00FF) * w + (d >> 8 & 0x00FF00FF) * (256 - w)) >> 8;
+      dst[i] = (rb & 0x00FF00FF) | ((ag & 0x00FF00FF) << 8);
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct CoverageMask - Coverage of the interior and outline of a fixed-size shape, resolved once
+  //!
+  //! Coverage is unchanged by translation through whole pixels, so a shape drawn repeatedly
+  //! at the same size may be resolved once relative to its origin and blended at each
+  //! position, in the manner of the span tables of the aliased renderer. Each layer stores
+  //! only the runs of each row with non-zero coverage, split wherever at least MinGap pixels
+  //! are empty so the hollow middle of an outline is never blended.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct CoverageMask
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var MinGap - Fewest empty pixels that split a row into separate runs
+    static constexpr int32_t MinGap = 8;
+
+    //! \struct Run - Coverage of one row, relative to the shape origin
+    struct Run
+    {
+      int32_t   y, x, count;    //!< Row, first pixel and number of pixels
+      uint32_t  offset;         //!< Position of first pixel within Alpha
+    };
+
+    //! \struct Layer - Coverage of the interior or the outline
+    struct Layer
+    {
+      std::vector<Run>      Runs;     //!< Runs with non-zero coverage, top to bottom
+      std::vector<uint8_t>  Alpha;    //!< Coverage of each run  (0-255)
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    RectL  Bounds;      //!< Bounding rectangle of both layers  (Relative to the shape origin)
+    Layer  Interior;    //!< Filled with the brush
+    Layer  Outline;     //!< Filled with the pen colour, over the interior
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // CoverageMask::ellipse
+    //! Resolve the coverage of an outlined ellipse
+    //!
+    //! \param[in] r - Bounding rectangle  (Relative to the shape origin)
+    //! \param[in] pen - Outline width
+    ///////////////////////////////////////////////////////////////////////////////
+    static CoverageMask ellipse(const RectL& r, int32_t pen)
+    {
+      const RectL rc = r.normalized();
+      CoverageMask mask;
+      Coverage path;
+      mask.Bounds = rc;
+      path.ellipseInterior(rc, pen);
+      mask.capture(path, mask.Interior);
+      path.clear();
+      path.ellipseOutline(rc, pen);
+      mask.capture(path, mask.Outline);
+      return mask;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // CoverageMask::polygon
+    //! Resolve the coverage of an outlined polygon
+    //!
+    //! \param[in] pts - Vertices  (Relative to the shape origin)
+    //! \param[in] count - Number of vertices
+    //! \param[in] pen - Outline width
+    ///////////////////////////////////////////////////////////////////////////////
+    static CoverageMask polygon(const POINT* pts, int32_t count, int32_t pen)
+    {
+      std::vector<PointF> verts(count);
+      for (int32_t i = 0; i < count; ++i)
+        verts[i] = PointF{ float(pts[i].x), float(pts[i].y) };
+
+      CoverageMask mask;
+      Coverage path;
+      mask.Bounds = Rasterizer::bounds(verts.data(), count, pen);
+      path.polygon(verts.data(), count);
+      mask.capture(path, mask.Interior);
+      path.clear();
+      path.polygonOutline(verts.data(), count, pen);
+      mask.capture(path, mask.Outline);
+      return mask;
+    }
+
+  private:
+    //! Resolve a path into a layer, dividing each row into runs of non-zero coverage
+    void capture(Coverage& path, Layer& layer) const
+    {
+      path.render(Bounds, [&layer](int32_t y, int32_t x, const uint8_t* alpha, int32_t count) {
+        for (int32_t first = 0; ; )
+        {
+          while (first < count && !alpha[first])
+            ++first;
+          if (first == count)
+            return;
+
+          // Extend the run until MinGap empty pixels or the end of the row
+          int32_t last = first + 1;
+          for (int32_t i = last, gap = 0; i < count && gap < MinGap; ++i)
+            alpha[i] ? (last = i + 1, gap = 0) : ++gap;
+
+          layer.Runs.push_back(Run{y, x + first, last - first, uint32_t(layer.Alpha.size())});
+          layer.Alpha.insert(layer.Alpha.end(), alpha + first, alpha + last);
+          first = last;
+        }
+      });
+    }
+  };
+
+  //! \var CoverageMask::MinGap - Fewest empty pixels that split a row into separate runs
+  constexpr int32_t  CoverageMask::MinGap;
+
+} } // namespace hw1::render
+
+#endif
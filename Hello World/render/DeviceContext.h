@@ -0,0 +1,781 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\DeviceContext.h
+//! \brief Defines the software device context that rasterizes into a framebuffer
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_DEVICE_CONTEXT_H
+#define RENDER_DEVICE_CONTEXT_H
+
+#include <vector>             //!< std::vector
+#include <cstring>            //!< std::strlen
+#include <functional>         //!< std::function
+#include "Types.h"            //!< hw1::render::HPen
+#include "Framebuffer.h"      //!< hw1::render::Framebuffer
+#include "Rasterizer.h"       //!< hw1::render::Rasterizer
+#include "Font.h"             //!< hw1::render::BitmapFont
+#include "CommandList.h"      //!< hw1::render::CommandList
+#include "Coverage.h"         //!< hw1::render::Coverage
+#include "TextCache.h"        //!< hw1::render::TextCache
+#include "Tessellator.h"      //!< hw1::render::SpanTable
+#include "ShapeCatalog.h"     //!< hw1::render::ShapeCatalog
+#include "Transform.h"        //!< hw1::render::Transform
+#include "Span.h"             //!< hw1::render::span
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct DeviceContext - Software implementation of the wtl::DeviceContext drawing interface
+  //!
+  //! Supports the subset of GDI used by the scene: selection of pens, brushes and fonts,
+  //! background colour and mix mode, filled rectangles/ellipses/polygons and text. Output
+  //! is clipped to the framebuffer and an optional clipping rectangle.
+  //!
+  //! A recording context appends each primitive to a CommandList instead of rasterizing it,
+  //! allowing the output to be replayed later (eg. one tile at a time on several threads).
+  //!
+  //! The coordinates of primitives may be mapped through a pan/zoom transform; clipping
+  //! rectangles and recorded commands are always in device coordinates.
+  //!
+  //! When anti-aliasing is enabled, ellipses and polygons (and their outlines) are blended
+  //! in proportion to the exact area of each pixel they cover rather than filled wherever
+  //! they cover a pixel's centre. Rectangles and text are unaffected.
+  //!
+  //! Text is drawn with the portable bitmap font unless a text writer is installed, which
+  //! may draw it with the named font instead (eg. through GDI on Windows).
+  ///////////////////////////////////////////////////////////////////////////////
+  struct DeviceContext
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    //! \struct DeviceStats - Counts of calls made upon the context
+    ///////////////////////////////////////////////////////////////////////////////
+    struct DeviceStats
+    {
+      uint64_t  StateChanges = 0,   //!< Object selections, colour/mode changes and resets
+                Primitives = 0;     //!< Fills, shapes and text
+    };
+
+    //! \alias text_writer_t - Draws text with the selected font  (Returns false to use the bitmap font instead)
+    //!
+    //! Receives the render target, the context (for its font, colours, mode and clipping
+    //! rectangle), the text and its layout rectangle in device coordinates, and the flags.
+    using text_writer_t = std::function<bool (Framebuffer&, const DeviceContext&, const char*, const RectL&, DrawTextFlags)>;
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    //! \struct SpanFiller - Span callback that paints with a brush
+    ///////////////////////////////////////////////////////////////////////////////
+    struct SpanFiller
+    {
+      Framebuffer*  Target;     //!< Render target (if any)
+      uint32_t      Fore,       //!< Foreground pixel
+                    Back;       //!< Background pixel
+      HatchStyle    Hatch;      //!< Hatch style
+      bool          Hatched,    //!< Whether brush is hatched
+                    Opaque;     //!< Whether hatch background is painted
+
+      void operator() (int32_t y, int32_t x0, int32_t x1) const
+      {
+        if (!Target)
+          return;
+
+        uint32_t* dst = Target->row(y) + x0;
+        if (!Hatched)
+          fillSpan(dst, x1-x0, Fore);
+        else
+          fillHatch(dst, x1-x0, x0, hatchRow(Hatch, y), Fore, Back, Opaque);
+      }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    Framebuffer*  Target = nullptr;     //!< Render target (if any)
+    CommandList*  Recording = nullptr;  //!< Command list being recorded (if any)
+    TextCache*    Layouts = &TextCache::shared();     //!< Text layout cache (if any)
+    text_writer_t Writer;               //!< Draws text with named fonts (if any)
+    RectL         Extent;               //!< Drawable area
+    RectL         Clip;                 //!< Clipping rectangle
+    HPen          Pen;                  //!< Selected pen
+    HBrush        Brush;                //!< Selected brush
+    HFont         Font;                 //!< Selected font
+    Colour        BackColour = Colour::White;          //!< Background colour
+    Colour        TextColour = Colour::Black;          //!< Text colour
+    DrawingMode   Mode = DrawingMode::Opaque;          //!< Background mix mode
+    DeviceStats   Stats;                               //!< Call counters
+    Transform     View;                                //!< Maps primitive coordinates to device coordinates
+    bool          Transformed = false;                 //!< Whether the transform differs from the identity
+    bool          Antialiased = false;                 //!< Whether edges of shapes are anti-aliased
+    Coverage      Paths;                               //!< Accumulates coverage of anti-aliased shapes
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::DeviceContext
+    //! Create a context without a render target  (Output is discarded)
+    ///////////////////////////////////////////////////////////////////////////////
+    DeviceContext() = default;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::DeviceContext
+    //! Create a context that renders into a framebuffer
+    //!
+    //! \param[in,out] target - Render target
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit DeviceContext(Framebuffer& target) : Target(&target), Extent(target.bounds()), Clip(Extent)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::DeviceContext
+    //! Create a context that records into a command list
+    //!
+    //! \param[in,out] list - Receives commands  (Not cleared)
+    //! \param[in] extent - Drawable area
+    ///////////////////////////////////////////////////////////////////////////////
+    DeviceContext(CommandList& list, const RectL& extent) : Recording(&list), Extent(extent), Clip(extent)
+    {}
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::screenDC
+    //! Get the shared screen context  (Mirrors wtl::DeviceContext::ScreenDC; used for font creation)
+    ///////////////////////////////////////////////////////////////////////////////
+    static DeviceContext& screenDC()
+    {
+      static DeviceContext dc;
+      return dc;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    const RectL&  clipRect() const   { return Clip; }
+    const HPen&   pen() const        { return Pen; }
+    const HBrush& brush() const      { return Brush; }
+    const HFont&  font() const       { return Font; }
+    Colour        backColour() const { return BackColour; }
+    Colour        textColour() const { return TextColour; }
+    DrawingMode   mode() const       { return Mode; }
+    const DeviceStats& stats() const { return Stats; }
+    TextCache*    textCache() const  { return Layouts; }
+    bool          recording() const  { return Recording != nullptr; }
+    const Transform& transform() const { return View; }
+    bool          scaled() const     { return View.scaled(); }
+    bool          antialiased() const { return Antialiased; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::penWidth const
+    //! Get the width of the outline drawn by the current pen
+    ///////////////////////////////////////////////////////////////////////////////
+    int32_t penWidth() const
+    {
+      return Pen.style == PenStyle::Null ? 0 : std::max(1, Pen.width);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::getFont const
+    //! Create a font  (The face name is used only by a text writer; otherwise text uses the portable bitmap font)
+    //!
+    //! \param[in] name - Face name  (String literal)
+    //! \param[in] height - Height in pixels
+    //! \param[in] weight - Weight
+    ///////////////////////////////////////////////////////////////////////////////
+    HFont getFont(const char* name, int32_t height, FontWeight weight = FontWeight::Normal) const
+    {
+      ++objectsCreated();
+      return HFont{height, weight, name};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::hatchRow
+    //! Get one row of the 8x8 pattern of a hatch style
+    //!
+    //! \param[in] style - Hatch style
+    //! \param[in] y - Device y-coordinate
+    //! \return uint8_t - Pattern bits (Bit N set => column N is foreground)
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint8_t hatchRow(HatchStyle style, int32_t y)
+    {
+      return uint8_t(hatchMask(style) >> 8*(y & 7));
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    DeviceContext& operator+= (const HPen& p)     { ++Stats.StateChanges; Pen = p;   return *this; }
+    DeviceContext& operator+= (const HBrush& b)   { ++Stats.StateChanges; Brush = b; return *this; }
+    DeviceContext& operator+= (StockBrush b)      { ++Stats.StateChanges; Brush = HBrush(b); return *this; }
+    DeviceContext& operator+= (const HFont& f)    { ++Stats.StateChanges; Font = f;  return *this; }
+    DeviceContext& operator+= (DrawingMode m)     { ++Stats.StateChanges; Mode = m;  return *this; }
+
+    void setBackColour(Colour c)  { ++Stats.StateChanges; BackColour = c; }
+    void setTextColour(Colour c)  { ++Stats.StateChanges; TextColour = c; }
+
+    void resetStats()             { Stats = DeviceStats(); }
+
+    //! Select the text layout cache  (nullptr lays out and rasterizes text on every call)
+    void setTextCache(TextCache* cache)  { Layouts = cache; }
+
+    //! Install a writer for text in named fonts  (Empty draws all text with the bitmap font; not recorded)
+    void setTextWriter(text_writer_t writer)  { Writer = std::move(writer); }
+
+    //! Set the transform applied to the coordinates of subsequent primitives  (Pens and fonts are not scaled)
+    void setTransform(const Transform& t)  { View = t; Transformed = !t.identity(); }
+
+    //! Enable or disable anti-aliasing of the edges of subsequent ellipses and polygons  (Not recorded)
+    void setAntialias(bool enable)  { Antialiased = enable; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::setClip
+    //! Restrict output to a rectangle  (Always clipped to the render target)
+    ///////////////////////////////////////////////////////////////////////////////
+    void setClip(const RectL& rc)
+    {
+      Clip = Target || Recording ? rc.intersect(Extent) : rc;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::clear
+    //! Restore the default pen, brush and font
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      ++Stats.StateChanges;
+      Pen = HPen();
+      Brush = HBrush();
+      Font = HFont();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::fill
+    //! Fill a rectangle with a brush  (Without outline)
+    ///////////////////////////////////////////////////////////////////////////////
+    void fill(const RectL& area, const HBrush& b)
+    {
+      ++Stats.Primitives;
+      const RectL rc = device(area);
+      if (Recording)
+        return record(CommandList::Command{CommandList::Opcode::Fill, DrawTextFlags(), 0, rc, b, 0, 0, rc.normalized()});
+
+      Rasterizer::rect(rc, Clip, 0, spanFiller(b), [](int32_t, int32_t, int32_t) {});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::rect
+    //! Draw a rectangle outlined with the current pen and filled with the current brush
+    ///////////////////////////////////////////////////////////////////////////////
+    void rect(const RectL& area)
+    {
+      ++Stats.Primitives;
+      const RectL rc = device(area);
+      if (Recording)
+        return record(CommandList::Command{CommandList::Opcode::Rect, DrawTextFlags(), 0, rc, HBrush(), 0, 0, rc.normalized()});
+
+      Rasterizer::rect(rc, Clip, penWidth(), spanFiller(Brush), solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::ellipse
+    //! Draw an ellipse outlined with the current pen and filled with the current brush
+    ///////////////////////////////////////////////////////////////////////////////
+    void ellipse(const RectL& area)
+    {
+      ++Stats.Primitives;
+      const RectL rc = device(area);
+      if (Recording)
+        return record(CommandList::Command{CommandList::Opcode::Ellipse, DrawTextFlags(), 0, rc, HBrush(), 0, 0, rc.normalized()});
+
+      if (Antialiased && Target)
+        return antialiasEllipse(rc.normalized());
+
+      Rasterizer::ellipse(rc, Clip, penWidth(), spanFiller(Brush), solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::triangle
+    //! Draw a triangle outlined with the current pen and filled with the current brush
+    ///////////////////////////////////////////////////////////////////////////////
+    void triangle(const TriangleL& t)
+    {
+      polygon(t.points, 3);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::polygon
+    //! Draw a polygon outlined with the current pen and filled with the current brush
+    ///////////////////////////////////////////////////////////////////////////////
+    template <unsigned N>
+    void polygon(const POINT (&pts)[N])
+    {
+      polygon(pts, N);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::polygon
+    //! Draw a polygon outlined with the current pen and filled with the current brush
+    //!
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    ///////////////////////////////////////////////////////////////////////////////
+    void polygon(const POINT* pts, int32_t count)
+    {
+      ++Stats.Primitives;
+      PointF stack[32];
+      std::vector<PointF> heap;
+      PointF* verts = stack;
+      if (count > 32)
+        heap.resize(count), verts = heap.data();
+
+      // Map each coordinate array in one pass
+      if (Transformed)
+      {
+        int32_t xs[32], ys[32];
+        for (int32_t first = 0; first < count; first += 32)
+        {
+          const int32_t n = std::min(32, count - first);
+          for (int32_t i = 0; i < n; ++i)
+            xs[i] = pts[first+i].x, ys[i] = pts[first+i].y;
+          View.mapX(xs, xs, size_t(n));
+          View.mapY(ys, ys, size_t(n));
+          for (int32_t i = 0; i < n; ++i)
+            verts[first+i] = PointF{ float(xs[i]), float(ys[i]) };
+        }
+      }
+      else
+        for (int32_t i = 0; i < count; ++i)
+          verts[i] = PointF{ float(pts[i].x), float(pts[i].y) };
+
+      if (Recording)
+      {
+        const uint32_t offset = uint32_t(Recording->Points.size());
+        for (int32_t i = 0; i < count; ++i)
+          Recording->Points.push_back(POINT{ int32_t(verts[i].x), int32_t(verts[i].y) });
+        return record(CommandList::Command{CommandList::Opcode::Polygon, DrawTextFlags(), 0, RectL(), HBrush(), offset, uint32_t(count),
+                                           Rasterizer::bounds(verts, count, penWidth())});
+      }
+
+      if (Antialiased && Target)
+        return antialiasPolygon(verts, count);
+
+      Rasterizer::polygon(verts, count, Clip, spanFiller(Brush));
+      if (penWidth())
+        Rasterizer::outline(verts, count, float(penWidth()), Clip, solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::spans
+    //! Draw a pre-tessellated shape with the current pen and brush  (Cannot be recorded or scaled)
+    //!
+    //! \param[in] table - Spans relative to the shape origin
+    //! \param[in] origin - Shape origin
+    ///////////////////////////////////////////////////////////////////////////////
+    template <size_t N>
+    void spans(const SpanTable<N>& table, PointL origin)
+    {
+      ++Stats.Primitives;
+      drawSpans(table.begin(), table.end(), table.Bounds, Transformed ? View(origin) : origin);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::coverage
+    //! Blend a pre-resolved anti-aliased shape with the current pen and brush  (Cannot be recorded or scaled)
+    //!
+    //! \param[in] mask - Coverage relative to the shape origin
+    //! \param[in] origin - Shape origin
+    ///////////////////////////////////////////////////////////////////////////////
+    void coverage(const CoverageMask& mask, PointL origin)
+    {
+      ++Stats.Primitives;
+      if (!Target)
+        return;
+
+      const PointL pt = Transformed ? View(origin) : origin;
+      const RectL bounds(mask.Bounds.left+pt.x, mask.Bounds.top+pt.y, mask.Bounds.right+pt.x, mask.Bounds.bottom+pt.y);
+      if (!bounds.intersects(Clip))
+        return;
+
+      blendLayer(mask.Interior, pt, spanFiller(Brush));
+      blendLayer(mask.Outline, pt, solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::write
+    //! Draw text within a rectangle using the current font, text colour and mix mode
+    //!
+    //! \param[in] text - Text (Lines separated by '\n')
+    //! \param[in] rc - Layout rectangle (Text is clipped to this)
+    //! \param[in] flags - Alignment flags
+    ///////////////////////////////////////////////////////////////////////////////
+    void write(const char* text, const RectL& area, DrawTextFlags flags)
+    {
+      ++Stats.Primitives;
+      const RectL rc = device(area);
+      if (Recording)
+      {
+        const uint32_t offset = uint32_t(Recording->Text.size()),
+                       length = uint32_t(std::strlen(text));
+        Recording->Text.insert(Recording->Text.end(), text, text+length+1);
+        return record(CommandList::Command{CommandList::Opcode::Write, flags, 0, rc, HBrush(), offset, length, rc.normalized()});
+      }
+
+      // Draw named fonts with the text writer, when it can
+      if (Target && Writer && Font.face && Writer(*Target, *this, text, rc, flags))
+        return;
+
+      // Draw cached layout from pre-rasterized glyphs
+      if (Layouts)
+      {
+        const TextCache::layout_t layout = Layouts->layout(text, SizeL(rc.width(), rc.height()), flags, Font);
+        const RectL clip = rc.intersect(Clip);
+        for (const TextLayout::Line& line : layout->Lines)
+          blitLine(*layout, line, PointL(rc.left, rc.top) + line.Origin, clip);
+        return;
+      }
+
+      const int32_t advance = BitmapFont::advance(Font),
+                    lineHeight = BitmapFont::lineHeight(Font);
+
+      // Count lines to support vertical alignment
+      int32_t lines = 1;
+      for (const char* c = text; *c; ++c)
+        lines += (*c == '\n');
+
+      int32_t y = rc.top;
+      if (flags & DrawTextFlags::Bottom)
+        y = rc.bottom - lines*lineHeight;
+      else if (flags & DrawTextFlags::VCentre)
+        y = rc.top + (rc.height() - lines*lineHeight) / 2;
+
+      for (const char* line = text; ; y += lineHeight)
+      {
+        const char* end = line;
+        while (*end && *end != '\n')
+          ++end;
+
+        // Align horizontally
+        const int32_t width = int32_t(end - line) * advance;
+        int32_t x = rc.left;
+        if (flags & DrawTextFlags::Centre)
+          x = rc.left + (rc.width() - width) / 2;
+        else if (flags & DrawTextFlags::Right)
+          x = rc.right - width;
+
+        writeLine(line, int32_t(end - line), PointL(x,y), rc.intersect(Clip));
+
+        if (!*end)
+          break;
+        line = end+1;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::replay
+    //! Execute recorded commands  (Output is additionally clipped to the current clipping rectangle)
+    //!
+    //! \param[in] list - Command list
+    //! \param[in] commands - Indices of commands to execute, in order
+    ///////////////////////////////////////////////////////////////////////////////
+    void replay(const CommandList& list, span<const uint32_t> commands)
+    {
+      replay(list, commands.size(), [&](size_t n) { return commands[n]; });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::replay
+    //! Execute every recorded command  (Output is additionally clipped to the current clipping rectangle)
+    //!
+    //! \param[in] list - Command list
+    ///////////////////////////////////////////////////////////////////////////////
+    void replay(const CommandList& list)
+    {
+      replay(list, list.size(), [](size_t n) { return uint32_t(n); });
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::replay
+    //! Execute a sequence of recorded commands
+    //!
+    //! \param[in] list - Command list
+    //! \param[in] count - Number of commands to execute
+    //! \param[in] index - Callable as index(n) returning the index of the n-th command to execute
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename INDEX>
+    void replay(const CommandList& list, size_t count, INDEX&& index)
+    {
+      // Commands are recorded in device coordinates
+      const RectL base = Clip;
+      const Transform view = View;
+      setTransform(Transform());
+      const ShapeCatalog& shapes = ShapeCatalog::shared();
+      const bool tessellated = Target && !Antialiased;
+      uint32_t current = ~0u;
+
+      for (size_t n = 0; n < count; ++n)
+      {
+        const CommandList::Command& cmd = list.Commands[index(n)];
+
+        // Restore device state  (Unless identical to the state in effect)
+        if (cmd.State != current && (current == ~0u || !(list.States[cmd.State] == list.States[current])))
+        {
+          const CommandList::DrawState& s = list.States[current = cmd.State];
+          ++Stats.StateChanges;
+          Clip = s.Clip.intersect(base);
+          Pen = s.Pen;
+          Brush = s.Brush;
+          Font = s.Font;
+          BackColour = s.BackColour;
+          TextColour = s.TextColour;
+          Mode = s.Mode;
+        }
+
+        // Draw fixed-size shapes from their span tables  (See Graphics)
+        PointL origin;
+        const ShapeCatalog::Entry* shape = nullptr;
+        if (tessellated && cmd.Op == CommandList::Opcode::Ellipse)
+          shape = shapes.ellipse(cmd.Rect, penWidth()), origin = PointL(cmd.Rect.left, cmd.Rect.top);
+        else if (tessellated && cmd.Op == CommandList::Opcode::Polygon)
+          shape = shapes.polygon(&list.Points[cmd.Offset], int32_t(cmd.Count), penWidth(), origin);
+
+        if (shape)
+        {
+          ++Stats.Primitives;
+          drawSpans(shape->Spans, shape->Spans + shape->Count, shape->Bounds, origin);
+          continue;
+        }
+
+        switch (cmd.Op)
+        {
+        case CommandList::Opcode::Fill:     fill(cmd.Rect, cmd.Brush);                                break;
+        case CommandList::Opcode::Rect:     rect(cmd.Rect);                                           break;
+        case CommandList::Opcode::Ellipse:  ellipse(cmd.Rect);                                        break;
+        case CommandList::Opcode::Polygon:  polygon(&list.Points[cmd.Offset], int32_t(cmd.Count));    break;
+        case CommandList::Opcode::Write:    write(&list.Text[cmd.Offset], cmd.Rect, cmd.Flags);       break;
+        }
+      }
+      Clip = base;
+      setTransform(view);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::drawSpans
+    //! Draw spans of a pre-tessellated shape with the current pen and brush
+    //!
+    //! \param[in] first - First span  (Relative to the shape origin)
+    //! \param[in] last - Span beyond the last
+    //! \param[in] extent - Bounding rectangle of all spans  (Relative to the shape origin)
+    //! \param[in] pt - Shape origin in device coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    void drawSpans(const ShapeSpan* first, const ShapeSpan* last, const RectL& extent, PointL pt)
+    {
+      const RectL bounds(extent.left+pt.x, extent.top+pt.y, extent.right+pt.x, extent.bottom+pt.y);
+      if (!bounds.intersects(Clip))
+        return;
+
+      const SpanFiller interior = spanFiller(Brush),
+                       outline = solidFiller(Pen.colour);
+      for (const ShapeSpan* s = first; s != last; ++s)
+      {
+        const int32_t y = s->y + pt.y;
+        if (y >= Clip.top && y < Clip.bottom)
+          Rasterizer::clipSpan(Clip, y, s->x0 + pt.x, s->x1 + pt.x, s->outline ? outline : interior);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::device const
+    //! Map a rectangle into device coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    RectL device(const RectL& rc) const
+    {
+      return Transformed ? View(rc) : rc;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::spanFiller const
+    //! Get a span callback that paints with a brush
+    ///////////////////////////////////////////////////////////////////////////////
+    SpanFiller spanFiller(const HBrush& b) const
+    {
+      return SpanFiller{Target, pixel(b.colour), pixel(BackColour), b.hatch, b.hatched, Mode == DrawingMode::Opaque};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::record
+    //! Append a command and the current device state to the command list  (Unless entirely clipped)
+    ///////////////////////////////////////////////////////////////////////////////
+    void record(CommandList::Command cmd)
+    {
+      cmd.Bounds = cmd.Bounds.intersect(Clip);
+      if (!cmd.Bounds.empty())
+        Recording->add(CommandList::DrawState{Clip, Pen, Brush, Font, BackColour, TextColour, Mode}, cmd);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::blend
+    //! Blend the brush of a span callback into the target in proportion to the coverage of the current path
+    ///////////////////////////////////////////////////////////////////////////////
+    void blend(const SpanFiller& f)
+    {
+      Paths.render(Clip, [&](int32_t y, int32_t x, const uint8_t* alpha, int32_t count) {
+        blendCoverage(Target->row(y) + x, alpha, count, x, f.Hatched ? hatchRow(f.Hatch, y) : 0xFF, f.Fore, f.Back, f.Opaque);
+      });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::antialiasEllipse
+    //! Draw an anti-aliased ellipse: the interior within the pen, then the outline as a ring
+    ///////////////////////////////////////////////////////////////////////////////
+    void antialiasEllipse(const RectL& r)
+    {
+      Paths.clear();
+      Paths.ellipseInterior(r, penWidth());
+      blend(spanFiller(Brush));
+
+      Paths.clear();
+      Paths.ellipseOutline(r, penWidth());
+      blend(solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::antialiasPolygon
+    //! Draw an anti-aliased polygon: the interior, then the outline as one path of thick segments
+    ///////////////////////////////////////////////////////////////////////////////
+    void antialiasPolygon(const PointF* verts, int32_t count)
+    {
+      Paths.clear();
+      Paths.polygon(verts, count);
+      blend(spanFiller(Brush));
+
+      Paths.clear();
+      Paths.polygonOutline(verts, count, penWidth());
+      blend(solidFiller(Pen.colour));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::blendLayer
+    //! Blend the brush of a span callback into the target in proportion to a layer of a coverage mask
+    //!
+    //! \param[in] layer - Coverage relative to the shape origin
+    //! \param[in] pt - Shape origin in device coordinates
+    //! \param[in] f - Brush
+    ///////////////////////////////////////////////////////////////////////////////
+    void blendLayer(const CoverageMask::Layer& layer, PointL pt, const SpanFiller& f)
+    {
+      for (const CoverageMask::Run& run : layer.Runs)
+      {
+        const int32_t y = run.y + pt.y;
+        if (y < Clip.top || y >= Clip.bottom)
+          continue;
+
+        const int32_t x0 = std::max(run.x + pt.x, Clip.left),
+                      x1 = std::min(run.x + pt.x + run.count, Clip.right);
+        if (x0 < x1)
+          blendCoverage(Target->row(y) + x0, &layer.Alpha[run.offset + (x0 - run.x - pt.x)], x1 - x0, x0,
+                        f.Hatched ? hatchRow(f.Hatch, y) : 0xFF, f.Fore, f.Back, f.Opaque);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::solidFiller const
+    //! Get a span callback that paints with a solid colour
+    ///////////////////////////////////////////////////////////////////////////////
+    SpanFiller solidFiller(Colour c) const
+    {
+      return SpanFiller{Target, pixel(c), pixel(c), HatchStyle::Horizontal, false, false};
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::blitLine
+    //! Draw a single line of text by copying glyphs from the atlas
+    //!
+    //! \param[in] layout - Text layout
+    //! \param[in] line - Line within layout
+    //! \param[in] origin - Top-left of first character cell
+    //! \param[in] clip - Clipping rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    void blitLine(const TextLayout& layout, const TextLayout::Line& line, PointL origin, const RectL& clip)
+    {
+      if (!Target || line.Length == 0)
+        return;
+
+      // Opaque mode fills the text cells with the background colour
+      const RectL cells(origin, SizeL(int32_t(line.Length)*layout.Advance, layout.Height));
+      if (Mode == DrawingMode::Opaque)
+        Rasterizer::rect(cells, clip, 0, solidFiller(BackColour), [](int32_t, int32_t, int32_t) {});
+
+      const RectL visible = cells.intersect(clip);
+      if (visible.empty())
+        return;
+
+      // Copy the ink of each visible glyph
+      const uint32_t fore = pixel(TextColour);
+      const int32_t first = (visible.left - origin.x) / layout.Advance,
+                    last = (visible.right-1 - origin.x) / layout.Advance;
+      for (int32_t cell = first; cell <= last; ++cell)
+      {
+        const GlyphAtlas::Glyph* glyph = layout.Glyphs[line.First + cell];
+        if (!glyph)
+          continue;
+
+        const int32_t gx = origin.x + cell*layout.Advance,
+                      x0 = std::max(gx, visible.left),
+                      x1 = std::min(gx + layout.Advance, visible.right);
+        for (int32_t y = visible.top; y < visible.bottom; ++y)
+        {
+          const uint8_t* src = glyph->Pixels + size_t(y - origin.y)*glyph->Pitch + (x0 - gx);
+          uint32_t* dst = Target->row(y) + x0;
+          for (int32_t i = 0; i < x1-x0; ++i)
+            if (src[i])
+              dst[i] = fore;
+        }
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DeviceContext::writeLine
+    //! Draw a single line of text
+    //!
+    //! \param[in] text - First character
+    //! \param[in] length - Number of characters
+    //! \param[in] origin - Top-left of first character cell
+    //! \param[in] clip - Clipping rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    void writeLine(const char* text, int32_t length, PointL origin, const RectL& clip)
+    {
+      const int32_t scaleX = BitmapFont::scaleX(Font),
+                    scaleY = BitmapFont::scaleY(Font),
+                    advance = BitmapFont::advance(Font);
+      const bool bold = Font.weight >= FontWeight::Bold;
+      const uint32_t fore = pixel(TextColour);
+
+      if (!Target || length == 0)
+        return;
+
+      // Opaque mode fills the text cells with the background colour
+      const RectL cells(origin, SizeL(length*advance, BitmapFont::lineHeight(Font)));
+      if (Mode == DrawingMode::Opaque)
+        Rasterizer::rect(cells, clip, 0, solidFiller(BackColour), [](int32_t, int32_t, int32_t) {});
+
+      const RectL visible = cells.intersect(clip);
+      for (int32_t y = visible.top; y < visible.bottom; ++y)
+      {
+        const int32_t glyphRow = (y - origin.y) / scaleY;
+        uint32_t* dst = Target->row(y);
+
+        for (int32_t x = visible.left; x < visible.right; ++x)
+        {
+          const int32_t cell = (x - origin.x) / advance,
+                        glyphCol = ((x - origin.x) % advance) / scaleX;
+          if (BitmapFont::row(text[cell], glyphRow, bold) & (1u << glyphCol))
+            dst[x] = fore;
+        }
+      }
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\DisplayList.h
+//! \brief Defines recorded frames that can be serialized, stored and replayed
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_DISPLAY_LIST_H
+#define RENDER_DISPLAY_LIST_H
+
+#include <algorithm>          //!< std::equal
+#include <cstdio>             //!< std::fopen
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+#include "CommandList.h"      //!< hw1::render::CommandList
+#include "DeviceContext.h"    //!< hw1::render::DeviceContext
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct DisplayList - A recorded frame with a flat, versioned binary encoding
+  //!
+  //! A frame is recorded once through a recording DeviceContext and can then be replayed
+  //! into any framebuffer (directly, or tiled on several threads) without re-running the
+  //! scene's drawing code or its random number generator.
+  //!
+  //! The encoding is little-endian and unpadded: a 40-byte header followed by fixed-size
+  //! device state and command records, polygon vertices, then null-terminated text. Equal
+  //! frames therefore encode to equal bytes, and two encodings can be compared record by
+  //! record.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct DisplayList
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Magic - File signature  ('HW1D')
+    static constexpr uint32_t Magic = 0x44315748;
+    //! \var Version - Encoding version
+    static constexpr uint16_t Version = 1;
+
+    //! \var HeaderSize - Encoded size of the header
+    static constexpr size_t HeaderSize = 40;
+    //! \var StateSize - Encoded size of a device state
+    static constexpr size_t StateSize = 48;
+    //! \var CommandSize - Encoded size of a command
+    static constexpr size_t CommandSize = 55;
+    //! \var PointSize - Encoded size of a polygon vertex
+    static constexpr size_t PointSize = 8;
+
+  private:
+    //! \struct Writer - Stores little-endian fields
+    struct Writer
+    {
+      uint8_t*  Pos;
+
+      void u8(uint8_t v)    { *Pos++ = v; }
+      void u16(uint16_t v)  { u8(uint8_t(v));  u8(uint8_t(v >> 8)); }
+      void u32(uint32_t v)  { u16(uint16_t(v)); u16(uint16_t(v >> 16)); }
+      void i32(int32_t v)   { u32(uint32_t(v)); }
+      void rect(const RectL& r) { i32(r.left); i32(r.top); i32(r.right); i32(r.bottom); }
+    };
+
+    //! \struct Reader - Consumes little-endian fields
+    struct Reader
+    {
+      const uint8_t*  Pos;
+
+      uint8_t  u8()   { return *Pos++; }
+      uint16_t u16()  { const uint16_t lo = u8();  return uint16_t(lo | (u8() << 8)); }
+      uint32_t u32()  { const uint32_t lo = u16(); return lo | (uint32_t(u16()) << 16); }
+      int32_t  i32()  { return int32_t(u32()); }
+      RectL    rect() { RectL r; r.left = i32(); r.top = i32(); r.right = i32(); r.bottom = i32(); return r; }
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  public:
+    RectL        Extent;          //!< Drawable area of the recorded frame
+    CommandList  Commands;        //!< Recorded commands
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool    empty() const { return Commands.empty(); }
+    size_t  size() const  { return Commands.size(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::replay const
+    //! Execute every recorded command  (Output is clipped to the context's clipping rectangle)
+    ///////////////////////////////////////////////////////////////////////////////
+    void replay(DeviceContext& dc) const
+    {
+      dc.replay(Commands);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::mismatch const
+    //! Find the first command that differs from another list
+    //!
+    //! Commands are equal when their opcodes, geometry, text and device state are equal.
+    //!
+    //! \param[in] r - Other list
+    //! \return size_t - Index of first differing command, or the length of both if they are equal
+    ///////////////////////////////////////////////////////////////////////////////
+    size_t mismatch(const DisplayList& r) const
+    {
+      const CommandList& a = Commands;
+      const CommandList& b = r.Commands;
+      const size_t n = std::min(a.size(), b.size());
+
+      for (size_t idx = 0; idx < n; ++idx)
+      {
+        const CommandList::Command& x = a.Commands[idx];
+        const CommandList::Command& y = b.Commands[idx];
+        if (x.Op != y.Op || x.Flags != y.Flags || !(x.Rect == y.Rect) || !(x.Bounds == y.Bounds)
+         || !(a.States[x.State] == b.States[y.State]) || x.Count != y.Count)
+          return idx;
+
+        switch (x.Op)
+        {
+        case CommandList::Opcode::Fill:
+          if (x.Brush.colour != y.Brush.colour || x.Brush.hatch != y.Brush.hatch || x.Brush.hatched != y.Brush.hatched)
+            return idx;
+          break;
+        case CommandList::Opcode::Polygon:
+          for (uint32_t v = 0; v < x.Count; ++v)
+            if (a.Points[x.Offset+v].x != b.Points[y.Offset+v].x || a.Points[x.Offset+v].y != b.Points[y.Offset+v].y)
+              return idx;
+          break;
+        case CommandList::Opcode::Write:
+          if (!std::equal(&a.Text[x.Offset], &a.Text[x.Offset] + x.Count, &b.Text[y.Offset]))
+            return idx;
+          break;
+        default:
+          break;
+        }
+      }
+      return n;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::serialize const
+    //! Encode the list
+    //!
+    //! \param[out] out - Encoding  (Replaces existing contents)
+    ///////////////////////////////////////////////////////////////////////////////
+    void serialize(std::vector<uint8_t>& out) const
+    {
+      const CommandList& list = Commands;
+      out.resize(HeaderSize + list.States.size()*StateSize + list.Commands.size()*CommandSize
+               + list.Points.size()*PointSize + list.Text.size());
+      Writer w{out.data()};
+
+      // Header
+      w.u32(Magic);
+      w.u16(Version);
+      w.u16(0);
+      w.rect(Extent);
+      w.u32(uint32_t(list.States.size()));
+      w.u32(uint32_t(list.Commands.size()));
+      w.u32(uint32_t(list.Points.size()));
+      w.u32(uint32_t(list.Text.size()));
+
+      for (const CommandList::DrawState& s : list.States)
+      {
+        w.rect(s.Clip);
+        w.u8(uint8_t(s.Pen.style));
+        w.i32(s.Pen.width);
+        w.u32(uint32_t(s.Pen.colour));
+        w.u32(uint32_t(s.Brush.colour));
+        w.u8(uint8_t(s.Brush.hatch));
+        w.u8(s.Brush.hatched ? 1 : 0);
+        w.i32(s.Font.height);
+        w.i32(int32_t(s.Font.weight));
+        w.u32(uint32_t(s.BackColour));
+        w.u32(uint32_t(s.TextColour));
+        w.u8(uint8_t(s.Mode));
+      }
+
+      for (const CommandList::Command& c : list.Commands)
+      {
+        w.u8(uint8_t(c.Op));
+        w.u32(uint32_t(c.Flags));
+        w.u32(c.State);
+        w.rect(c.Rect);
+        w.u32(uint32_t(c.Brush.colour));
+        w.u8(uint8_t(c.Brush.hatch));
+        w.u8(c.Brush.hatched ? 1 : 0);
+        w.u32(c.Offset);
+        w.u32(c.Count);
+        w.rect(c.Bounds);
+      }
+
+      for (const POINT& pt : list.Points)
+      {
+        w.i32(pt.x);
+        w.i32(pt.y);
+      }
+
+      std::copy(list.Text.begin(), list.Text.end(), w.Pos);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::record
+    //! Record a frame
+    //!
+    //! \param[in] extent - Drawable area
+    //! \param[in] draw - Callable as draw(DeviceContext&) that issues the frame's drawing commands
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename DRAW>
+    void record(const RectL& extent, DRAW&& draw)
+    {
+      Extent = extent;
+      Commands.clear();
+      DeviceContext recorder(Commands, extent);
+      draw(recorder);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::deserialize
+    //! Decode a list, validating every index and offset
+    //!
+    //! \param[in] data - Encoding
+    //! \param[in] size - Length of encoding, in bytes
+    //! \return bool - False if the encoding is malformed or of an unknown version  (List is then empty)
+    ///////////////////////////////////////////////////////////////////////////////
+    bool deserialize(const uint8_t* data, size_t size)
+    {
+      CommandList& list = Commands;
+      list.clear();
+      if (size < HeaderSize)
+        return false;
+
+      // Header
+      Reader r{data};
+      if (r.u32() != Magic || r.u16() != Version)
+        return false;
+      r.u16();
+      Extent = r.rect();
+      const uint32_t states = r.u32(),
+                     commands = r.u32(),
+                     points = r.u32(),
+                     text = r.u32();
+      if (size != HeaderSize + uint64_t(states)*StateSize + uint64_t(commands)*CommandSize + uint64_t(points)*PointSize + text)
+        return false;
+
+      list.States.resize(states);
+      for (CommandList::DrawState& s : list.States)
+      {
+        s.Clip = r.rect();
+        s.Pen.style = PenStyle(r.u8());
+        s.Pen.width = r.i32();
+        s.Pen.colour = Colour(r.u32());
+        s.Brush.colour = Colour(r.u32());
+        s.Brush.hatch = HatchStyle(r.u8());
+        s.Brush.hatched = r.u8() != 0;
+        s.Font.height = r.i32();
+        s.Font.weight = FontWeight(r.i32());
+        s.BackColour = Colour(r.u32());
+        s.TextColour = Colour(r.u32());
+        s.Mode = DrawingMode(r.u8());
+        if (s.Brush.hatch > HatchStyle::CrossDiagonal)
+          return fail();
+      }
+
+      list.Commands.resize(commands);
+      for (CommandList::Command& c : list.Commands)
+      {
+        c.Op = CommandList::Opcode(r.u8());
+        c.Flags = DrawTextFlags(r.u32());
+        c.State = r.u32();
+        c.Rect = r.rect();
+        c.Brush.colour = Colour(r.u32());
+        c.Brush.hatch = HatchStyle(r.u8());
+        c.Brush.hatched = r.u8() != 0;
+        c.Offset = r.u32();
+        c.Count = r.u32();
+        c.Bounds = r.rect();
+
+        // Reject references outside the list
+        if (c.Op > CommandList::Opcode::Write || c.State >= states || c.Brush.hatch > HatchStyle::CrossDiagonal
+         || (c.Op == CommandList::Opcode::Polygon && uint64_t(c.Offset) + c.Count > points)
+         || (c.Op == CommandList::Opcode::Write && uint64_t(c.Offset) + c.Count >= text))
+          return fail();
+      }
+
+      list.Points.resize(points);
+      for (POINT& pt : list.Points)
+      {
+        pt.x = r.i32();
+        pt.y = r.i32();
+      }
+
+      list.Text.assign(r.Pos, r.Pos + text);
+
+      // Text must be null-terminated where each command ends
+      for (const CommandList::Command& c : list.Commands)
+        if (c.Op == CommandList::Opcode::Write && list.Text[c.Offset + c.Count] != '\0')
+          return fail();
+      return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::save const
+    //! Write the encoding to a file
+    //!
+    //! \return bool - False if the file could not be written
+    ///////////////////////////////////////////////////////////////////////////////
+    bool save(const char* path) const
+    {
+      std::vector<uint8_t> bytes;
+      serialize(bytes);
+
+      FILE* out = std::fopen(path, "wb");
+      if (!out)
+        return false;
+      const bool written = std::fwrite(bytes.data(), 1, bytes.size(), out) == bytes.size();
+      return std::fclose(out) == 0 && written;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::load
+    //! Read and decode a file
+    //!
+    //! \return bool - False if the file could not be read or is malformed
+    ///////////////////////////////////////////////////////////////////////////////
+    bool load(const char* path)
+    {
+      FILE* in = std::fopen(path, "rb");
+      if (!in)
+        return false;
+
+      std::vector<uint8_t> bytes;
+      uint8_t block[65536];
+      for (size_t n; (n = std::fread(block, 1, sizeof(block), in)) != 0; )
+        bytes.insert(bytes.end(), block, block + n);
+      std::fclose(in);
+
+      return deserialize(bytes.data(), bytes.size());
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // DisplayList::fail
+    //! Discard a partially decoded list
+    ///////////////////////////////////////////////////////////////////////////////
+    bool fail()
+    {
+      Commands.clear();
+      return false;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
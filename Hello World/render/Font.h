@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Font.h
+//! \brief Defines the portable 8x8 bitmap font used for headless text rendering
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_FONT_H
+#define RENDER_FONT_H
+
+#include "Types.h"            //!< hw1::render::HFont
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct BitmapFont - Fixed-pitch 8x8 font covering printable ASCII
+  //!
+  //! Each glyph is eight rows of eight bits, least significant bit leftmost. Glyphs are
+  //! scaled by integer factors derived from the font height; bold fonts are emboldened
+  //! by smearing each row one pixel rightwards.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct BitmapFont
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var CellSize - Glyph cell dimensions in unscaled pixels
+    static constexpr int32_t CellSize = 8;
+
+    //! \var First - First printable character
+    static constexpr char First = 0x20;
+
+    //! \var Last - Last printable character
+    static constexpr char Last = 0x7E;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::scaleX
+    //! Get the horizontal scale factor for a font  (Glyphs are twice as tall as wide)
+    ///////////////////////////////////////////////////////////////////////////////
+    static int32_t scaleX(const HFont& f)
+    {
+      return std::max(1, f.height / (2*CellSize));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::scaleY
+    //! Get the vertical scale factor for a font
+    ///////////////////////////////////////////////////////////////////////////////
+    static int32_t scaleY(const HFont& f)
+    {
+      return std::max(1, f.height / CellSize);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::advance
+    //! Get the horizontal advance of every character in a font  (Bold glyphs are one column wider)
+    ///////////////////////////////////////////////////////////////////////////////
+    static int32_t advance(const HFont& f)
+    {
+      return (CellSize + (f.weight >= FontWeight::Bold ? 1 : 0)) * scaleX(f);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::lineHeight
+    //! Get the vertical advance of each line in a font
+    ///////////////////////////////////////////////////////////////////////////////
+    static int32_t lineHeight(const HFont& f)
+    {
+      return CellSize * scaleY(f);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::row
+    //! Get one row of an (unscaled) glyph, emboldened if necessary
+    //!
+    //! \param[in] ch - Character (Non-printable characters are blank)
+    //! \param[in] y - Row index [0,8)
+    //! \param[in] bold - Whether to embolden
+    //! \return uint16_t - Row bits, LSB leftmost (Bold glyphs may occupy nine bits)
+    ///////////////////////////////////////////////////////////////////////////////
+    static uint16_t row(char ch, int32_t y, bool bold)
+    {
+      if (ch < First || ch > Last)
+        return 0;
+
+      const uint16_t bits = glyphs()[ch - First][y];
+      return bold ? uint16_t(bits | (bits << 1)) : bits;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // BitmapFont::glyphs
+    //! Get the glyph table
+    ///////////////////////////////////////////////////////////////////////////////
+    static const uint8_t (&glyphs())[Last-First+1][CellSize]
+    {
+      static const uint8_t table[Last-First+1][CellSize] =
+      {
+        {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, {0x18,0x3C,0x3C,0x18,0x18,0x00,0x18,0x00},   // ' ' '!'
+        {0x36,0x36,0x00,0x00,0x00,0x00,0x00,0x00}, {0x36,0x36,0x7F,0x36,0x7F,0x36,0x36,0x00},   // '"' '#'
+        {0x0C,0x3E,0x03,0x1E,0x30,0x1F,0x0C,0x00}, {0x00,0x63,0x33,0x18,0x0C,0x66,0x63,0x00},   // '$' '%'
+        {0x1C,0x36,0x1C,0x6E,0x3B,0x33,0x6E,0x00}, {0x06,0x06,0x03,0x00,0x00,0x00,0x00,0x00},   // '&' '''
+        {0x18,0x0C,0x06,0x06,0x06,0x0C,0x18,0x00}, {0x06,0x0C,0x18,0x18,0x18,0x0C,0x06,0x00},   // '(' ')'
+        {0x00,0x66,0x3C,0xFF,0x3C,0x66,0x00,0x00}, {0x00,0x0C,0x0C,0x3F,0x0C,0x0C,0x00,0x00},   // '*' '+'
+        {0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x06}, {0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00},   // ',' '-'
+        {0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x00}, {0x60,0x30,0x18,0x0C,0x06,0x03,0x01,0x00},   // '.' '/'
+        {0x3E,0x63,0x73,0x7B,0x6F,0x67,0x3E,0x00}, {0x0C,0x0E,0x0C,0x0C,0x0C,0x0C,0x3F,0x00},   // '0' '1'
+        {0x1E,0x33,0x30,0x1C,0x06,0x33,0x3F,0x00}, {0x1E,0x33,0x30,0x1C,0x30,0x33,0x1E,0x00},   // '2' '3'
+        {0x38,0x3C,0x36,0x33,0x7F,0x30,0x78,0x00}, {0x3F,0x03,0x1F,0x30,0x30,0x33,0x1E,0x00},   // '4' '5'
+        {0x1C,0x06,0x03,0x1F,0x33,0x33,0x1E,0x00}, {0x3F,0x33,0x30,0x18,0x0C,0x0C,0x0C,0x00},   // '6' '7'
+        {0x1E,0x33,0x33,0x1E,0x33,0x33,0x1E,0x00}, {0x1E,0x33,0x33,0x3E,0x30,0x18,0x0E,0x00},   // '8' '9'
+        {0x00,0x0C,0x0C,0x00,0x00,0x0C,0x0C,0x00}, {0x00,0x0C,0x0C,0x00,0x00,0x0C,0x0C,0x06},   // ':' ';'
+        {0x18,0x0C,0x06,0x03,0x06,0x0C,0x18,0x00}, {0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00},   // '<' '='
+        {0x06,0x0C,0x18,0x30,0x18,0x0C,0x06,0x00}, {0x1E,0x33,0x30,0x18,0x0C,0x00,0x0C,0x00},   // '>' '?'
+        {0x3E,0x63,0x7B,0x7B,0x7B,0x03,0x1E,0x00}, {0x0C,0x1E,0x33,0x33,0x3F,0x33,0x33,0x00},   // '@' 'A'
+        {0x3F,0x66,0x66,0x3E,0x66,0x66,0x3F,0x00}, {0x3C,0x66,0x03,0x03,0x03,0x66,0x3C,0x00},   // 'B' 'C'
+        {0x1F,0x36,0x66,0x66,0x66,0x36,0x1F,0x00}, {0x7F,0x46,0x16,0x1E,0x16,0x46,0x7F,0x00},   // 'D' 'E'
+        {0x7F,0x46,0x16,0x1E,0x16,0x06,0x0F,0x00}, {0x3C,0x66,0x03,0x03,0x73,0x66,0x7C,0x00},   // 'F' 'G'
+        {0x33,0x33,0x33,0x3F,0x33,0x33,0x33,0x00}, {0x1E,0x0C,0x0C,0x0C,0x0C,0x0C,0x1E,0x00},   // 'H' 'I'
+        {0x78,0x30,0x30,0x30,0x33,0x33,0x1E,0x00}, {0x67,0x66,0x36,0x1E,0x36,0x66,0x67,0x00},   // 'J' 'K'
+        {0x0F,0x06,0x06,0x06,0x46,0x66,0x7F,0x00}, {0x63,0x77,0x7F,0x7F,0x6B,0x63,0x63,0x00},   // 'L' 'M'
+        {0x63,0x67,0x6F,0x7B,0x73,0x63,0x63,0x00}, {0x1C,0x36,0x63,0x63,0x63,0x36,0x1C,0x00},   // 'N' 'O'
+        {0x3F,0x66,0x66,0x3E,0x06,0x06,0x0F,0x00}, {0x1E,0x33,0x33,0x33,0x3B,0x1E,0x38,0x00},   // 'P' 'Q'
+        {0x3F,0x66,0x66,0x3E,0x36,0x66,0x67,0x00}, {0x1E,0x33,0x07,0x0E,0x38,0x33,0x1E,0x00},   // 'R' 'S'
+        {0x3F,0x2D,0x0C,0x0C,0x0C,0x0C,0x1E,0x00}, {0x33,0x33,0x33,0x33,0x33,0x33,0x3F,0x00},   // 'T' 'U'
+        {0x33,0x33,0x33,0x33,0x33,0x1E,0x0C,0x00}, {0x63,0x63,0x63,0x6B,0x7F,0x77,0x63,0x00},   // 'V' 'W'
+        {0x63,0x63,0x36,0x1C,0x1C,0x36,0x63,0x00}, {0x33,0x33,0x33,0x1E,0x0C,0x0C,0x1E,0x00},   // 'X' 'Y'
+        {0x7F,0x63,0x31,0x18,0x4C,0x66,0x7F,0x00}, {0x1E,0x06,0x06,0x06,0x06,0x06,0x1E,0x00},   // 'Z' '['
+        {0x03,0x06,0x0C,0x18,0x30,0x60,0x40,0x00}, {0x1E,0x18,0x18,0x18,0x18,0x18,0x1E,0x00},   // '\' ']'
+        {0x08,0x1C,0x36,0x63,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF},   // '^' '_'
+        {0x0C,0x0C,0x18,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x1E,0x30,0x3E,0x33,0x6E,0x00},   // '`' 'a'
+        {0x07,0x06,0x06,0x3E,0x66,0x66,0x3B,0x00}, {0x00,0x00,0x1E,0x33,0x03,0x33,0x1E,0x00},   // 'b' 'c'
+        {0x38,0x30,0x30,0x3E,0x33,0x33,0x6E,0x00}, {0x00,0x00,0x1E,0x33,0x3F,0x03,0x1E,0x00},   // 'd' 'e'
+        {0x1C,0x36,0x06,0x0F,0x06,0x06,0x0F,0x00}, {0x00,0x00,0x6E,0x33,0x33,0x3E,0x30,0x1F},   // 'f' 'g'
+        {0x07,0x06,0x36,0x6E,0x66,0x66,0x67,0x00}, {0x0C,0x00,0x0E,0x0C,0x0C,0x0C,0x1E,0x00},   // 'h' 'i'
+        {0x30,0x00,0x30,0x30,0x30,0x33,0x33,0x1E}, {0x07,0x06,0x66,0x36,0x1E,0x36,0x67,0x00},   // 'j' 'k'
+        {0x0E,0x0C,0x0C,0x0C,0x0C,0x0C,0x1E,0x00}, {0x00,0x00,0x33,0x7F,0x7F,0x6B,0x63,0x00},   // 'l' 'm'
+        {0x00,0x00,0x1F,0x33,0x33,0x33,0x33,0x00}, {0x00,0x00,0x1E,0x33,0x33,0x33,0x1E,0x00},   // 'n' 'o'
+        {0x00,0x00,0x3B,0x66,0x66,0x3E,0x06,0x0F}, {0x00,0x00,0x6E,0x33,0x33,0x3E,0x30,0x78},   // 'p' 'q'
+        {0x00,0x00,0x3B,0x6E,0x66,0x06,0x0F,0x00}, {0x00,0x00,0x3E,0x03,0x1E,0x30,0x1F,0x00},   // 'r' 's'
+        {0x08,0x0C,0x3E,0x0C,0x0C,0x2C,0x18,0x00}, {0x00,0x00,0x33,0x33,0x33,0x33,0x6E,0x00},   // 't' 'u'
+        {0x00,0x00,0x33,0x33,0x33,0x1E,0x0C,0x00}, {0x00,0x00,0x63,0x6B,0x7F,0x7F,0x36,0x00},   // 'v' 'w'
+        {0x00,0x00,0x63,0x36,0x1C,0x36,0x63,0x00}, {0x00,0x00,0x33,0x33,0x33,0x3E,0x30,0x1F},   // 'x' 'y'
+        {0x00,0x00,0x3F,0x19,0x0C,0x26,0x3F,0x00}, {0x38,0x0C,0x0C,0x07,0x0C,0x0C,0x38,0x00},   // 'z' '{'
+        {0x18,0x18,0x18,0x00,0x18,0x18,0x18,0x00}, {0x07,0x0C,0x0C,0x38,0x0C,0x0C,0x07,0x00},   // '|' '}'
+        {0x6E,0x3B,0x00,0x00,0x00,0x00,0x00,0x00},                                             // '~'
+      };
+      return table;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
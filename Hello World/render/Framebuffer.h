@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Framebuffer.h
+//! \brief Defines the in-memory 32-bit render target
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_FRAMEBUFFER_H
+#define RENDER_FRAMEBUFFER_H
+
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+#include "Spans.h"            //!< hw1::render::fillSpan
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Framebuffer - 32-bit 0xAARRGGBB pixel surface with rows padded to 32 bytes
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Framebuffer
+  {
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    int32_t                Width = 0,       //!< Width in pixels
+                           Height = 0,      //!< Height in pixels
+                           Pitch = 0,       //!< Row stride in pixels
+                           Top = 0;         //!< Frame row of the first row  (Non-zero for a band of a larger frame)
+    std::vector<uint32_t>  Pixels;          //!< Pixel storage
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    Framebuffer() = default;
+
+    Framebuffer(int32_t width, int32_t height)
+    {
+      resize(width, height);
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    int32_t  width() const  { return Width;  }
+    int32_t  height() const { return Height; }
+    int32_t  pitch() const  { return Pitch;  }
+    int32_t  top() const    { return Top;    }
+    RectL    bounds() const { return RectL(0, Top, Width, Top+Height); }
+
+    //! Get a row by its frame row  (Between top() and top()+height())
+    const uint32_t* row(int32_t y) const { return Pixels.data() + size_t(y-Top)*Pitch; }
+    uint32_t*       row(int32_t y)       { return Pixels.data() + size_t(y-Top)*Pitch; }
+
+    uint32_t  at(int32_t x, int32_t y) const { return row(y)[x]; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Framebuffer::operator== const
+    //! Compare visible pixels of two surfaces
+    ///////////////////////////////////////////////////////////////////////////////
+    bool operator== (const Framebuffer& r) const
+    {
+      if (Width != r.Width || Height != r.Height)
+        return false;
+
+      for (int32_t y = 0; y < Height; ++y)
+        if (!std::equal(row(Top+y), row(Top+y)+Width, r.row(r.Top+y)))
+          return false;
+      return true;
+    }
+
+    bool operator!= (const Framebuffer& r) const { return !operator==(r); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Framebuffer::resize
+    //! Reallocate the surface  (Contents are undefined)
+    ///////////////////////////////////////////////////////////////////////////////
+    void resize(int32_t width, int32_t height)
+    {
+      Width = width;
+      Height = height;
+      Pitch = (width + 7) & ~7;
+      Pixels.assign(size_t(Pitch)*height, 0);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Framebuffer::offset
+    //! Position the surface as a band of rows within a larger frame  (Contents are unchanged)
+    //!
+    //! Devices draw into a band using frame coordinates; rows outside the band must be clipped.
+    //!
+    //! \param[in] top - Frame row of the first row of the surface
+    ///////////////////////////////////////////////////////////////////////////////
+    void offset(int32_t top)
+    {
+      Top = top;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Framebuffer::fill
+    //! Fill a rectangle with a pixel value  (Clipped to the surface)
+    ///////////////////////////////////////////////////////////////////////////////
+    void fill(const RectL& rc, uint32_t value)
+    {
+      RectL r = rc.intersect(bounds());
+      if (r.empty())
+        return;
+
+      for (int32_t y = r.top; y < r.bottom; ++y)
+        fillSpan(row(y) + r.left, r.width(), value);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Framebuffer::stretch
+    //! Fill the surface with another surface scaled to fit  (Nearest neighbour)
+    //!
+    //! \param[in] src - Source surface
+    ///////////////////////////////////////////////////////////////////////////////
+    void stretch(const Framebuffer& src)
+    {
+      if (!src.Width || !src.Height)
+        return;
+
+      // Sample pixel centres in 16.16 fixed point
+      const uint32_t dx = uint32_t((uint64_t(src.Width) << 16) / std::max(Width, 1)),
+                     dy = uint32_t((uint64_t(src.Height) << 16) / std::max(Height, 1));
+      for (int32_t y = 0; y < Height; ++y)
+      {
+        const uint32_t* in = src.row(src.Top + int32_t((y * uint64_t(dy) + dy/2) >> 16));
+        uint32_t* out = row(Top+y);
+        for (uint32_t x = 0, sx = dx/2; x < uint32_t(Width); ++x, sx += dx)
+          out[x] = in[sx >> 16];
+      }
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
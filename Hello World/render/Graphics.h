@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Graphics.h
+//! \brief Binds the software renderer to the scene drawing interface
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_GRAPHICS_H
+#define RENDER_GRAPHICS_H
+
+#include <type_traits>        //!< std::extent
+#include "Types.h"            //!< hw1::render::PointL
+#include "DeviceContext.h"    //!< hw1::render::DeviceContext
+#include "Coverage.h"         //!< hw1::render::CoverageMask
+#include "Tessellator.h"      //!< hw1::render::EllipseSpans
+#include "ShapeCatalog.h"     //!< hw1::render::ShapeCatalog
+#include "Transform.h"        //!< hw1::render::Transform
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Graphics - Drawing vocabulary of the software renderer  (See hw1::WtlGraphics)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Graphics
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    using char_t        = char;
+    using DeviceContext = render::DeviceContext;
+    using POINT         = render::POINT;
+    using PointL        = render::PointL;
+    using SizeL         = render::SizeL;
+    using RectL         = render::RectL;
+    using TriangleL     = render::TriangleL;
+    using Colour        = render::Colour;
+    using StockBrush    = render::StockBrush;
+    using HatchStyle    = render::HatchStyle;
+    using PenStyle      = render::PenStyle;
+    using DrawingMode   = render::DrawingMode;
+    using DrawTextFlags = render::DrawTextFlags;
+    using FontWeight    = render::FontWeight;
+    using HPen          = render::HPen;
+    using HBrush        = render::HBrush;
+    using HFont         = render::HFont;
+
+    //! \var TessellatedPen - Outline width for which fixed-size shapes are tessellated at compile time
+    static constexpr int32_t TessellatedPen = 2;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    static const char* c_str(const char* str)
+    {
+      return render::c_str(str);
+    }
+
+    //! Get the shared screen context  (Used for font creation)
+    static DeviceContext& screenDC()
+    {
+      return DeviceContext::screenDC();
+    }
+
+    //! Get the primitive counter of a device context  (Used by HW1_PROFILE_SCOPE)
+    static const uint64_t* primitives(const DeviceContext& dc)
+    {
+      return &dc.stats().Primitives;
+    }
+
+    //! Set the pan/zoom transform applied to subsequent primitives
+    static void transform(DeviceContext& dc, const Transform& view)
+    {
+      dc.setTransform(view);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Graphics::ellipse
+    //! Draw an ellipse of fixed size from spans tessellated at compile time
+    //!
+    //! The span table is catalogued upon first use, so recordings of the ellipse replay from it too.
+    //! Anti-aliased contexts blend a coverage mask resolved upon first use instead.
+    //!
+    //! \tparam W - Width  (May be negative)
+    //! \tparam H - Height  (May be negative)
+    //! \param[in,out] dc - Device context
+    //! \param[in] pt - Corner of bounding rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    template <int32_t W, int32_t H>
+    static void ellipse(DeviceContext& dc, PointL pt)
+    {
+      static const bool catalogued = ShapeCatalog::shared().add(W, H, TessellatedPen, EllipseSpans<W,H,TessellatedPen>::Table);
+      (void)catalogued;
+
+      if (dc.recording() || dc.scaled() || dc.penWidth() != TessellatedPen)
+        dc.ellipse(RectL(pt, SizeL(W,H)));
+      else if (dc.antialiased())
+      {
+        static const CoverageMask mask = CoverageMask::ellipse(RectL(PointL(), SizeL(W,H)), TessellatedPen);
+        dc.coverage(mask, pt);
+      }
+      else
+        dc.spans(EllipseSpans<W,H,TessellatedPen>::Table, pt);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Graphics::triangle
+    //! Draw a triangle of fixed size from spans tessellated at compile time  (Catalogued upon first use)
+    //!
+    //! \tparam W - Base width
+    //! \tparam H - Height
+    //! \param[in,out] dc - Device context
+    //! \param[in] pt - Left end of base
+    ///////////////////////////////////////////////////////////////////////////////
+    template <int32_t W, int32_t H>
+    static void triangle(DeviceContext& dc, PointL pt)
+    {
+      static const bool catalogued = ShapeCatalog::shared().add(TriangleShape<W,H>::Points, TessellatedPen, ShapeSpans<TriangleShape<W,H>,TessellatedPen>::Table);
+      (void)catalogued;
+
+      if (dc.recording() || dc.scaled() || dc.penWidth() != TessellatedPen)
+        dc.triangle(TriangleL(pt, W, H));
+      else if (dc.antialiased())
+      {
+        static const CoverageMask mask = CoverageMask::polygon(TriangleShape<W,H>::Points, 3, TessellatedPen);
+        dc.coverage(mask, pt);
+      }
+      else
+        dc.spans(ShapeSpans<TriangleShape<W,H>,TessellatedPen>::Table, pt);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Graphics::polygon
+    //! Draw a constant polygon from spans tessellated at compile time  (Catalogued upon first use)
+    //!
+    //! \tparam SHAPE - Type whose static constexpr array 'Points' defines the vertices
+    //! \param[in,out] dc - Device context
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename SHAPE>
+    static void polygon(DeviceContext& dc)
+    {
+      static const bool catalogued = ShapeCatalog::shared().add(SHAPE::Points, TessellatedPen, ShapeSpans<SHAPE,TessellatedPen>::Table);
+      (void)catalogued;
+
+      if (dc.recording() || dc.scaled() || dc.penWidth() != TessellatedPen)
+        dc.polygon(SHAPE::Points);
+      else if (dc.antialiased())
+      {
+        static const CoverageMask mask = CoverageMask::polygon(SHAPE::Points, int32_t(std::extent<decltype(SHAPE::Points)>::value), TessellatedPen);
+        dc.coverage(mask, PointL());
+      }
+      else
+        dc.spans(ShapeSpans<SHAPE,TessellatedPen>::Table, PointL());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Graphics::polygon
+    //! Draw a polygon whose vertices are only known at runtime
+    //!
+    //! \param[in,out] dc - Device context
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    ///////////////////////////////////////////////////////////////////////////////
+    static void polygon(DeviceContext& dc, const POINT* pts, int32_t count)
+    {
+      dc.polygon(pts, count);
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct DynamicGraphics - Software renderer that rasterizes fixed-size shapes on every call
+  ///////////////////////////////////////////////////////////////////////////////
+  struct DynamicGraphics : Graphics
+  {
+    // ----------------------------------- STATIC METHODS -----------------------------------
+
+    using Graphics::polygon;
+
+    template <int32_t W, int32_t H>
+    static void ellipse(DeviceContext& dc, PointL pt)
+    {
+      dc.ellipse(RectL(pt, SizeL(W,H)));
+    }
+
+    template <int32_t W, int32_t H>
+    static void triangle(DeviceContext& dc, PointL pt)
+    {
+      dc.triangle(TriangleL(pt, W, H));
+    }
+
+    template <typename SHAPE>
+    static void polygon(DeviceContext& dc)
+    {
+      dc.polygon(SHAPE::Points);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\HitTest.h
+//! \brief Defines exact point-in-shape tests matching the shapes drawn by the renderer
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_HIT_TEST_H
+#define RENDER_HIT_TEST_H
+
+#include <cstdint>            //!< int64_t
+#include "Types.h"            //!< hw1::render::RectL
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  //! Each test samples the centre of the pixel at a point, as the rasterizer does. Coordinates
+  //! are doubled so the centre is integral and the tests are exact.
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // hw1::render::insideEllipse
+  //! Query whether the pixel at a point lies within the ellipse inscribed in a rectangle
+  //!
+  //! \param[in] box - Bounding rectangle  (Dimensions may be negative)
+  //! \param[in] pt - Pixel
+  ///////////////////////////////////////////////////////////////////////////////
+  inline bool insideEllipse(const RectL& box, PointL pt)
+  {
+    const RectL r = box.normalized();
+    if (!r.contains(pt))
+      return false;
+
+    // (dx/a) + (dy/b) <= 1, scaled by (2a2b)  (Products of 31-bit values exceed 64 bits, hence doubles)
+    const double a2 = double(r.width()), b2 = double(r.height()),
+                 dx = double(2*int64_t(pt.x) + 1 - r.left - int64_t(r.right)),
+                 dy = double(2*int64_t(pt.y) + 1 - r.top - int64_t(r.bottom));
+    return dx*dx*b2*b2 + dy*dy*a2*a2 <= a2*a2*b2*b2;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // hw1::render::insideTriangle
+  //! Query whether the pixel at a point lies within a triangle  (Either winding)
+  //!
+  //! \param[in] tri - Triangle
+  //! \param[in] pt - Pixel
+  ///////////////////////////////////////////////////////////////////////////////
+  inline bool insideTriangle(const TriangleL& tri, PointL pt)
+  {
+    const int64_t px = 2*int64_t(pt.x) + 1, py = 2*int64_t(pt.y) + 1;
+    auto edge = [&](const POINT& a, const POINT& b) {
+      return (2*int64_t(b.x) - 2*int64_t(a.x)) * (py - 2*int64_t(a.y)) - (2*int64_t(b.y) - 2*int64_t(a.y)) * (px - 2*int64_t(a.x));
+    };
+    const int64_t e0 = edge(tri.points[0], tri.points[1]),
+                  e1 = edge(tri.points[1], tri.points[2]),
+                  e2 = edge(tri.points[2], tri.points[0]);
+    return (e0 >= 0 && e1 >= 0 && e2 >= 0) || (e0 <= 0 && e1 <= 0 && e2 <= 0);
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // hw1::render::insidePolygon
+  //! Query whether the pixel at a point lies within a polygon  (Alternate fill rule, as drawn)
+  //!
+  //! \tparam VERTEX - Vertex type  (Any type with members x and y)
+  //!
+  //! \param[in] pts - Vertices  (Implicitly closed)
+  //! \param[in] count - Number of vertices
+  //! \param[in] pt - Pixel
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename VERTEX>
+  bool insidePolygon(const VERTEX* pts, int32_t count, PointL pt)
+  {
+    const int64_t px = 2*int64_t(pt.x) + 1, py = 2*int64_t(pt.y) + 1;
+    bool inside = false;
+
+    // Count crossings of a ray running rightwards from the pixel centre
+    for (int32_t i = 0, j = count-1; i < count; j = i++)
+    {
+      const int64_t xi = 2*int64_t(pts[i].x), yi = 2*int64_t(pts[i].y),
+                    xj = 2*int64_t(pts[j].x), yj = 2*int64_t(pts[j].y);
+      if ((yi > py) != (yj > py))
+      {
+        // Crossing lies right of the centre iff px < xi + (py-yi)(xj-xi)/(yj-yi)
+        const int64_t lhs = (px - xi) * (yj - yi), rhs = (py - yi) * (xj - xi);
+        if (yj > yi ? lhs < rhs : lhs > rhs)
+          inside = !inside;
+      }
+    }
+    return inside;
+  }
+
+} } // namespace hw1::render
+
+#endif
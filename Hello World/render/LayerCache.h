@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\LayerCache.h
+//! \brief Defines caching of static scene layers and compositing of dynamic layers
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_LAYER_CACHE_H
+#define RENDER_LAYER_CACHE_H
+
+#include "Types.h"            //!< hw1::render::RectL
+#include "Spans.h"            //!< hw1::render::copySpan
+#include "Framebuffer.h"      //!< hw1::render::Framebuffer
+#include "DeviceContext.h"    //!< hw1::render::DeviceContext
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::blit
+  //! Copy a rectangle of pixels between surfaces of equal size  (Clipped to both)
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void blit(Framebuffer& dst, const Framebuffer& src, const RectL& rc)
+  {
+    const RectL r = rc.intersect(dst.bounds()).intersect(src.bounds());
+    if (!r.empty())
+      for (int32_t y = r.top; y < r.bottom; ++y)
+        copySpan(dst.row(y) + r.left, src.row(y) + r.left, r.width());
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct LayerCache - Caches the static layers of a frame and draws dynamic layers over them
+  //!
+  //! Static layers are rendered once into an offscreen surface the size of the frame and
+  //! re-rendered only when the frame size changes, or when invalidated because their
+  //! appearance has changed. Each paint copies the invalidated rectangle from the cache,
+  //! then draws the dynamic layers over it, clipped to the same rectangle. Shapes are opaque,
+  //! so the result is pixel-identical to drawing every layer in order.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct LayerCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \struct CacheStats - Number of paints served from the cache and re-rendered
+    struct CacheStats
+    {
+      uint64_t  Hits = 0,         //!< Paints that reused the static layers
+                Misses = 0;       //!< Paints that rendered the static layers
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    Framebuffer  Static;          //!< Static layers
+    bool         Valid = false;   //!< Whether the static layers are current
+    CacheStats   Stats;           //!< Cache hits and misses
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    const Framebuffer&  background() const  { return Static; }
+    const CacheStats&   stats() const       { return Stats; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // LayerCache::valid const
+    //! Query whether the static layers are current for a frame size
+    ///////////////////////////////////////////////////////////////////////////////
+    bool valid(const SizeL& size) const
+    {
+      return Valid && Static.width() == size.width && Static.height() == size.height;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // LayerCache::invalidate
+    //! Force the static layers to be re-rendered by the next paint  (eg. when their appearance changes)
+    ///////////////////////////////////////////////////////////////////////////////
+    void invalidate()
+    {
+      Valid = false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // LayerCache::update
+    //! Render the static layers if they are not current for a frame size
+    //!
+    //! \param[in] size - Frame size
+    //! \param[in] draw - Callable as draw(DeviceContext&, const RectL&) that paints the static layers
+    //! \return const Framebuffer& - Static layers
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename DRAW>
+    const Framebuffer& update(const SizeL& size, DRAW&& draw)
+    {
+      if (valid(size))
+      {
+        ++Stats.Hits;
+        return Static;
+      }
+
+      ++Stats.Misses;
+      Static.resize(size.width, size.height);
+      DeviceContext dc(Static);
+      draw(dc, Static.bounds());
+      Valid = true;
+      return Static;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // LayerCache::paint
+    //! Paint a rectangle of a frame from the static layers and freshly drawn dynamic layers
+    //!
+    //! \param[in,out] target - Frame
+    //! \param[in] rc - Invalidated rectangle
+    //! \param[in] dynamic - Bounds of the dynamic layers
+    //! \param[in] drawStatic - Callable as draw(DeviceContext&, const RectL&) that paints the static layers
+    //! \param[in] drawDynamic - Callable as draw(DeviceContext&, const RectL&) that paints the dynamic layers
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename STATIC, typename DYNAMIC>
+    void paint(Framebuffer& target, const RectL& rc, const RectL& dynamic, STATIC&& drawStatic, DYNAMIC&& drawDynamic)
+    {
+      const RectL region = rc.intersect(target.bounds());
+      if (region.empty())
+        return;
+
+      // Restore the static layers
+      blit(target, update(SizeL(target.width(), target.height()), drawStatic), region);
+
+      // Draw dynamic layers over them
+      const RectL area = region.intersect(dynamic);
+      if (area.empty())
+        return;
+
+      DeviceContext dc(target);
+      dc.setClip(area);
+      drawDynamic(dc, area);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
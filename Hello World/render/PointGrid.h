@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\PointGrid.h
+//! \brief Defines a compact uniform-grid spatial index of points
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_POINT_GRID_H
+#define RENDER_POINT_GRID_H
+
+#include <vector>             //!< std::vector
+#include <algorithm>          //!< std::sort
+#include "Types.h"            //!< hw1::render::RectL
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct PointGrid - Uniform grid of square cells binning points by position
+  //!
+  //! Indexes millions of objects of a fixed size by their position alone; callers find the
+  //! objects intersecting a rectangle by querying the rectangle expanded by that size. Cells
+  //! are stored contiguously (a counting sort of point indices by cell), costing four bytes per
+  //! point, rather than as one list per cell (See hw1::render::SpatialGrid).
+  //!
+  //! Coordinates are referenced rather than copied, so they must outlive the grid. Query
+  //! results are returned in index order, which preserves painter's order.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct PointGrid
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias index_t - Point index type
+    using index_t = uint32_t;
+
+    //! \var MinCellShift - Base-2 logarithm of the smallest cell size
+    static constexpr int32_t MinCellShift = 4;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    const int32_t*        X = nullptr,      //!< X-coordinate of each point
+                 *        Y = nullptr;      //!< Y-coordinate of each point
+    int32_t               OriginX = 0,      //!< X-coordinate of the left edge of the first column
+                          OriginY = 0,      //!< Y-coordinate of the top edge of the first row
+                          CellShift = 0,    //!< Base-2 logarithm of the cell size
+                          Columns = 0,      //!< Number of columns
+                          Rows = 0;         //!< Number of rows
+    std::vector<index_t>  First;            //!< Offset within Items of the first point of each cell  (Plus a terminator)
+    std::vector<index_t>  Items;            //!< Point indices ordered by cell, then by index
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    PointGrid() = default;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PointGrid::PointGrid
+    //! Index a set of points
+    //!
+    //! Cells are enlarged (in powers of two) until there are no more cells than points, which
+    //! bounds the memory used by sparse or widely scattered points.
+    //!
+    //! \param[in] x - X-coordinate of each point
+    //! \param[in] y - Y-coordinate of each point
+    //! \param[in] count - Number of points
+    //! \param[in] cellSize - Preferred cell dimensions  (Rounded up to a power of two)
+    ///////////////////////////////////////////////////////////////////////////////
+    PointGrid(const int32_t* x, const int32_t* y, index_t count, int32_t cellSize) : X(x), Y(y)
+    {
+      if (!count)
+        return;
+
+      // Measure extent
+      int32_t x0 = x[0], x1 = x[0], y0 = y[0], y1 = y[0];
+      for (index_t idx = 1; idx < count; ++idx)
+      {
+        x0 = std::min(x0, x[idx]), x1 = std::max(x1, x[idx]);
+        y0 = std::min(y0, y[idx]), y1 = std::max(y1, y[idx]);
+      }
+      OriginX = x0;
+      OriginY = y0;
+
+      // Choose the cell size
+      CellShift = MinCellShift;
+      while ((int64_t(1) << CellShift) < cellSize)
+        ++CellShift;
+      auto span = [&](int32_t lo, int32_t hi) { return int32_t(((int64_t(hi) - lo) >> CellShift) + 1); };
+      while (int64_t(span(x0,x1)) * span(y0,y1) > std::max<int64_t>(count, 1024))
+        ++CellShift;
+      Columns = span(x0, x1);
+      Rows = span(y0, y1);
+
+      // Count points per cell, then convert counts into offsets
+      First.assign(size_t(Columns)*Rows + 1, 0);
+      for (index_t idx = 0; idx < count; ++idx)
+        ++First[cell(x[idx], y[idx]) + 1];
+      for (size_t c = 1; c < First.size(); ++c)
+        First[c] += First[c-1];
+
+      // Scatter indices into their cells  (Ascending within each cell)
+      std::vector<index_t> next(First.begin(), First.end()-1);
+      Items.resize(count);
+      for (index_t idx = 0; idx < count; ++idx)
+        Items[next[cell(x[idx], y[idx])]++] = idx;
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    bool    empty() const     { return Items.empty(); }
+    size_t  size() const      { return Items.size(); }
+    int32_t cellSize() const  { return 1 << CellShift; }
+
+    //! Get the memory occupied by the index, in bytes
+    size_t  memory() const    { return (First.capacity() + Items.capacity()) * sizeof(index_t); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PointGrid::covers const
+    //! Query whether a rectangle contains every indexed point  (A query would return them all)
+    ///////////////////////////////////////////////////////////////////////////////
+    bool covers(const RectL& rc) const
+    {
+      return rc.left <= OriginX && rc.top <= OriginY
+          && int64_t(rc.right) >= OriginX + (int64_t(Columns) << CellShift)
+          && int64_t(rc.bottom) >= OriginY + (int64_t(Rows) << CellShift);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PointGrid::query const
+    //! Find all points within a rectangle
+    //!
+    //! \param[in] rc - Query rectangle  (Right and bottom edges are exclusive)
+    //! \param[out] results - Receives indices of points within the rectangle in ascending order  (Cleared first)
+    ///////////////////////////////////////////////////////////////////////////////
+    void query(const RectL& rc, std::vector<index_t>& results) const
+    {
+      results.clear();
+      if (Items.empty() || rc.empty())
+        return;
+
+      // Range of cells overlapping rectangle
+      auto column = [&](int64_t v) { return int32_t(std::min<int64_t>(Columns-1, std::max<int64_t>(0, v - OriginX) >> CellShift)); };
+      auto row = [&](int64_t v) { return int32_t(std::min<int64_t>(Rows-1, std::max<int64_t>(0, v - OriginY) >> CellShift)); };
+      if (int64_t(rc.right) <= OriginX || int64_t(rc.bottom) <= OriginY
+       || rc.left >= OriginX + (int64_t(Columns) << CellShift) || rc.top >= OriginY + (int64_t(Rows) << CellShift))
+        return;
+      const int32_t c0 = column(rc.left), c1 = column(int64_t(rc.right)-1),
+                    r0 = row(rc.top),     r1 = row(int64_t(rc.bottom)-1);
+
+      // Test the points of each row of cells  (Consecutive cells of a row are contiguous)
+      for (int32_t r = r0; r <= r1; ++r)
+      {
+        const size_t row0 = size_t(r)*Columns;
+        for (index_t pos = First[row0+c0], end = First[row0+c1+1]; pos < end; ++pos)
+        {
+          const index_t idx = Items[pos];
+          if (X[idx] >= rc.left && X[idx] < rc.right && Y[idx] >= rc.top && Y[idx] < rc.bottom)
+            results.push_back(idx);
+        }
+      }
+
+      // Merge cells into index order
+      if (r0 != r1 || c0 != c1)
+        std::sort(results.begin(), results.end());
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // PointGrid::cell const
+    //! Get the cell containing an indexed point
+    ///////////////////////////////////////////////////////////////////////////////
+    size_t cell(int32_t x, int32_t y) const
+    {
+      return size_t((int64_t(y) - OriginY) >> CellShift) * Columns + size_t((int64_t(x) - OriginX) >> CellShift);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
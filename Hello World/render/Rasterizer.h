@@ -0,0 +1,286 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Rasterizer.h
+//! \brief Defines scan conversion of rectangles, ellipses and polygons into spans
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_RASTERIZER_H
+#define RENDER_RASTERIZER_H
+
+#include <cmath>              //!< std::sqrt
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct PointF - Sub-pixel vertex used during scan conversion
+  ///////////////////////////////////////////////////////////////////////////////
+  struct PointF
+  {
+    float x, y;
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Rasterizer - Converts shapes into horizontal spans
+  //!
+  //! Each method emits spans as (y, x0, x1) with x1 exclusive, restricted to the clip
+  //! rectangle. Shapes with an outline emit interior and outline spans separately so
+  //! the caller can apply the brush and pen independently.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Rasterizer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var MaxCrossings - Crossings per scanline held on the stack  (Polygons with more vertices use a per-thread buffer)
+    static constexpr int32_t MaxCrossings = 64;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::clipSpan
+    //! Clip a span horizontally and forward it when non-empty
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename EMIT>
+    static void clipSpan(const RectL& clip, int32_t y, int32_t x0, int32_t x1, EMIT&& emit)
+    {
+      x0 = std::max(x0, clip.left);
+      x1 = std::min(x1, clip.right);
+      if (x0 < x1)
+        emit(y, x0, x1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::rect
+    //! Scan convert a rectangle with an inside-frame outline
+    //!
+    //! \param[in] rc - Rectangle (Any orientation)
+    //! \param[in] clip - Clipping rectangle
+    //! \param[in] penWidth - Outline width (Zero for none)
+    //! \param[in] interior - Interior span callback
+    //! \param[in] outline - Outline span callback
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FILL, typename STROKE>
+    static void rect(const RectL& rc, const RectL& clip, int32_t penWidth, FILL&& interior, STROKE&& outline)
+    {
+      const RectL r = rc.normalized();
+      const RectL inner = penWidth > 0 ? RectL(r.left+penWidth, r.top+penWidth, r.right-penWidth, r.bottom-penWidth) : r;
+      const int32_t y0 = std::max(r.top, clip.top),
+                    y1 = std::min(r.bottom, clip.bottom);
+
+      for (int32_t y = y0; y < y1; ++y)
+      {
+        // Frame rows
+        if (y < inner.top || y >= inner.bottom || inner.empty())
+        {
+          clipSpan(clip, y, r.left, r.right, outline);
+          continue;
+        }
+        // Frame sides + interior
+        clipSpan(clip, y, r.left, inner.left, outline);
+        clipSpan(clip, y, inner.left, inner.right, interior);
+        clipSpan(clip, y, inner.right, r.right, outline);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::ellipse
+    //! Scan convert an ellipse inscribed within a rectangle
+    //!
+    //! \param[in] rc - Bounding rectangle (Any orientation)
+    //! \param[in] clip - Clipping rectangle
+    //! \param[in] penWidth - Outline width (Zero for none)
+    //! \param[in] interior - Interior span callback
+    //! \param[in] outline - Outline span callback
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FILL, typename STROKE>
+    static void ellipse(const RectL& rc, const RectL& clip, int32_t penWidth, FILL&& interior, STROKE&& outline)
+    {
+      const RectL r = rc.normalized();
+      const float cx = (r.left + r.right) * 0.5f,
+                  cy = (r.top + r.bottom) * 0.5f,
+                  ra = r.width() * 0.5f,
+                  rb = r.height() * 0.5f,
+                  ia = ra - penWidth,
+                  ib = rb - penWidth;
+      const int32_t y0 = std::max(r.top, clip.top),
+                    y1 = std::min(r.bottom, clip.bottom);
+
+      if (ra <= 0 || rb <= 0)
+        return;
+
+      for (int32_t y = y0; y < y1; ++y)
+      {
+        const float dy = (y + 0.5f) - cy;
+        int32_t ox0, ox1;
+        if (!chord(cx, dy, ra, rb, ox0, ox1))
+          continue;
+
+        // Interior chord of the inset ellipse
+        int32_t ix0, ix1;
+        if (ia <= 0 || ib <= 0 || !chord(cx, dy, ia, ib, ix0, ix1))
+        {
+          clipSpan(clip, y, ox0, ox1, outline);
+          continue;
+        }
+        clipSpan(clip, y, ox0, ix0, outline);
+        clipSpan(clip, y, ix0, ix1, interior);
+        clipSpan(clip, y, ix1, ox1, outline);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::polygon
+    //! Scan convert a polygon using the alternate (even-odd) fill rule
+    //!
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    //! \param[in] clip - Clipping rectangle
+    //! \param[in] emit - Span callback
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename EMIT>
+    static void polygon(const PointF* pts, int32_t count, const RectL& clip, EMIT&& emit)
+    {
+      if (count < 3)
+        return;
+
+      // Vertical extent
+      float minY = pts[0].y, maxY = pts[0].y;
+      for (int32_t i = 1; i < count; ++i)
+        minY = std::min(minY, pts[i].y),
+        maxY = std::max(maxY, pts[i].y);
+
+      const int32_t y0 = std::max(int32_t(std::ceil(minY - 0.5f)), clip.top),
+                    y1 = std::min(int32_t(std::ceil(maxY - 0.5f)), clip.bottom);
+
+      // Each edge crosses a scanline at most once
+      static thread_local std::vector<float> heap;
+      float stack[MaxCrossings];
+      float* xs = stack;
+      if (count > MaxCrossings)
+      {
+        if (heap.size() < size_t(count))
+          heap.resize(count);
+        xs = heap.data();
+      }
+
+      for (int32_t y = y0; y < y1; ++y)
+      {
+        const float sy = y + 0.5f;
+        int32_t n = 0;
+
+        // Gather edge crossings at pixel centres
+        for (int32_t i = 0, j = count-1; i < count; j = i++)
+        {
+          const PointF& a = pts[j];
+          const PointF& b = pts[i];
+          if ((a.y <= sy) != (b.y <= sy))
+            xs[n++] = a.x + (sy - a.y) * (b.x - a.x) / (b.y - a.y);
+        }
+        std::sort(xs, xs+n);
+
+        // Emit interior spans between pairs
+        for (int32_t k = 0; k+1 < n; k += 2)
+          clipSpan(clip, y, int32_t(std::ceil(xs[k] - 0.5f)), int32_t(std::ceil(xs[k+1] - 0.5f)), emit);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::line
+    //! Scan convert a thick line segment with square end caps
+    //!
+    //! \param[in] a - Start point
+    //! \param[in] b - End point
+    //! \param[in] width - Line width
+    //! \param[in] clip - Clipping rectangle
+    //! \param[in] emit - Span callback
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename EMIT>
+    static void line(PointF a, PointF b, float width, const RectL& clip, EMIT&& emit)
+    {
+      segment(a, b, width, [&] (const PointF* quad, int32_t n) { polygon(quad, n, clip, emit); });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::segment
+    //! Calculate the quadrilateral covered by a thick line segment with square end caps
+    //!
+    //! \param[in] a - Start point
+    //! \param[in] b - End point
+    //! \param[in] width - Line width
+    //! \param[in] quad - Callable as quad(const PointF*, int32_t) receiving the vertices  (Not called if degenerate)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename QUAD>
+    static void segment(PointF a, PointF b, float width, QUAD&& quad)
+    {
+      const float dx = b.x - a.x,
+                  dy = b.y - a.y,
+                  len = std::sqrt(dx*dx + dy*dy);
+      if (len <= 0.0f || width <= 0.0f)
+        return;
+
+      // Half-width along and across the segment
+      const float h = width * 0.5f,
+                  ux = dx / len * h,
+                  uy = dy / len * h;
+      const PointF pts[4] = { {a.x - ux - uy, a.y - uy + ux},
+                              {b.x + ux - uy, b.y + uy + ux},
+                              {b.x + ux + uy, b.y + uy - ux},
+                              {a.x - ux + uy, a.y - uy - ux} };
+      quad(pts, 4);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::outline
+    //! Scan convert the closed outline of a polygon
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename EMIT>
+    static void outline(const PointF* pts, int32_t count, float width, const RectL& clip, EMIT&& emit)
+    {
+      for (int32_t i = 0, j = count-1; i < count; j = i++)
+        line(pts[j], pts[i], width, clip, emit);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::bounds
+    //! Get the pixel bounds of a polygon including its outline
+    ///////////////////////////////////////////////////////////////////////////////
+    static RectL bounds(const PointF* pts, int32_t count, int32_t penWidth)
+    {
+      if (count == 0)
+        return RectL();
+
+      float l = pts[0].x, t = pts[0].y, r = l, b = t;
+      for (int32_t i = 1; i < count; ++i)
+        l = std::min(l, pts[i].x), r = std::max(r, pts[i].x),
+        t = std::min(t, pts[i].y), b = std::max(b, pts[i].y);
+
+      // Square caps may project by up to width/sqrt(2) beyond each vertex
+      const float pad = penWidth * 0.75f;
+      return RectL(int32_t(std::floor(l - pad)), int32_t(std::floor(t - pad)),
+                   int32_t(std::ceil(r + pad)) + 1, int32_t(std::ceil(b + pad)) + 1);
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Rasterizer::chord
+    //! Calculate the pixel span of an ellipse at a vertical offset from its centre
+    ///////////////////////////////////////////////////////////////////////////////
+    static bool chord(float cx, float dy, float a, float b, int32_t& x0, int32_t& x1)
+    {
+      const float t = 1.0f - (dy*dy) / (b*b);
+      if (t <= 0.0f)
+        return false;
+
+      const float h = a * std::sqrt(t);
+      x0 = int32_t(std::ceil(cx - h - 0.5f));
+      x1 = int32_t(std::ceil(cx + h - 0.5f));
+      return x0 < x1;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
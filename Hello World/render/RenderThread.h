@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\RenderThread.h
+//! \brief Defines a dedicated thread that renders frames requested by the UI thread
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_RENDER_THREAD_H
+#define RENDER_RENDER_THREAD_H
+
+#include <atomic>               //!< std::atomic
+#include <condition_variable>   //!< std::condition_variable
+#include <functional>           //!< std::function
+#include <mutex>                //!< std::mutex
+#include <thread>               //!< std::thread
+#include "Framebuffer.h"        //!< hw1::render::Framebuffer
+#include "ResizeCoalescer.h"    //!< hw1::render::ResizeCoalescer
+#include "TripleBuffer.h"       //!< hw1::render::TripleBuffer
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct RenderThread - Renders frames on a dedicated thread and hands them to the UI thread
+  //!
+  //! The UI thread requests frames and presents the newest complete frame; neither call
+  //! blocks. Frames are drawn into the back slot of a triple buffer, so the render thread
+  //! never waits for presentation and the UI thread never waits for rendering. Requests
+  //! made while a frame is being drawn are coalesced into a single frame, and frames are
+  //! paced by a ResizeCoalescer: at most one per display frame, and none while the view is
+  //! being resized  (The UI thread presents the previous frame scaled until the size settles).
+  //!
+  //! Requests and resizes are published under the mutex guarding the wake-up condition, so
+  //! none can be lost between the render thread's check for work and its wait. While idle the
+  //! render thread sleeps until woken; while a frame is pending it sleeps until the frame is due.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct RenderThread
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \struct Frame - Rendered frame
+    struct Frame
+    {
+      Framebuffer  Pixels;         //!< Rendered image
+      uint64_t     Sequence = 0;   //!< Most recent request satisfied by the frame  (Zero before the first frame)
+    };
+
+    //! \alias draw_t - Callback that draws a frame  (Called on the render thread)
+    using draw_t = std::function<void (Framebuffer&)>;
+
+    //! \alias notify_t - Callback that notifies the UI thread of a new frame  (Called on the render thread)
+    using notify_t = std::function<void ()>;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    draw_t                   Draw;                 //!< Draws a frame
+    notify_t                 Completed;            //!< Notifies the UI thread  (If any)
+    ResizeCoalescer          Pacing;               //!< Decides when frames are drawn  (Accessed only by the render thread)
+    TripleBuffer<Frame>      Frames;               //!< Frames being drawn, ready and presented
+    std::atomic<uint64_t>    Requested{0},         //!< Sequence number of most recent request
+                             Rendered{0},          //!< Number of frames rendered
+                             Size;                 //!< Requested size  (Width in the upper 32 bits)
+    std::atomic<bool>        Stopping{false};      //!< Whether the thread should exit
+    std::mutex               Lock;                 //!< Guards waiting for requests
+    std::condition_variable  Wake;                 //!< Signalled upon a request, resize (or stop)
+    std::thread              Thread;               //!< Render thread
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // RenderThread::RenderThread
+    //! Start the render thread
+    //!
+    //! \param[in] width - Frame width
+    //! \param[in] height - Frame height
+    //! \param[in] draw - Draws a frame  (Called on the render thread)
+    //! \param[in] completed - [optional] Called on the render thread after each frame is published
+    //! \param[in] frame - [optional] Minimum time between frames
+    //! \param[in] settle - [optional] Time the size must be unchanged before drawing at the new size
+    ///////////////////////////////////////////////////////////////////////////////
+    RenderThread(int32_t width, int32_t height, draw_t draw, notify_t completed = nullptr,
+                 ResizeCoalescer::clock::duration frame = ResizeCoalescer::DefaultFrameInterval,
+                 ResizeCoalescer::clock::duration settle = ResizeCoalescer::DefaultSettleDelay)
+      : Draw(std::move(draw)), Completed(std::move(completed)),
+        Pacing(width, height, frame, settle), Size(pack(width, height))
+    {
+      Thread = std::thread(&RenderThread::thread, this);
+    }
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator= (const RenderThread&) = delete;
+
+    ~RenderThread()
+    {
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Stopping = true;
+      }
+      Wake.notify_one();
+      Thread.join();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the frame most recently presented  (UI thread only)
+    const Frame& frame() const  { return Frames.front(); }
+
+    //! Get the number of frames rendered
+    uint64_t rendered() const   { return Rendered.load(std::memory_order_relaxed); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // RenderThread::request
+    //! Request a frame  (UI thread only; waits only for the render thread to begin waiting or drawing)
+    //!
+    //! \return uint64_t - Sequence number of the request  (Presented frames satisfy every request up to their Sequence)
+    ///////////////////////////////////////////////////////////////////////////////
+    uint64_t request()
+    {
+      uint64_t sequence;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        sequence = Requested.fetch_add(1) + 1;
+      }
+      Wake.notify_one();
+      return sequence;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RenderThread::resize
+    //! Request frames of a different size  (UI thread only; waits only for the render thread to begin waiting or drawing)
+    //!
+    //! \param[in] width - Frame width
+    //! \param[in] height - Frame height
+    ///////////////////////////////////////////////////////////////////////////////
+    void resize(int32_t width, int32_t height)
+    {
+      if (Size.load() == pack(width, height))
+        return;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Size = pack(width, height);
+      }
+      Wake.notify_one();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RenderThread::present
+    //! Adopt the newest complete frame  (UI thread only; never blocks)
+    //!
+    //! \return bool - True if a frame was completed since the previous call
+    ///////////////////////////////////////////////////////////////////////////////
+    bool present()
+    {
+      return Frames.acquire();
+    }
+
+  private:
+    //! Pack a size into one word
+    static uint64_t pack(int32_t width, int32_t height)  { return uint64_t(uint32_t(width)) << 32 | uint32_t(height); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RenderThread::thread
+    //! Render thread procedure
+    ///////////////////////////////////////////////////////////////////////////////
+    void thread()
+    {
+      uint64_t satisfied = 0;
+      for (;;)
+      {
+        // Wait for a request newer than the last frame, or a new size, until a frame is due
+        uint64_t sequence;
+        {
+          std::unique_lock<std::mutex> lock(Lock);
+          for (;;)
+          {
+            if (Stopping)
+              return;
+
+            const uint64_t size = Size.load();
+            Pacing.resize(int32_t(size >> 32), int32_t(uint32_t(size)), ResizeCoalescer::clock::now());
+            if ((sequence = Requested.load()) != satisfied)
+              Pacing.invalidate();
+            if (Pacing.ready(ResizeCoalescer::clock::now()))
+              break;
+
+            // Sleep until the pending frame is due, or indefinitely until woken
+            if (Pacing.pending() && Pacing.width() > 0 && Pacing.height() > 0)
+              Wake.wait_until(lock, Pacing.due());
+            else
+              Wake.wait(lock);
+          }
+        }
+
+        // Draw the newest request  (Earlier requests are satisfied by the same frame)
+        Pacing.rendering(ResizeCoalescer::clock::now());
+        Frame& frame = Frames.back();
+        frame.Sequence = satisfied = sequence;
+        if (frame.Pixels.width() != Pacing.width() || frame.Pixels.height() != Pacing.height())
+          frame.Pixels.resize(Pacing.width(), Pacing.height());
+        Draw(frame.Pixels);
+
+        Frames.publish();
+        Rendered.fetch_add(1, std::memory_order_relaxed);
+        if (Completed)
+          Completed();
+      }
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
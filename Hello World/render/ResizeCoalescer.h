@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\ResizeCoalescer.h
+//! \brief Defines the policy deciding when a resized or invalidated view is re-rendered
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_RESIZE_COALESCER_H
+#define RENDER_RESIZE_COALESCER_H
+
+#include <algorithm>          //!< std::max
+#include <chrono>             //!< std::chrono::steady_clock
+#include <cstdint>            //!< int32_t
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ResizeCoalescer - Decides when a view should be rendered in response to resizing and invalidation
+  //!
+  //! Renders are paced to at most one per FrameInterval, however many requests arrive. While
+  //! the view is being resized the previous frame is presented scaled or clipped instead;
+  //! the view is re-rendered only once its size has been unchanged for SettleDelay  (Content
+  //! changes made meanwhile are drawn by that render). The first frame is rendered without
+  //! waiting, since there is no previous frame to present.
+  //!
+  //! Time is supplied by the caller, so traces can be replayed without waiting.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ResizeCoalescer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias clock - Clock supplying times
+    using clock = std::chrono::steady_clock;
+
+    //! \var DefaultFrameInterval - Default minimum time between renders  (One display frame at 60Hz)
+    static constexpr std::chrono::microseconds DefaultFrameInterval{16667};
+
+    //! \var DefaultSettleDelay - Default time the size must be unchanged before re-rendering
+    static constexpr std::chrono::milliseconds DefaultSettleDelay{100};
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    clock::duration    FrameInterval,        //!< Minimum time between renders
+                       SettleDelay;          //!< Time the size must be unchanged before re-rendering
+    int32_t            Width = 0,            //!< Requested width
+                       Height = 0,           //!< Requested height
+                       RenderedWidth = 0,    //!< Width of the most recent render  (Zero before the first render)
+                       RenderedHeight = 0;   //!< Height of the most recent render
+    clock::time_point  Changed,              //!< When the requested size last changed
+                       LastRender;           //!< When the most recent render began
+    bool               Invalid = false;      //!< Whether the content changed since the most recent render
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResizeCoalescer::ResizeCoalescer
+    //! Create for a view of initial size
+    //!
+    //! \param[in] width - Initial width
+    //! \param[in] height - Initial height
+    //! \param[in] frame - [optional] Minimum time between renders
+    //! \param[in] settle - [optional] Time the size must be unchanged before re-rendering
+    ///////////////////////////////////////////////////////////////////////////////
+    ResizeCoalescer(int32_t width, int32_t height, clock::duration frame = DefaultFrameInterval, clock::duration settle = DefaultSettleDelay)
+      : FrameInterval(frame), SettleDelay(settle), Width(width), Height(height)
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the requested size
+    int32_t width() const   { return Width;  }
+    int32_t height() const  { return Height; }
+
+    //! Query whether the requested size differs from the most recent render
+    bool resized() const    { return Width != RenderedWidth || Height != RenderedHeight; }
+
+    //! Query whether a render is wanted, once due
+    bool pending() const    { return Invalid || resized(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResizeCoalescer::due const
+    //! Get the earliest time a pending render may begin
+    ///////////////////////////////////////////////////////////////////////////////
+    clock::time_point due() const
+    {
+      // [FIRST] Nothing to present in the meantime
+      if (!RenderedWidth && !RenderedHeight)
+        return clock::time_point::min();
+
+      clock::time_point when = LastRender + FrameInterval;
+      if (resized())
+        when = std::max(when, Changed + SettleDelay);
+      return when;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResizeCoalescer::ready const
+    //! Query whether a render should begin
+    //!
+    //! \param[in] now - Current time
+    ///////////////////////////////////////////////////////////////////////////////
+    bool ready(clock::time_point now) const
+    {
+      return pending() && Width > 0 && Height > 0 && now >= due();
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //! Record that the content changed
+    void invalidate()  { Invalid = true; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResizeCoalescer::resize
+    //! Record the size of the view  (Repeating the current size has no effect)
+    //!
+    //! \param[in] width - New width
+    //! \param[in] height - New height
+    //! \param[in] now - Current time
+    ///////////////////////////////////////////////////////////////////////////////
+    void resize(int32_t width, int32_t height, clock::time_point now)
+    {
+      if (width == Width && height == Height)
+        return;
+
+      Width = width;
+      Height = height;
+      Changed = now;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ResizeCoalescer::rendering
+    //! Record that a render of the requested size began
+    //!
+    //! \param[in] now - Current time
+    ///////////////////////////////////////////////////////////////////////////////
+    void rendering(clock::time_point now)
+    {
+      RenderedWidth = Width;
+      RenderedHeight = Height;
+      LastRender = now;
+      Invalid = false;
+    }
+  };
+
+  //! \var ResizeCoalescer::DefaultFrameInterval - Default minimum time between renders
+  constexpr std::chrono::microseconds  ResizeCoalescer::DefaultFrameInterval;
+
+  //! \var ResizeCoalescer::DefaultSettleDelay - Default time the size must be unchanged before re-rendering
+  constexpr std::chrono::milliseconds  ResizeCoalescer::DefaultSettleDelay;
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\ShapeCatalog.h
+//! \brief Defines the catalog used to replay fixed-size shapes from their compile-time span tables
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_SHAPE_CATALOG_H
+#define RENDER_SHAPE_CATALOG_H
+
+#include <atomic>             //!< std::atomic
+#include <mutex>              //!< std::mutex
+#include "Types.h"            //!< hw1::render::RectL
+#include "Tessellator.h"      //!< hw1::render::SpanTable
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ShapeCatalog - Span tables of the fixed-size shapes drawn so far
+  //!
+  //! Recorded commands describe shapes by their geometry alone, so a replayed ellipse or
+  //! polygon would otherwise be rasterized from scratch. Graphics registers each span table
+  //! upon first use; replay then recognises ellipses by their size and polygons by the
+  //! offsets of their vertices, and draws them from the table instead.
+  //!
+  //! Entries are never removed. Registration is serialized; lookups take no lock and may
+  //! run on any number of threads. Shapes beyond the capacity are simply not catalogued.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ShapeCatalog
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Capacity - Maximum number of shapes
+    static constexpr size_t Capacity = 64;
+
+    //! \struct Entry - Span table of one shape
+    struct Entry
+    {
+      const ShapeSpan*  Spans;      //!< Spans relative to the shape origin
+      size_t            Count;      //!< Number of spans
+      RectL             Bounds;     //!< Bounding rectangle of all spans
+      int32_t           Pen,        //!< Outline width
+                        Width,      //!< Ellipse width  (Ellipses only)
+                        Height;     //!< Ellipse height  (Ellipses only)
+      const POINT*      Points;     //!< Vertices relative to the shape origin  (Polygons only)
+      int32_t           Vertices;   //!< Number of vertices  (Zero for ellipses)
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    Entry                Entries[Capacity];   //!< Shapes in registration order
+    std::atomic<size_t>  Size {0};            //!< Number of published entries
+    std::mutex           Lock;                //!< Serializes registration
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::ellipse const
+    //! Find the span table of an ellipse
+    //!
+    //! \param[in] rc - Bounding rectangle  (Origin is the top-left corner)
+    //! \param[in] pen - Outline width
+    //! \return const Entry* - Span table, or nullptr if not catalogued
+    ///////////////////////////////////////////////////////////////////////////////
+    const Entry* ellipse(const RectL& rc, int32_t pen) const
+    {
+      const int32_t w = rc.right - rc.left,
+                    h = rc.bottom - rc.top;
+      for (size_t n = 0, size = Size.load(std::memory_order_acquire); n < size; ++n)
+      {
+        const Entry& e = Entries[n];
+        if (e.Vertices == 0 && e.Width == w && e.Height == h && e.Pen == pen)
+          return &e;
+      }
+      return nullptr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::polygon const
+    //! Find the span table of a polygon
+    //!
+    //! \param[in] pts - Vertices
+    //! \param[in] count - Number of vertices
+    //! \param[in] pen - Outline width
+    //! \param[out] origin - Receives the shape origin  (If found)
+    //! \return const Entry* - Span table, or nullptr if not catalogued
+    ///////////////////////////////////////////////////////////////////////////////
+    const Entry* polygon(const POINT* pts, int32_t count, int32_t pen, PointL& origin) const
+    {
+      for (size_t n = 0, size = Size.load(std::memory_order_acquire); n < size; ++n)
+      {
+        const Entry& e = Entries[n];
+        if (e.Vertices != count || e.Pen != pen || count == 0)
+          continue;
+
+        // Same vertices translated by the same offset
+        const int32_t dx = pts[0].x - e.Points[0].x,
+                      dy = pts[0].y - e.Points[0].y;
+        int32_t i = 1;
+        while (i < count && pts[i].x - e.Points[i].x == dx && pts[i].y - e.Points[i].y == dy)
+          ++i;
+        if (i == count)
+        {
+          origin = PointL(dx, dy);
+          return &e;
+        }
+      }
+      return nullptr;
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::add
+    //! Register the span table of an ellipse
+    //!
+    //! \param[in] w - Width  (May be negative)
+    //! \param[in] h - Height  (May be negative)
+    //! \param[in] pen - Outline width
+    //! \param[in] table - Spans relative to the corner of the bounding rectangle
+    //! \return bool - True if catalogued
+    ///////////////////////////////////////////////////////////////////////////////
+    template <size_t N>
+    bool add(int32_t w, int32_t h, int32_t pen, const SpanTable<N>& table)
+    {
+      return add(Entry{table.begin(), table.Count, table.Bounds, pen, w, h, nullptr, 0});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::add
+    //! Register the span table of a polygon
+    //!
+    //! \param[in] pts - Vertices relative to the shape origin
+    //! \param[in] pen - Outline width
+    //! \param[in] table - Spans relative to the shape origin
+    //! \return bool - True if catalogued
+    ///////////////////////////////////////////////////////////////////////////////
+    template <unsigned V, size_t N>
+    bool add(const POINT (&pts)[V], int32_t pen, const SpanTable<N>& table)
+    {
+      return add(Entry{table.begin(), table.Count, table.Bounds, pen, 0, 0, pts, int32_t(V)});
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::shared
+    //! Get the catalog shared by all device contexts
+    ///////////////////////////////////////////////////////////////////////////////
+    static ShapeCatalog& shared()
+    {
+      static ShapeCatalog catalog;
+      return catalog;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ShapeCatalog::add
+    //! Publish an entry  (Written before the size is released to readers)
+    ///////////////////////////////////////////////////////////////////////////////
+    bool add(const Entry& e)
+    {
+      std::lock_guard<std::mutex> lock(Lock);
+      const size_t size = Size.load(std::memory_order_relaxed);
+      if (size == Capacity)
+        return false;
+
+      Entries[size] = e;
+      Size.store(size+1, std::memory_order_release);
+      return true;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
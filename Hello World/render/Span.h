@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Span.h
+//! \brief Defines a non-owning view of contiguous elements
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_SPAN_H
+#define RENDER_SPAN_H
+
+#include <cstddef>            //!< size_t
+#include <vector>             //!< std::vector
+#include <type_traits>        //!< std::remove_const
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct span - Non-owning view of contiguous elements  (Subset of std::span)
+  //!
+  //! \tparam T - Element type (May be const)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct span
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias value_type - Define element type
+    using value_type = typename std::remove_const<T>::type;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    T*      Data = nullptr;     //!< First element
+    size_t  Size = 0;           //!< Number of elements
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    constexpr span() = default;
+    constexpr span(T* data, size_t size) : Data(data), Size(size) {}
+
+    template <size_t N>
+    constexpr span(T (&arr)[N]) : Data(arr), Size(N) {}
+
+    span(std::vector<value_type>& v) : Data(v.data()), Size(v.size()) {}
+
+    template <typename U = T, typename = typename std::enable_if<std::is_const<U>::value>::type>
+    span(const std::vector<value_type>& v) : Data(v.data()), Size(v.size()) {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    constexpr T*      data() const  { return Data; }
+    constexpr size_t  size() const  { return Size; }
+    constexpr bool    empty() const { return Size == 0; }
+    constexpr T*      begin() const { return Data; }
+    constexpr T*      end() const   { return Data + Size; }
+
+    constexpr T& operator[] (size_t idx) const { return Data[idx]; }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Spans.h
+//! \brief Defines the vectorized scanline span kernels
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_SPANS_H
+#define RENDER_SPANS_H
+
+#include <cstdint>            //!< uint32_t
+#include <cstring>            //!< std::memcpy
+
+#if defined(__AVX2__)
+  #include <immintrin.h>      //!< AVX2 intrinsics
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>      //!< SSE2 intrinsics
+  #define RENDER_SSE2 1
+#endif
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::fillSpan
+  //! Fills a horizontal run of pixels with a single colour
+  //!
+  //! \param[in,out] dst - First pixel
+  //! \param[in] count - Number of pixels
+  //! \param[in] value - Pixel value
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void fillSpan(uint32_t* dst, int32_t count, uint32_t value)
+  {
+#if defined(__AVX2__)
+    const __m256i v = _mm256_set1_epi32(int32_t(value));
+    for (; count >= 16; count -= 16, dst += 16)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+8), v);
+    }
+    if (count >= 8)
+    {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+      dst += 8, count -= 8;
+    }
+#elif defined(RENDER_SSE2)
+    const __m128i v = _mm_set1_epi32(int32_t(value));
+    for (; count >= 8; count -= 8, dst += 8)
+    {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst+4), v);
+    }
+#endif
+    // Remainder
+    while (count-- > 0)
+      *dst++ = value;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::fillPattern
+  //! Fills a horizontal run of pixels from a repeating 8-pixel pattern row  (Reference implementation)
+  //!
+  //! \param[in,out] dst - First pixel
+  //! \param[in] count - Number of pixels
+  //! \param[in] x - Device x-coordinate of first pixel (Selects pattern phase)
+  //! \param[in] bits - Pattern row (Bit N set => pixel N is foreground)
+  //! \param[in] fore - Foreground pixel value
+  //! \param[in] back - Background pixel value
+  //! \param[in] opaque - Whether background pixels are written
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void fillPattern(uint32_t* dst, int32_t count, int32_t x, uint8_t bits, uint32_t fore, uint32_t back, bool opaque)
+  {
+    for (int32_t i = 0; i < count; ++i)
+    {
+      if (bits & (1u << ((x+i) & 7)))
+        dst[i] = fore;
+      else if (opaque)
+        dst[i] = back;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::fillHatch
+  //! Fills a horizontal run of pixels from a repeating 8-pixel pattern row
+  //!
+  //! The pattern row is rotated into span order and expanded once into a vector of eight
+  //! pixels, which is then stored (opaque) or blended over the destination (transparent)
+  //! eight pixels at a time. Produces the same output as fillPattern().
+  //!
+  //! \param[in,out] dst - First pixel
+  //! \param[in] count - Number of pixels
+  //! \param[in] x - Device x-coordinate of first pixel (Selects pattern phase)
+  //! \param[in] bits - Pattern row (Bit N set => pixel N is foreground)
+  //! \param[in] fore - Foreground pixel value
+  //! \param[in] back - Background pixel value
+  //! \param[in] opaque - Whether background pixels are written
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void fillHatch(uint32_t* dst, int32_t count, int32_t x, uint8_t bits, uint32_t fore, uint32_t back, bool opaque)
+  {
+    // Rotate pattern so bit N selects dst[N]
+    const uint32_t phase = uint32_t(x) & 7,
+                   rot = ((uint32_t(bits) >> phase) | (uint32_t(bits) << (8-phase))) & 0xFF;
+
+    // Solid rows need no pattern
+    if (rot == 0xFF || (rot == 0 && opaque))
+      return fillSpan(dst, count, rot ? fore : back);
+    else if (rot == 0)
+      return;
+
+#if defined(__AVX2__)
+    const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128),
+                  mask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int32_t(rot)), lanes), lanes),
+                  f = _mm256_set1_epi32(int32_t(fore));
+    if (opaque)
+    {
+      const __m256i v = _mm256_blendv_epi8(_mm256_set1_epi32(int32_t(back)), f, mask);
+      for (; count >= 8; count -= 8, dst += 8)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+    }
+    else
+      for (; count >= 8; count -= 8, dst += 8)
+      {
+        const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_blendv_epi8(d, f, mask));
+      }
+#elif defined(RENDER_SSE2)
+    const __m128i lanesLo = _mm_setr_epi32(1, 2, 4, 8),
+                  lanesHi = _mm_setr_epi32(16, 32, 64, 128),
+                  r = _mm_set1_epi32(int32_t(rot)),
+                  maskLo = _mm_cmpeq_epi32(_mm_and_si128(r, lanesLo), lanesLo),
+                  maskHi = _mm_cmpeq_epi32(_mm_and_si128(r, lanesHi), lanesHi),
+                  f = _mm_set1_epi32(int32_t(fore));
+    if (opaque)
+    {
+      const __m128i b = _mm_set1_epi32(int32_t(back)),
+                    lo = _mm_or_si128(_mm_and_si128(maskLo, f), _mm_andnot_si128(maskLo, b)),
+                    hi = _mm_or_si128(_mm_and_si128(maskHi, f), _mm_andnot_si128(maskHi, b));
+      for (; count >= 8; count -= 8, dst += 8)
+      {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst+4), hi);
+      }
+    }
+    else
+      for (; count >= 8; count -= 8, dst += 8)
+      {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst)),
+                      hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst+4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),   _mm_or_si128(_mm_and_si128(maskLo, f), _mm_andnot_si128(maskLo, lo)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst+4), _mm_or_si128(_mm_and_si128(maskHi, f), _mm_andnot_si128(maskHi, hi)));
+      }
+#endif
+    // Remainder  (Pattern phase is unchanged after whole multiples of 8)
+    for (int32_t i = 0; i < count; ++i)
+    {
+      if (rot & (1u << (i & 7)))
+        dst[i] = fore;
+      else if (opaque)
+        dst[i] = back;
+    }
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::copySpan
+  //! Copies a horizontal run of pixels  (Non-overlapping; the library copy is already vectorized)
+  //!
+  //! \param[in,out] dst - First destination pixel
+  //! \param[in] src - First source pixel
+  //! \param[in] count - Number of pixels
+  ///////////////////////////////////////////////////////////////////////////////
+  inline void copySpan(uint32_t* dst, const uint32_t* src, int32_t count)
+  {
+    if (count > 0)
+      std::memcpy(dst, src, size_t(count) * sizeof(uint32_t));
+  }
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\SpatialGrid.h
+//! \brief Defines a uniform-grid spatial index of bounding rectangles
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_SPATIAL_GRID_H
+#define RENDER_SPATIAL_GRID_H
+
+#include <vector>             //!< std::vector
+#include <algorithm>          //!< std::sort
+#include "Types.h"            //!< hw1::render::RectL
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SpatialGrid - Uniform grid of square cells referencing the items that overlap them
+  //!
+  //! Items are identified by their insertion index. Items lying partially or entirely outside
+  //! the grid extent are clamped into the border cells, so queries remain exact for any
+  //! rectangle. Query results are returned in insertion order, which preserves painter's
+  //! order when items are inserted in drawing order.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct SpatialGrid
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias index_t - Item index type
+    using index_t = uint32_t;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    RectL                              Extent;          //!< Area covered by the grid
+    int32_t                            CellSize = 64,   //!< Cell dimensions in pixels
+                                       Columns = 1,     //!< Number of columns
+                                       Rows = 1;        //!< Number of rows
+    std::vector<std::vector<index_t>>  Cells;           //!< Items overlapping each cell
+    std::vector<RectL>                 Bounds;          //!< Bounding rectangle of each item
+    mutable std::vector<uint32_t>      Stamps;          //!< Query stamp of each item (For de-duplication)
+    mutable uint32_t                   Stamp = 0;       //!< Current query stamp
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    SpatialGrid() : Cells(1)
+    {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::SpatialGrid
+    //! Create an empty grid
+    //!
+    //! \param[in] extent - Area covered by the grid
+    //! \param[in] cellSize - Cell dimensions in pixels
+    ///////////////////////////////////////////////////////////////////////////////
+    SpatialGrid(const RectL& extent, int32_t cellSize)
+      : Extent(extent.normalized()),
+        CellSize(std::max(1, cellSize)),
+        Columns(std::max(1, (Extent.width() + CellSize-1) / CellSize)),
+        Rows(std::max(1, (Extent.height() + CellSize-1) / CellSize)),
+        Cells(size_t(Columns)*Rows)
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t        size() const                { return Bounds.size(); }
+    const RectL&  bounds(index_t item) const  { return Bounds[item]; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::query const
+    //! Find all items whose bounds intersect a rectangle
+    //!
+    //! \param[in] rc - Query rectangle
+    //! \param[out] results - Receives intersecting items in insertion order  (Cleared first)
+    ///////////////////////////////////////////////////////////////////////////////
+    void query(const RectL& rc, std::vector<index_t>& results) const
+    {
+      results.clear();
+      const RectL r = rc.normalized();
+      if (r.empty() || Bounds.empty())
+        return;
+
+      // Advance stamp (Reset upon wrap-around)
+      if (++Stamp == 0)
+        std::fill(Stamps.begin(), Stamps.end(), 0), Stamp = 1;
+
+      int32_t c0, r0, c1, r1;
+      cellRange(r, c0, r0, c1, r1);
+
+      for (int32_t row = r0; row <= r1; ++row)
+        for (int32_t col = c0; col <= c1; ++col)
+          for (index_t item : Cells[size_t(row)*Columns + col])
+            if (Stamps[item] != Stamp && (Stamps[item] = Stamp, Bounds[item].intersects(r)))
+              results.push_back(item);
+
+      // Restore painter's order
+      std::sort(results.begin(), results.end());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::query const
+    //! Find all items whose bounds contain a point
+    //!
+    //! A point lies within a single cell, so no de-duplication is needed: unlike the rectangle
+    //! query this modifies nothing and may run concurrently with other queries.
+    //!
+    //! \param[in] pt - Query point
+    //! \param[out] results - Receives containing items in insertion order  (Cleared first)
+    ///////////////////////////////////////////////////////////////////////////////
+    void query(PointL pt, std::vector<index_t>& results) const
+    {
+      results.clear();
+      if (Bounds.empty())
+        return;
+
+      int32_t c0, r0, c1, r1;
+      cellRange(RectL(pt.x, pt.y, pt.x+1, pt.y+1), c0, r0, c1, r1);
+
+      // Cells are filled in insertion order
+      for (index_t item : Cells[size_t(r0)*Columns + c0])
+        if (Bounds[item].contains(pt))
+          results.push_back(item);
+    }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::clear
+    //! Remove all items
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      for (auto& cell : Cells)
+        cell.clear();
+      Bounds.clear();
+      Stamps.clear();
+      Stamp = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::insert
+    //! Add an item
+    //!
+    //! \param[in] rc - Bounding rectangle
+    //! \return index_t - Item index
+    ///////////////////////////////////////////////////////////////////////////////
+    index_t insert(const RectL& rc)
+    {
+      const index_t item = index_t(Bounds.size());
+      const RectL r = rc.normalized();
+      Bounds.push_back(r);
+      Stamps.push_back(0);
+
+      int32_t c0, r0, c1, r1;
+      cellRange(r, c0, r0, c1, r1);
+
+      for (int32_t row = r0; row <= r1; ++row)
+        for (int32_t col = c0; col <= c1; ++col)
+          Cells[size_t(row)*Columns + col].push_back(item);
+      return item;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // SpatialGrid::cellRange const
+    //! Calculate the (inclusive) range of cells overlapped by a rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    void cellRange(const RectL& r, int32_t& c0, int32_t& r0, int32_t& c1, int32_t& r1) const
+    {
+      auto column = [this](int32_t x) { return std::min(Columns-1, std::max(0, floorDiv(x - Extent.left, CellSize))); };
+      auto row    = [this](int32_t y) { return std::min(Rows-1,    std::max(0, floorDiv(y - Extent.top,  CellSize))); };
+
+      c0 = column(r.left);
+      c1 = column(r.right-1);
+      r0 = row(r.top);
+      r1 = row(r.bottom-1);
+    }
+
+    static int32_t floorDiv(int32_t a, int32_t b)
+    {
+      return a >= 0 ? a / b : -((-a + b-1) / b);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
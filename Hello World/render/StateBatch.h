@@ -0,0 +1,244 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\StateBatch.h
+//! \brief Defines reordering of primitives to minimise render state changes
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_STATE_BATCH_H
+#define RENDER_STATE_BATCH_H
+
+#include <vector>             //!< std::vector
+#include <algorithm>          //!< std::sort
+#include <cstdint>            //!< INT64_MAX
+#include "Types.h"            //!< hw1::render::RectL
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct StateBatch - Records primitives and orders them by render state
+  //!
+  //! Each primitive carries a render state identifier and a bounding rectangle. Primitives
+  //! are reordered so that equal states are contiguous, while any two primitives that
+  //! overlap and differ in state keep their submission order. The result is therefore
+  //! pixel-identical to drawing in submission order.
+  //!
+  //! Ordering assigns each primitive a layer one greater than the deepest earlier overlapping
+  //! primitive of a different state (or equal to an earlier overlapping primitive of the same
+  //! state), then sorts by (layer, state, submission index). States need not be dense: they
+  //! are counted into place when there are few (layer, state) combinations, and otherwise
+  //! sorted as packed 64-bit keys, so callers may use a packed description of the state itself.
+  //!
+  //! Overlap is judged per grid cell: each cell records only its top layer and the state of the
+  //! primitives within it, so layering costs the cells a primitive covers rather than the number
+  //! of primitives beneath it. Primitives sharing a cell without overlapping may be layered
+  //! unnecessarily, which costs state changes but never changes the result.
+  //! The grid is measured in 64-bit so primitives may lie anywhere within the 32-bit plane;
+  //! an extent too large to grid is drawn in submission order.
+  //!
+  //! Batches are limited to Capacity primitives. Beyond that, grouping by state separates the
+  //! parts of each instance so far that they are no longer cached, which costs more than the
+  //! state changes saved.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct StateBatch
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Capacity - Primitives ordered at once  (Callers draw larger submissions as consecutive batches)
+    static constexpr size_t Capacity = 256;
+
+    //! \var CellSize - Minimum dimensions of the grid cells used to find overlapping primitives
+    static constexpr int32_t CellSize = 16;
+
+    //! \var CellsPerEntry - Number of grid cells per primitive  (Cells are enlarged to cover sparse primitives)
+    static constexpr int64_t CellsPerEntry = 16;
+
+    //! \var MaxCells - Maximum number of grid cells  (Cells are enlarged to cover larger extents)
+    static constexpr int64_t MaxCells = 1 << 16;
+
+    //! \struct Entry - Recorded primitive
+    struct Entry
+    {
+      uint32_t  Layer;        //!< Dependency layer
+      uint32_t  State;        //!< Render state identifier
+      uint32_t  Index;        //!< Submission index
+
+      bool operator< (const Entry& r) const
+      {
+        return Layer != r.Layer ? Layer < r.Layer
+             : State != r.State ? State < r.State
+             : Index < r.Index;
+      }
+    };
+
+  private:
+    //! \struct Cell - Topmost layer of the primitives covering a grid cell
+    struct Cell
+    {
+      //! \var Empty - State of a cell not yet covered
+      static constexpr uint32_t Empty = ~0u;
+
+      //! \var Mixed - State of a cell whose top layer holds primitives of several states
+      static constexpr uint32_t Mixed = ~0u - 1;
+
+      uint32_t  Top = 0;          //!< Top layer
+      uint32_t  State = Empty;    //!< Render state of the primitives within the top layer
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    std::vector<Entry>     Entries;    //!< Recorded primitives
+    std::vector<RectL>     Bounds;     //!< Bounding rectangle of each primitive
+    std::vector<Entry>     Order;      //!< Primitives in drawing order
+    std::vector<Cell>      Cells;      //!< Top layer of each grid cell
+    std::vector<uint32_t>  Counts;     //!< Position of each (layer, state) within the drawing order
+    std::vector<uint64_t>  Keys;       //!< Packed (layer, state, submission) of each primitive
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t size() const { return Entries.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // StateBatch::clear
+    //! Discard recorded primitives  (Retains storage)
+    ///////////////////////////////////////////////////////////////////////////////
+    void clear()
+    {
+      Entries.clear();
+      Bounds.clear();
+      Order.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // StateBatch::add
+    //! Record a primitive
+    //!
+    //! \param[in] state - Render state identifier
+    //! \param[in] bounds - Bounding rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    void add(uint32_t state, const RectL& bounds)
+    {
+      Entries.push_back(Entry{0, state, uint32_t(Entries.size())});
+      Bounds.push_back(bounds);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // StateBatch::order
+    //! Calculate the drawing order
+    //!
+    //! \return const std::vector<Entry>& - Primitives in drawing order  (Carrying their state, so replay reads them sequentially)
+    ///////////////////////////////////////////////////////////////////////////////
+    const std::vector<Entry>& order()
+    {
+      Order.clear();
+      if (Entries.empty())
+        return Order;
+
+      // Measure the extent in 64-bit, since primitives may lie anywhere within the 32-bit plane
+      int64_t left = INT64_MAX, top = INT64_MAX, right = INT64_MIN, bottom = INT64_MIN;
+      for (const RectL& rc : Bounds)
+        if (!rc.empty())
+          left = std::min<int64_t>(left, rc.left), top = std::min<int64_t>(top, rc.top),
+          right = std::max<int64_t>(right, rc.right), bottom = std::max<int64_t>(bottom, rc.bottom);
+
+      // Cover the primitives with a grid of at most CellsPerEntry cells per primitive  (Clearing it costs less than layering)
+      const int64_t budget = std::min(MaxCells, int64_t(Entries.size()) * CellsPerEntry),
+                    width = std::max<int64_t>(0, right - left),
+                    height = std::max<int64_t>(0, bottom - top);
+      int64_t cell = CellSize;
+      while (((width + cell-1) / cell) * ((height + cell-1) / cell) > budget && cell <= INT32_MAX)
+        cell *= 2;
+
+      // [NO GRID] Draw in submission order  (Always correct)
+      if (left > right || cell > INT32_MAX)
+      {
+        Order.assign(Entries.begin(), Entries.end());
+        return Order;
+      }
+
+      const int64_t columns = std::max<int64_t>(1, (width + cell-1) / cell),
+                    rows = std::max<int64_t>(1, (height + cell-1) / cell);
+      Cells.assign(size_t(columns*rows), Cell{});
+
+      // Layer each primitive above the top layer of the cells it covers, then raise them
+      uint32_t layers = 0, states = 0;
+      for (Entry& e : Entries)
+      {
+        const RectL& rc = Bounds[e.Index];
+        e.Layer = 0;
+        states = std::max(states, e.State+1);
+        if (rc.empty())
+          continue;
+
+        const int64_t x0 = std::min(columns-1, std::max<int64_t>(0, (rc.left - left) / cell)),
+                      x1 = std::min(columns-1, std::max<int64_t>(0, (int64_t(rc.right)-1 - left) / cell)),
+                      y0 = std::min(rows-1, std::max<int64_t>(0, (rc.top - top) / cell)),
+                      y1 = std::min(rows-1, std::max<int64_t>(0, (int64_t(rc.bottom)-1 - top) / cell));
+
+        for (int64_t y = y0; y <= y1; ++y)
+          for (const Cell* c = &Cells[size_t(y*columns + x0)], *end = c + (x1-x0+1); c != end; ++c)
+            if (c->State != Cell::Empty)
+              e.Layer = std::max(e.Layer, c->Top + (c->State != e.State ? 1 : 0));
+
+        for (int64_t y = y0; y <= y1; ++y)
+          for (Cell* c = &Cells[size_t(y*columns + x0)], *end = c + (x1-x0+1); c != end; ++c)
+            if (c->State == Cell::Empty || e.Layer > c->Top)
+              *c = Cell{e.Layer, e.State};
+            else if (c->State != e.State)
+              c->State = Cell::Mixed;
+        layers = std::max(layers, e.Layer+1);
+      }
+
+      // Sort by (layer, state, submission)
+      const uint64_t keys = uint64_t(std::max(layers, 1u)) * states;
+      if (keys > Entries.size())
+      {
+        if (Entries.size() > 0xFFFF)
+        {
+          Order.assign(Entries.begin(), Entries.end());
+          std::sort(Order.begin(), Order.end());
+          return Order;
+        }
+
+        // Sort packed keys  (Layers and submission indices are fewer than 2^16)
+        Keys.clear();
+        for (const Entry& e : Entries)
+          Keys.push_back(uint64_t(e.Layer) << 48 | uint64_t(e.State) << 16 | e.Index);
+        std::sort(Keys.begin(), Keys.end());
+        Order.resize(Entries.size());
+        for (size_t n = 0; n != Keys.size(); ++n)
+          Order[n] = Entry{uint32_t(Keys[n] >> 48), uint32_t(Keys[n] >> 16), uint32_t(Keys[n] & 0xFFFF)};
+        return Order;
+      }
+
+      // Count primitives of each (layer, state) when there are fewer combinations than primitives  (Entries are in submission order)
+      Counts.assign(keys + 1, 0);
+      for (const Entry& e : Entries)
+        ++Counts[size_t(e.Layer)*states + e.State + 1];
+      for (size_t k = 1; k <= keys; ++k)
+        Counts[k] += Counts[k-1];
+      Order.resize(Entries.size());
+      for (const Entry& e : Entries)
+        Order[Counts[size_t(e.Layer)*states + e.State]++] = e;
+      return Order;
+    }
+  };
+
+  //! \var StateBatch::Capacity - Primitives ordered at once
+  constexpr size_t  StateBatch::Capacity;
+
+  //! \var StateBatch::CellSize - Minimum dimensions of the grid cells
+  constexpr int32_t  StateBatch::CellSize;
+
+  //! \var StateBatch::CellsPerEntry - Number of grid cells per primitive
+  constexpr int64_t  StateBatch::CellsPerEntry;
+
+  //! \var StateBatch::MaxCells - Maximum number of grid cells
+  constexpr int64_t  StateBatch::MaxCells;
+
+} } // namespace hw1::render
+
+#endif
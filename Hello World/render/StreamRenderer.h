@@ -0,0 +1,262 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\StreamRenderer.h
+//! \brief Defines rendering of frames as a stream of bands of rows, encoded on a second thread
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_STREAM_RENDERER_H
+#define RENDER_STREAM_RENDERER_H
+
+#include <algorithm>            //!< std::min
+#include <condition_variable>   //!< std::condition_variable
+#include <deque>                //!< std::deque
+#include <functional>           //!< std::function
+#include <mutex>                //!< std::mutex
+#include <thread>               //!< std::thread
+#include <vector>               //!< std::vector
+#include "Types.h"              //!< hw1::render::RectL
+#include "Framebuffer.h"        //!< hw1::render::Framebuffer
+#include "CommandList.h"        //!< hw1::render::CommandList
+#include "DeviceContext.h"      //!< hw1::render::DeviceContext
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct StreamRenderer - Renders frames of any size through a small ring of bands
+  //!
+  //! Each frame is drawn into a recording DeviceContext, its commands are binned into bands
+  //! of rows, and the bands are rasterized top to bottom into whichever band of the ring is
+  //! free. Rasterized bands are handed, in order, to the frame's sink on an encoding thread,
+  //! so memory is bounded by the ring rather than the frame. The next frame is recorded and
+  //! rasterized while the bands of the previous frame are still being encoded.
+  //!
+  //! Like the TileRenderer, rasterization does not depend on the clipping rectangle, so the
+  //! bands are bit-identical to the rows of a frame drawn directly.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct StreamRenderer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \alias sink_t - Consumes a band  (Called on the encoding thread with rows band.top() to band.top()+rows)
+    using sink_t = std::function<void (const Framebuffer& band, int32_t rows)>;
+
+    //! \var DefaultBandHeight - Default number of rows in each band
+    static constexpr int32_t DefaultBandHeight = 64;
+
+    //! \var DefaultBands - Default number of bands in the ring
+    static constexpr unsigned DefaultBands = 4;
+
+  private:
+    //! \struct Band - Band of a frame
+    struct Band
+    {
+      Framebuffer  Pixels;             //!< Rasterized rows
+      int32_t      Rows = 0;           //!< Rows of the frame within the band
+      sink_t*      Sink = nullptr;     //!< Sink of the frame
+      bool         Last = false;       //!< Whether the band completes its frame
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    int32_t                             BandHeight;          //!< Rows in each band
+    bool                                Pipelined;           //!< Whether bands are encoded on a second thread
+    CommandList                         Commands;            //!< Commands of current frame
+    std::vector<std::vector<uint32_t>>  Bins;                //!< Commands overlapping each band of current frame
+    std::vector<Band>                   Ring;                //!< Bands
+    std::vector<uint32_t>               Free;                //!< Bands available for rasterizing
+    std::deque<uint32_t>                Queue;               //!< Rasterized bands awaiting encoding, in order
+    std::deque<sink_t>                  Sinks;               //!< Sinks of frames being encoded  (Stable addresses)
+    bool                                Stopping = false;    //!< Whether the encoding thread should exit
+    std::mutex                          Lock;                //!< Guards the ring, queue and sinks
+    std::condition_variable             Changed;             //!< Signalled when a band is queued or freed
+    std::thread                         Encoder;             //!< Encoding thread  (If pipelined)
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::StreamRenderer
+    //! Create a renderer
+    //!
+    //! \param[in] bandHeight - [optional] Rows in each band
+    //! \param[in] bands - [optional] Bands in the ring  (At least two when pipelined)
+    //! \param[in] pipelined - [optional] Whether bands are encoded on a second thread  (Otherwise by the caller)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit StreamRenderer(int32_t bandHeight = DefaultBandHeight, unsigned bands = DefaultBands, bool pipelined = true)
+      : BandHeight(std::max(bandHeight, 1)), Pipelined(pipelined), Ring(pipelined ? std::max(bands, 2u) : 1)
+    {
+      for (uint32_t idx = 0; idx < uint32_t(Ring.size()); ++idx)
+        Free.push_back(idx);
+      if (Pipelined)
+        Encoder = std::thread([this] { encode(); });
+    }
+
+    StreamRenderer(const StreamRenderer&) = delete;
+    StreamRenderer& operator= (const StreamRenderer&) = delete;
+
+    ~StreamRenderer()
+    {
+      if (!Pipelined)
+        return;
+
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Stopping = true;
+      }
+      Changed.notify_all();
+      Encoder.join();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    int32_t  bandHeight() const  { return BandHeight; }
+    size_t   bands() const       { return Ring.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::render
+    //! Render a frame, returning once its last band is rasterized  (Encoding may continue)
+    //!
+    //! \param[in] width - Frame width
+    //! \param[in] height - Frame height
+    //! \param[in] draw - Callable as draw(DeviceContext&) that issues the frame's drawing commands
+    //! \param[in] sink - Consumes each band of the frame, top to bottom
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename DRAW>
+    void render(int32_t width, int32_t height, DRAW&& draw, sink_t sink)
+    {
+      if (width <= 0 || height <= 0)
+        return;
+
+      // Record
+      const RectL extent(0, 0, width, height);
+      Commands.clear();
+      DeviceContext recorder(Commands, extent);
+      draw(recorder);
+      bin(extent);
+
+      sink_t* frameSink;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Sinks.push_back(std::move(sink));
+        frameSink = &Sinks.back();
+      }
+
+      for (int32_t top = 0, idx = 0; top < height; top += BandHeight, ++idx)
+      {
+        // Wait for a free band
+        uint32_t free;
+        {
+          std::unique_lock<std::mutex> lock(Lock);
+          Changed.wait(lock, [this] { return !Free.empty(); });
+          free = Free.back();
+          Free.pop_back();
+        }
+
+        // Rasterize
+        Band& band = Ring[free];
+        if (band.Pixels.width() != width || band.Pixels.height() != BandHeight)
+          band.Pixels.resize(width, BandHeight);
+        band.Pixels.offset(top);
+        band.Rows = std::min(BandHeight, height - top);
+        band.Sink = frameSink;
+        band.Last = top + BandHeight >= height;
+        if (Bins[idx].empty())
+          band.Pixels.fill(band.Pixels.bounds(), 0);
+        else
+        {
+          DeviceContext dc(band.Pixels);
+          dc.setClip(RectL(0, top, width, top + band.Rows));
+          dc.replay(Commands, Bins[idx]);
+        }
+
+        // Encode
+        if (Pipelined)
+        {
+          {
+            std::lock_guard<std::mutex> lock(Lock);
+            Queue.push_back(free);
+          }
+          Changed.notify_all();
+        }
+        else
+          complete(free);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::finish
+    //! Wait until every rasterized band has been encoded
+    ///////////////////////////////////////////////////////////////////////////////
+    void finish()
+    {
+      std::unique_lock<std::mutex> lock(Lock);
+      Changed.wait(lock, [this] { return Free.size() == Ring.size(); });
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::bin
+    //! Assign each recorded command to the bands it overlaps
+    ///////////////////////////////////////////////////////////////////////////////
+    void bin(const RectL& extent)
+    {
+      Bins.resize(size_t((extent.height() + BandHeight-1) / BandHeight));
+      for (auto& b : Bins)
+        b.clear();
+
+      for (uint32_t idx = 0; idx < uint32_t(Commands.Commands.size()); ++idx)
+      {
+        const RectL r = Commands.Commands[idx].Bounds.intersect(extent);
+        if (r.empty())
+          continue;
+        for (int32_t band = r.top / BandHeight; band <= (r.bottom-1) / BandHeight; ++band)
+          Bins[band].push_back(idx);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::complete
+    //! Pass a band to its sink and return it to the ring
+    ///////////////////////////////////////////////////////////////////////////////
+    void complete(uint32_t idx)
+    {
+      Band& band = Ring[idx];
+      (*band.Sink)(band.Pixels, band.Rows);
+
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (band.Last)
+          Sinks.pop_front();
+        Free.push_back(idx);
+      }
+      Changed.notify_all();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // StreamRenderer::encode
+    //! Encoding thread: passes rasterized bands to their sinks in order
+    ///////////////////////////////////////////////////////////////////////////////
+    void encode()
+    {
+      for (;;)
+      {
+        uint32_t idx;
+        {
+          std::unique_lock<std::mutex> lock(Lock);
+          Changed.wait(lock, [this] { return Stopping || !Queue.empty(); });
+          if (Queue.empty())
+            return;
+          idx = Queue.front();
+          Queue.pop_front();
+        }
+        complete(idx);
+      }
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,349 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Tessellator.h
+//! \brief Defines compile-time conversion of fixed-size shapes into scanline span tables
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TESSELLATOR_H
+#define RENDER_TESSELLATOR_H
+
+#include <cstddef>            //!< size_t
+#include "Types.h"            //!< hw1::render::RectL
+#include "Rasterizer.h"       //!< hw1::render::PointF
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ShapeSpan - Horizontal run of a shape relative to its origin
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ShapeSpan
+  {
+    int32_t  y,           //!< Row
+             x0,          //!< First column
+             x1;          //!< Column beyond last
+    bool     outline;     //!< Whether drawn by the pen (Otherwise the brush)
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SpanTable - Fixed-capacity table of spans in drawing order
+  //!
+  //! \tparam N - Capacity
+  ///////////////////////////////////////////////////////////////////////////////
+  template <size_t N>
+  struct SpanTable
+  {
+    ShapeSpan  Spans[N];    //!< Spans in drawing order
+    size_t     Count;       //!< Number of spans
+    RectL      Bounds;      //!< Bounding rectangle of all spans
+
+    constexpr SpanTable() : Spans{}, Count(0), Bounds()
+    {}
+
+    constexpr void operator() (int32_t y, int32_t x0, int32_t x1, bool outline)
+    {
+      Spans[Count++] = ShapeSpan{y, x0, x1, outline};
+      Bounds = Bounds.unite(RectL(x0, y, x1, y+1));
+    }
+
+    constexpr const ShapeSpan* begin() const { return Spans; }
+    constexpr const ShapeSpan* end() const   { return Spans + Count; }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SpanCounter - Counts spans to size a SpanTable
+  ///////////////////////////////////////////////////////////////////////////////
+  struct SpanCounter
+  {
+    size_t  Count = 0;
+
+    constexpr void operator() (int32_t, int32_t, int32_t, bool)
+    {
+      ++Count;
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Tessellator - Compile-time twin of the Rasterizer
+  //!
+  //! Performs the same single-precision arithmetic as Rasterizer::ellipse(), polygon()
+  //! and outline() without clipping, using constexpr substitutes for std::sqrt, std::ceil
+  //! and std::sort, so that spans produced at compile time match those the Rasterizer produces
+  //! for the same shape built at the origin. Tables are drawn by integer translation of those
+  //! spans, whereas the Rasterizer rounds chord ends such as 'cx - h - 0.5' at the absolute
+  //! position; where the centre is non-integral (odd widths), single-precision rounding there
+  //! may place an end one pixel from the translated table.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Tessellator
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var MaxCrossings - Upper bound on crossings tracked per scanline
+    static constexpr int32_t MaxCrossings = Rasterizer::MaxCrossings;
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::ellipse
+    //! Tessellate an ellipse inscribed within a rectangle  (See Rasterizer::ellipse)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename SINK>
+    static constexpr void ellipse(const RectL& rc, int32_t penWidth, SINK& sink)
+    {
+      const RectL r = rc.normalized();
+      const float cx = (r.left + r.right) * 0.5f,
+                  cy = (r.top + r.bottom) * 0.5f,
+                  ra = r.width() * 0.5f,
+                  rb = r.height() * 0.5f,
+                  ia = ra - penWidth,
+                  ib = rb - penWidth;
+
+      if (ra <= 0 || rb <= 0)
+        return;
+
+      for (int32_t y = r.top; y < r.bottom; ++y)
+      {
+        const float dy = (y + 0.5f) - cy;
+        int32_t ox0 = 0, ox1 = 0;
+        if (!chord(cx, dy, ra, rb, ox0, ox1))
+          continue;
+
+        int32_t ix0 = 0, ix1 = 0;
+        if (ia <= 0 || ib <= 0 || !chord(cx, dy, ia, ib, ix0, ix1))
+        {
+          emit(sink, y, ox0, ox1, true);
+          continue;
+        }
+        emit(sink, y, ox0, ix0, true);
+        emit(sink, y, ix0, ix1, false);
+        emit(sink, y, ix1, ox1, true);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::shape
+    //! Tessellate a polygon and its outline  (See DeviceContext::polygon)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename POINT, size_t N, typename SINK>
+    static constexpr void shape(const POINT (&pts)[N], int32_t penWidth, SINK& sink)
+    {
+      PointF verts[N] = {};
+      for (size_t i = 0; i < N; ++i)
+        verts[i] = PointF{ float(pts[i].x), float(pts[i].y) };
+
+      polygon(verts, int32_t(N), false, sink);
+      if (penWidth)
+        for (int32_t i = 0, j = int32_t(N)-1; i < int32_t(N); j = i++)
+          line(verts[j], verts[i], float(penWidth), sink);
+    }
+
+  private:
+    template <typename SINK>
+    static constexpr void emit(SINK& sink, int32_t y, int32_t x0, int32_t x1, bool outline)
+    {
+      if (x0 < x1)
+        sink(y, x0, x1, outline);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::polygon
+    //! Tessellate a polygon using the alternate (even-odd) fill rule  (See Rasterizer::polygon)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename SINK>
+    static constexpr void polygon(const PointF* pts, int32_t count, bool outline, SINK& sink)
+    {
+      if (count < 3)
+        return;
+
+      float minY = pts[0].y, maxY = pts[0].y;
+      for (int32_t i = 1; i < count; ++i)
+        minY = minY < pts[i].y ? minY : pts[i].y,
+        maxY = maxY > pts[i].y ? maxY : pts[i].y;
+
+      const int32_t y0 = ceil(minY - 0.5f),
+                    y1 = ceil(maxY - 0.5f);
+
+      for (int32_t y = y0; y < y1; ++y)
+      {
+        const float sy = y + 0.5f;
+        float xs[MaxCrossings] = {};
+        int32_t n = 0;
+
+        for (int32_t i = 0, j = count-1; i < count && n < MaxCrossings; j = i++)
+        {
+          const PointF& a = pts[j];
+          const PointF& b = pts[i];
+          if ((a.y <= sy) != (b.y <= sy))
+            xs[n++] = a.x + (sy - a.y) * (b.x - a.x) / (b.y - a.y);
+        }
+
+        // Insertion sort
+        for (int32_t k = 1; k < n; ++k)
+          for (int32_t m = k; m > 0 && xs[m] < xs[m-1]; --m)
+          {
+            const float t = xs[m];
+            xs[m] = xs[m-1], xs[m-1] = t;
+          }
+
+        for (int32_t k = 0; k+1 < n; k += 2)
+          emit(sink, y, ceil(xs[k] - 0.5f), ceil(xs[k+1] - 0.5f), outline);
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::line
+    //! Tessellate a thick line segment with square end caps  (See Rasterizer::line)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename SINK>
+    static constexpr void line(PointF a, PointF b, float width, SINK& sink)
+    {
+      const float dx = b.x - a.x,
+                  dy = b.y - a.y,
+                  len = sqrt(dx*dx + dy*dy);
+      if (len <= 0.0f || width <= 0.0f)
+        return;
+
+      const float h = width * 0.5f,
+                  ux = dx / len * h,
+                  uy = dy / len * h;
+      const PointF quad[4] = { {a.x - ux - uy, a.y - uy + ux},
+                               {b.x + ux - uy, b.y + uy + ux},
+                               {b.x + ux + uy, b.y + uy - ux},
+                               {a.x - ux + uy, a.y - uy - ux} };
+      polygon(quad, 4, true, sink);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::chord
+    //! Calculate the pixel span of an ellipse at a vertical offset from its centre  (See Rasterizer::chord)
+    ///////////////////////////////////////////////////////////////////////////////
+    static constexpr bool chord(float cx, float dy, float a, float b, int32_t& x0, int32_t& x1)
+    {
+      const float t = 1.0f - (dy*dy) / (b*b);
+      if (t <= 0.0f)
+        return false;
+
+      const float h = a * sqrt(t);
+      x0 = ceil(cx - h - 0.5f);
+      x1 = ceil(cx + h - 0.5f);
+      return x0 < x1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::ceil
+    //! Round towards positive infinity
+    ///////////////////////////////////////////////////////////////////////////////
+    static constexpr int32_t ceil(float v)
+    {
+      const int32_t i = int32_t(v);
+      return float(i) < v ? i+1 : i;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tessellator::sqrt
+    //! Calculate a correctly rounded square root
+    //!
+    //! Newton's method converges in double precision; rounding the result to single
+    //! precision then matches std::sqrt(float) exactly.
+    ///////////////////////////////////////////////////////////////////////////////
+    static constexpr float sqrt(float v)
+    {
+      if (v <= 0.0f)
+        return 0.0f;
+
+      // Iterates monotonically downwards from above the root until no further progress
+      double x = v >= 1.0f ? double(v) : 1.0;
+      for (;;)
+      {
+        const double next = 0.5 * (x + double(v) / x);
+        if (next >= x)
+          break;
+        x = next;
+      }
+      return float(x);
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::tessellate
+  //! Tessellate a shape into a table sized exactly at compile time
+  //!
+  //! \tparam SHAPE - Type whose static constexpr method 'tessellate(sink)' emits the spans
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename SHAPE>
+  constexpr size_t spanCount()
+  {
+    SpanCounter c;
+    SHAPE::tessellate(c);
+    return c.Count;
+  }
+
+  template <typename SHAPE>
+  constexpr SpanTable<spanCount<SHAPE>()> tessellate()
+  {
+    SpanTable<spanCount<SHAPE>()> t;
+    SHAPE::tessellate(t);
+    return t;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct EllipseSpans - Span table of an ellipse of fixed size, built at compile time
+  //!
+  //! \tparam W - Width  (May be negative)
+  //! \tparam H - Height  (May be negative)
+  //! \tparam PEN - Outline width
+  ///////////////////////////////////////////////////////////////////////////////
+  template <int32_t W, int32_t H, int32_t PEN>
+  struct EllipseSpans
+  {
+    template <typename SINK>
+    static constexpr void tessellate(SINK& sink)
+    {
+      Tessellator::ellipse(RectL(0, 0, W, H), PEN, sink);
+    }
+
+    //! \var Table - Spans relative to the corner of the bounding rectangle
+    static constexpr decltype(render::tessellate<EllipseSpans>()) Table = render::tessellate<EllipseSpans>();
+  };
+
+  template <int32_t W, int32_t H, int32_t PEN>
+  constexpr decltype(render::tessellate<EllipseSpans<W,H,PEN>>())  EllipseSpans<W,H,PEN>::Table;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ShapeSpans - Span table of a constant polygon, built at compile time
+  //!
+  //! \tparam SHAPE - Type whose static constexpr array 'Points' defines the vertices
+  //! \tparam PEN - Outline width
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename SHAPE, int32_t PEN>
+  struct ShapeSpans
+  {
+    template <typename SINK>
+    static constexpr void tessellate(SINK& sink)
+    {
+      Tessellator::shape(SHAPE::Points, PEN, sink);
+    }
+
+    //! \var Table - Spans relative to the shape origin
+    static constexpr decltype(render::tessellate<ShapeSpans>()) Table = render::tessellate<ShapeSpans>();
+  };
+
+  template <typename SHAPE, int32_t PEN>
+  constexpr decltype(render::tessellate<ShapeSpans<SHAPE,PEN>>())  ShapeSpans<SHAPE,PEN>::Table;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TriangleShape - Vertices of a TriangleL of fixed size, relative to its origin
+  ///////////////////////////////////////////////////////////////////////////////
+  template <int32_t W, int32_t H>
+  struct TriangleShape
+  {
+    static constexpr POINT Points[3] = { {0, 0}, {W/2, -H}, {W, 0} };
+  };
+
+  template <int32_t W, int32_t H>
+  constexpr POINT TriangleShape<W,H>::Points[3];
+
+} } // namespace hw1::render
+
+#endif
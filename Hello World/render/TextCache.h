@@ -0,0 +1,357 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\TextCache.h
+//! \brief Defines the cache of text layouts and the atlas of pre-rasterized glyphs
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TEXT_CACHE_H
+#define RENDER_TEXT_CACHE_H
+
+#include <cstring>            //!< std::strlen
+#include <list>               //!< std::list
+#include <memory>             //!< std::shared_ptr
+#include <mutex>              //!< std::mutex
+#include <string>             //!< std::string
+#include <unordered_map>      //!< std::unordered_map
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::HFont, hw1::render::faceHash
+#include "Font.h"             //!< hw1::render::BitmapFont
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct GlyphAtlas - Glyphs rasterized at their final size and packed into shared pages
+  //!
+  //! Each glyph covers one whole character cell (advance x line height) as one byte per
+  //! pixel (non-zero => ink). Glyphs are packed onto shelves within fixed-size pages; pages
+  //! are never moved or released, so glyph pixels remain valid for the atlas lifetime.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct GlyphAtlas
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var PageSize - Dimensions of each page in pixels  (Larger glyphs receive their own page)
+    static constexpr int32_t PageSize = 256;
+
+    //! \struct Glyph - Location of a glyph within the atlas
+    struct Glyph
+    {
+      const uint8_t*  Pixels;     //!< Top-left pixel
+      int32_t         Pitch,      //!< Page width in pixels
+                      Width,      //!< Cell width
+                      Height;     //!< Cell height
+    };
+
+  private:
+    //! \struct Page - Block of glyph pixels
+    struct Page
+    {
+      int32_t                     Width,
+                                  Height;
+      std::unique_ptr<uint8_t[]>  Pixels;
+    };
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    std::vector<Page>                    Pages;          //!< Glyph pages
+    std::unordered_map<uint64_t,Glyph>   Glyphs;         //!< Glyphs keyed by face hash, height, weight and character
+    int32_t                              ShelfX = 0,     //!< Next free column of current shelf
+                                         ShelfY = 0,     //!< Top of current shelf
+                                         ShelfHeight = 0;  //!< Height of current shelf
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    size_t  size() const  { return Glyphs.size(); }
+    size_t  pages() const { return Pages.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // GlyphAtlas::glyph
+    //! Find a glyph, rasterizing it on first use
+    //!
+    //! \param[in] font - Font
+    //! \param[in] face - Hash of the font face name  (See faceHash())
+    //! \param[in] ch - Character
+    //! \param[out] created - Set when the glyph was rasterized by this call
+    //! \return const Glyph* - Glyph, or nullptr if the glyph has no ink
+    ///////////////////////////////////////////////////////////////////////////////
+    const Glyph* glyph(const HFont& font, uint32_t face, char ch, bool& created)
+    {
+      const bool bold = font.weight >= FontWeight::Bold;
+      const uint64_t key = (uint64_t(face) << 32) | (uint32_t(std::min(font.height, 0xFFFF)) << 16) | (bold ? 0x100u : 0u) | uint8_t(ch);
+
+      created = false;
+      if (ch < BitmapFont::First || ch > BitmapFont::Last || ch == ' ')
+        return nullptr;
+
+      auto pos = Glyphs.find(key);
+      if (pos != Glyphs.end())
+        return &pos->second;
+
+      created = true;
+      return &Glyphs.emplace(key, rasterize(font, ch, bold)).first->second;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // GlyphAtlas::rasterize
+    //! Allocate space for a glyph and draw it
+    ///////////////////////////////////////////////////////////////////////////////
+    Glyph rasterize(const HFont& font, char ch, bool bold)
+    {
+      const int32_t width = BitmapFont::advance(font),
+                    height = BitmapFont::lineHeight(font),
+                    scaleX = BitmapFont::scaleX(font),
+                    scaleY = BitmapFont::scaleY(font);
+
+      // Start a new shelf, or page, when full
+      if (Pages.empty() || ShelfX + width > Pages.back().Width)
+        ShelfX = 0, ShelfY += ShelfHeight, ShelfHeight = 0;
+      if (Pages.empty() || ShelfY + height > Pages.back().Height)
+      {
+        const int32_t w = std::max(PageSize, width),
+                      h = std::max(PageSize, height);
+        Pages.push_back(Page{w, h, std::unique_ptr<uint8_t[]>(new uint8_t[size_t(w)*h]())});
+        ShelfX = ShelfY = ShelfHeight = 0;
+      }
+
+      Page& page = Pages.back();
+      Glyph g{page.Pixels.get() + size_t(ShelfY)*page.Width + ShelfX, page.Width, width, height};
+      ShelfX += width;
+      ShelfHeight = std::max(ShelfHeight, height);
+
+      // Scale glyph bits into the cell
+      uint8_t* dst = const_cast<uint8_t*>(g.Pixels);
+      for (int32_t y = 0; y < height; ++y, dst += g.Pitch)
+      {
+        const uint16_t bits = BitmapFont::row(ch, y / scaleY, bold);
+        for (int32_t x = 0; x < width; ++x)
+          dst[x] = (bits >> (x / scaleX)) & 1;
+      }
+      return g;
+    }
+  };
+
+  //! \var GlyphAtlas::PageSize - Dimensions of each page in pixels
+  constexpr int32_t  GlyphAtlas::PageSize;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TextLayout - Positions of the lines and glyphs of a string within a layout rectangle
+  ///////////////////////////////////////////////////////////////////////////////
+  struct TextLayout
+  {
+    //! \struct Line - Single line of text
+    struct Line
+    {
+      PointL    Origin;     //!< Top-left of first character cell, relative to the layout rectangle
+      uint32_t  First,      //!< Index of first glyph
+                Length;     //!< Number of characters
+    };
+
+    std::string                            Text;      //!< Laid out text
+    std::vector<Line>                      Lines;     //!< Lines in order
+    std::vector<const GlyphAtlas::Glyph*>  Glyphs;    //!< Glyph of each character  (nullptr when blank)
+    int32_t                                Advance,   //!< Horizontal advance of each character
+                                           Height;    //!< Height of each line
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TextStats - Text cache counters
+  ///////////////////////////////////////////////////////////////////////////////
+  struct TextStats
+  {
+    uint64_t  LayoutHits = 0,       //!< Layouts reused
+              LayoutMisses = 0,     //!< Layouts calculated
+              GlyphHits = 0,        //!< Glyphs found in the atlas
+              GlyphMisses = 0,      //!< Glyphs rasterized into the atlas
+              Evictions = 0;        //!< Layouts discarded to make room
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TextCache - Thread-safe cache of text layouts backed by a glyph atlas
+  //!
+  //! Layouts depend only upon the font (face, height and weight), text, size of the layout
+  //! rectangle and the alignment flags, so the same string drawn at many positions shares
+  //! one layout. When full, the least recently used layout is evicted, as by LruCache.
+  //! Layouts are returned by shared pointer so they survive eviction while being drawn.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct TextCache
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var DefaultCapacity - Default maximum number of layouts
+    static constexpr size_t DefaultCapacity = 1024;
+
+    //! \alias layout_t - Shared layout
+    using layout_t = std::shared_ptr<const TextLayout>;
+
+  private:
+    //! \struct Entry - Cached layout and the parameters it was calculated for
+    struct Entry
+    {
+      uint64_t       Hash;
+      layout_t       Layout;
+      HFont          Font;
+      uint32_t       Face;      //!< Hash of the font face name
+      SizeL          Size;
+      DrawTextFlags  Flags;
+    };
+
+    //! \alias entry_iterator - Position of an entry within the recency list
+    using entry_iterator = std::list<Entry>::iterator;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    mutable std::mutex                            Lock;         //!< Guards all members
+    GlyphAtlas                                    Atlas;        //!< Rasterized glyphs
+    std::list<Entry>                              Entries;      //!< Layouts ordered from most to least recently used
+    std::unordered_map<uint64_t,entry_iterator>   Layouts;      //!< Layouts keyed by hash of parameters
+    size_t                                        Capacity;     //!< Maximum number of layouts
+    TextStats                                     Stats;        //!< Counters
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    explicit TextCache(size_t capacity = DefaultCapacity) : Capacity(std::max<size_t>(1, capacity))
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    TextStats stats() const       { std::lock_guard<std::mutex> lock(Lock); return Stats; }
+    size_t    size() const        { std::lock_guard<std::mutex> lock(Lock); return Layouts.size(); }
+    size_t    glyphs() const      { std::lock_guard<std::mutex> lock(Lock); return Atlas.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TextCache::layout
+    //! Find or calculate the layout of a string
+    //!
+    //! \param[in] text - Text (Lines separated by '\n')
+    //! \param[in] size - Size of layout rectangle
+    //! \param[in] flags - Alignment flags
+    //! \param[in] font - Font
+    //! \return layout_t - Layout
+    ///////////////////////////////////////////////////////////////////////////////
+    layout_t layout(const char* text, SizeL size, DrawTextFlags flags, const HFont& font)
+    {
+      const size_t length = std::strlen(text);
+      const uint32_t face = faceHash(font.face);
+
+      // Hash parameters (FNV-1a)
+      uint64_t hash = 14695981039346656037ull;
+      auto mix = [&hash](uint64_t v) { hash = (hash ^ v) * 1099511628211ull; };
+      for (size_t idx = 0; idx < length; ++idx)
+        mix(uint8_t(text[idx]));
+      mix(uint32_t(size.width)), mix(uint32_t(size.height)), mix(uint32_t(flags)), mix(uint32_t(font.height)), mix(uint32_t(font.weight)), mix(face);
+
+      // [HIT] Move to front
+      std::lock_guard<std::mutex> lock(Lock);
+      auto pos = Layouts.find(hash);
+      if (pos != Layouts.end())
+      {
+        const Entry& e = *pos->second;
+        if (e.Size == size && e.Flags == flags && e.Font.height == font.height && e.Font.weight == font.weight
+         && e.Face == face && e.Layout->Text.compare(0, std::string::npos, text, length) == 0)
+        {
+          ++Stats.LayoutHits;
+          Entries.splice(Entries.begin(), Entries, pos->second);
+          return e.Layout;
+        }
+
+        // Replace a colliding layout
+        Entries.erase(pos->second);
+        Layouts.erase(pos);
+      }
+
+      // [MISS] Evict least recently used
+      ++Stats.LayoutMisses;
+      if (Entries.size() >= Capacity)
+      {
+        ++Stats.Evictions;
+        Layouts.erase(Entries.back().Hash);
+        Entries.pop_back();
+      }
+
+      layout_t result = calculate(text, length, size, flags, font, face);
+      Entries.push_front(Entry{hash, result, font, face, size, flags});
+      Layouts[hash] = Entries.begin();
+      return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // TextCache::shared
+    //! Get the cache shared by all device contexts
+    ///////////////////////////////////////////////////////////////////////////////
+    static TextCache& shared()
+    {
+      static TextCache cache;
+      return cache;
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TextCache::calculate
+    //! Measure and align each line of a string  (Lock must be held)
+    ///////////////////////////////////////////////////////////////////////////////
+    layout_t calculate(const char* text, size_t length, SizeL size, DrawTextFlags flags, const HFont& font, uint32_t face)
+    {
+      auto layout = std::make_shared<TextLayout>();
+      layout->Text.assign(text, length);
+      layout->Advance = BitmapFont::advance(font);
+      layout->Height = BitmapFont::lineHeight(font);
+
+      // Count lines to support vertical alignment
+      int32_t lines = 1;
+      for (size_t idx = 0; idx < length; ++idx)
+        lines += (text[idx] == '\n');
+
+      int32_t y = 0;
+      if (flags & DrawTextFlags::Bottom)
+        y = size.height - lines*layout->Height;
+      else if (flags & DrawTextFlags::VCentre)
+        y = (size.height - lines*layout->Height) / 2;
+
+      for (const char* line = text; ; y += layout->Height)
+      {
+        const char* end = line;
+        while (*end && *end != '\n')
+          ++end;
+
+        // Align horizontally
+        const int32_t count = int32_t(end - line),
+                      width = count * layout->Advance;
+        int32_t x = 0;
+        if (flags & DrawTextFlags::Centre)
+          x = (size.width - width) / 2;
+        else if (flags & DrawTextFlags::Right)
+          x = size.width - width;
+
+        layout->Lines.push_back(TextLayout::Line{PointL(x,y), uint32_t(layout->Glyphs.size()), uint32_t(count)});
+
+        // Lookup glyphs
+        for (const char* c = line; c != end; ++c)
+        {
+          bool created;
+          const GlyphAtlas::Glyph* g = Atlas.glyph(font, face, *c, created);
+          if (g)
+            ++(created ? Stats.GlyphMisses : Stats.GlyphHits);
+          layout->Glyphs.push_back(g);
+        }
+
+        if (!*end)
+          break;
+        line = end+1;
+      }
+      return layout;
+    }
+  };
+
+  //! \var TextCache::DefaultCapacity - Default maximum number of layouts
+  constexpr size_t  TextCache::DefaultCapacity;
+
+} } // namespace hw1::render
+
+#endif
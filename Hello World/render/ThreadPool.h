@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\ThreadPool.h
+//! \brief Defines a work-stealing pool of worker threads
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_THREAD_POOL_H
+#define RENDER_THREAD_POOL_H
+
+#include <algorithm>            //!< std::max
+#include <atomic>               //!< std::atomic
+#include <condition_variable>   //!< std::condition_variable
+#include <deque>                //!< std::deque
+#include <memory>               //!< std::unique_ptr
+#include <mutex>                //!< std::mutex
+#include <thread>               //!< std::thread
+#include <vector>               //!< std::vector
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct ThreadPool - Executes batches of independent tasks on a fixed set of threads
+  //!
+  //! Each batch is divided into contiguous blocks, one per worker queue. Workers take tasks
+  //! from the back of their own queue and, once it is empty, steal from the front of other
+  //! queues, so uneven task costs are balanced without a shared queue. The calling thread
+  //! acts as worker zero; a pool of one worker creates no threads.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct ThreadPool
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  private:
+    //! \struct Queue - Tasks assigned to one worker
+    struct Queue
+    {
+      std::mutex            Lock;       //!< Guards tasks
+      std::deque<uint32_t>  Tasks;      //!< Task indices
+    };
+
+    //! \alias invoke_t - Type-erased task callback
+    using invoke_t = void (*)(void* func, uint32_t task, unsigned worker);
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    unsigned                  Workers;              //!< Number of workers (including caller)
+    std::unique_ptr<Queue[]>  Queues;               //!< Queue of each worker
+    std::vector<std::thread>  Threads;              //!< Worker threads
+    std::mutex                Lock;                 //!< Guards batch state
+    std::condition_variable   Started,              //!< Signalled when a batch begins (or pool stops)
+                              Finished;             //!< Signalled when a worker completes a batch
+    uint64_t                  Batch = 0;            //!< Current batch number
+    unsigned                  Completed = 0;        //!< Number of threads that completed current batch
+    bool                      Stopping = false;     //!< Whether threads should exit
+    invoke_t                  Invoke = nullptr;     //!< Task callback
+    void*                     Func = nullptr;       //!< Task callback argument
+    std::atomic<uint32_t>     Remaining{0};         //!< Number of tasks not yet executed
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::ThreadPool
+    //! Create a pool
+    //!
+    //! \param[in] workers - Number of workers including the calling thread  (Zero selects the number of cores)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit ThreadPool(unsigned workers = 0)
+      : Workers(workers ? workers : std::max(1u, std::thread::hardware_concurrency())),
+        Queues(new Queue[Workers])
+    {
+      for (unsigned w = 1; w < Workers; ++w)
+        Threads.emplace_back(&ThreadPool::thread, this, w);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Stopping = true;
+      }
+      Started.notify_all();
+      for (auto& t : Threads)
+        t.join();
+    }
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    unsigned size() const { return Workers; }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::run
+    //! Execute a batch of tasks and wait for completion
+    //!
+    //! \param[in] count - Number of tasks
+    //! \param[in] func - Callable as func(uint32_t task, unsigned worker)
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename FUNC>
+    void run(uint32_t count, FUNC&& func)
+    {
+      if (count == 0)
+        return;
+
+      // Distribute contiguous blocks of tasks
+      for (uint32_t task = 0; task < count; ++task)
+        Queues[uint64_t(task) * Workers / count].Tasks.push_back(task);
+
+      // Start workers
+      Invoke = [](void* f, uint32_t task, unsigned worker) { (*static_cast<FUNC*>(f))(task, worker); };
+      Func = &func;
+      Remaining = count;
+      {
+        std::lock_guard<std::mutex> lock(Lock);
+        Completed = 0;
+        ++Batch;
+      }
+      Started.notify_all();
+
+      // Participate, then wait for every thread to leave the batch
+      execute(0);
+      std::unique_lock<std::mutex> lock(Lock);
+      Finished.wait(lock, [this] { return Completed == Threads.size(); });
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::thread
+    //! Worker thread procedure
+    ///////////////////////////////////////////////////////////////////////////////
+    void thread(unsigned worker)
+    {
+      uint64_t seen = 0;
+      for (;;)
+      {
+        {
+          std::unique_lock<std::mutex> lock(Lock);
+          Started.wait(lock, [&] { return Stopping || Batch != seen; });
+          if (Stopping)
+            return;
+          seen = Batch;
+        }
+
+        execute(worker);
+        {
+          std::lock_guard<std::mutex> lock(Lock);
+          ++Completed;
+        }
+        Finished.notify_one();
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // ThreadPool::execute
+    //! Execute tasks from own queue, then steal from others until none remain
+    ///////////////////////////////////////////////////////////////////////////////
+    void execute(unsigned worker)
+    {
+      uint32_t task;
+      while (Remaining.load(std::memory_order_acquire) != 0)
+      {
+        if (!take(worker, task))
+        {
+          bool stolen = false;
+          for (unsigned n = 1; n < Workers && !stolen; ++n)
+            stolen = steal((worker + n) % Workers, task);
+          if (!stolen)
+            return;
+        }
+
+        Invoke(Func, task, worker);
+        Remaining.fetch_sub(1, std::memory_order_acq_rel);
+      }
+    }
+
+    bool take(unsigned worker, uint32_t& task)
+    {
+      Queue& q = Queues[worker];
+      std::lock_guard<std::mutex> lock(q.Lock);
+      if (q.Tasks.empty())
+        return false;
+      task = q.Tasks.back();
+      q.Tasks.pop_back();
+      return true;
+    }
+
+    bool steal(unsigned victim, uint32_t& task)
+    {
+      Queue& q = Queues[victim];
+      std::lock_guard<std::mutex> lock(q.Lock);
+      if (q.Tasks.empty())
+        return false;
+      task = q.Tasks.front();
+      q.Tasks.pop_front();
+      return true;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,139 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\TileRenderer.h
+//! \brief Defines multi-threaded rendering of recorded commands in screen tiles
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TILE_RENDERER_H
+#define RENDER_TILE_RENDERER_H
+
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+#include "Framebuffer.h"      //!< hw1::render::Framebuffer
+#include "CommandList.h"      //!< hw1::render::CommandList
+#include "DeviceContext.h"    //!< hw1::render::DeviceContext
+#include "ThreadPool.h"       //!< hw1::render::ThreadPool
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TileRenderer - Renders a frame as independent tiles on a thread pool
+  //!
+  //! The frame is first drawn into a recording DeviceContext. Each recorded command is
+  //! binned into every tile its bounds overlap, then the tiles are rasterized in parallel,
+  //! each replaying its commands in issue order and clipped to the tile. Rasterization
+  //! never depends on the clipping rectangle, so the output is bit-identical to drawing
+  //! directly into the framebuffer on one thread.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct TileRenderer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var TileSize - Tile dimensions in pixels
+    static constexpr int32_t TileSize = 64;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    ThreadPool                          Pool;       //!< Worker threads
+    CommandList                         Commands;   //!< Commands of current frame
+    std::vector<std::vector<uint32_t>>  Bins;       //!< Commands overlapping each tile
+    std::vector<uint32_t>               Occupied;   //!< Tiles with at least one command
+    int32_t                             Columns = 0,  //!< Number of tile columns
+                                        Rows = 0;     //!< Number of tile rows
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TileRenderer::TileRenderer
+    //! Create a renderer
+    //!
+    //! \param[in] threads - Number of threads  (Zero selects the number of cores)
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit TileRenderer(unsigned threads = 0) : Pool(threads)
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    unsigned            threads() const   { return Pool.size(); }
+    const CommandList&  commands() const  { return Commands; }
+    size_t              tiles() const     { return Occupied.size(); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TileRenderer::render
+    //! Render a frame
+    //!
+    //! \param[in,out] target - Render target
+    //! \param[in] draw - Callable as draw(DeviceContext&) that issues the frame's drawing commands
+    ///////////////////////////////////////////////////////////////////////////////
+    template <typename DRAW>
+    void render(Framebuffer& target, DRAW&& draw)
+    {
+      // Record
+      Commands.clear();
+      DeviceContext recorder(Commands, target.bounds());
+      draw(recorder);
+
+      replay(target, Commands);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // TileRenderer::replay
+    //! Render previously recorded commands  (eg. a loaded display list)
+    //!
+    //! \param[in,out] target - Render target
+    //! \param[in] list - Commands recorded for a frame no larger than the target
+    ///////////////////////////////////////////////////////////////////////////////
+    void replay(Framebuffer& target, const CommandList& list)
+    {
+      // Bin commands into tiles
+      bin(list, target.bounds());
+
+      // Rasterize tiles
+      Pool.run(uint32_t(Occupied.size()), [&](uint32_t n, unsigned) {
+        const uint32_t tile = Occupied[n];
+        const int32_t x = int32_t(tile % Columns) * TileSize,
+                      y = int32_t(tile / Columns) * TileSize;
+        DeviceContext dc(target);
+        dc.setClip(RectL(x, y, x+TileSize, y+TileSize));
+        dc.replay(list, Bins[tile]);
+      });
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // TileRenderer::bin
+    //! Assign each recorded command to the tiles it overlaps
+    ///////////////////////////////////////////////////////////////////////////////
+    void bin(const CommandList& list, const RectL& extent)
+    {
+      Columns = (extent.width() + TileSize-1) / TileSize;
+      Rows = (extent.height() + TileSize-1) / TileSize;
+      Bins.resize(size_t(Columns) * Rows);
+      for (auto& b : Bins)
+        b.clear();
+
+      for (uint32_t idx = 0; idx < uint32_t(list.Commands.size()); ++idx)
+      {
+        // Bounds were clipped when recorded; clip again in case the list was recorded for another target
+        const RectL r = list.Commands[idx].Bounds.intersect(extent);
+        if (r.empty())
+          continue;
+        for (int32_t row = r.top / TileSize; row <= (r.bottom-1) / TileSize; ++row)
+          for (int32_t col = r.left / TileSize; col <= (r.right-1) / TileSize; ++col)
+            Bins[size_t(row)*Columns + col].push_back(idx);
+      }
+
+      Occupied.clear();
+      for (uint32_t tile = 0; tile < uint32_t(Bins.size()); ++tile)
+        if (!Bins[tile].empty())
+          Occupied.push_back(tile);
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
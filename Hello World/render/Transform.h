@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Transform.h
+//! \brief Defines the pan/zoom transform from scene to device coordinates
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TRANSFORM_H
+#define RENDER_TRANSFORM_H
+
+#include <cmath>              //!< std::floor
+#include <cstddef>            //!< size_t
+#include <vector>             //!< std::vector
+#include "Types.h"            //!< hw1::render::RectL
+
+#if defined(__AVX2__)
+  #include <immintrin.h>      //!< AVX2 intrinsics
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>      //!< SSE2 intrinsics
+  #define RENDER_SSE2 1
+#endif
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum Arithmetic - Number formats in which transforms are evaluated
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class Arithmetic : uint8_t
+  {
+    Float,    //!< Single-precision floating point
+    Fixed,    //!< 16.16 fixed point  (Exact integer arithmetic; scale is quantized to 1/65536)
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Transform - Uniform scale followed by translation  (device = scene * Scale + Offset)
+  //!
+  //! Device coordinates are rounded down from the half-pixel, so both edges of a rectangle
+  //! move together and abutting shapes remain abutting at every scale.
+  //!
+  //! Single coordinates are mapped by x() and y(); contiguous arrays of coordinates (eg. the
+  //! columns of a scene file, or a RectBuffer) are mapped by map(), several at a time, with
+  //! identical results. Floating point evaluation uses a fused multiply-add wherever the
+  //! target supports one, so the scalar and vector paths round identically. Fixed point
+  //! coefficients are derived once, upon construction, rather than by every mapping.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Transform
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Limit - Magnitude of the largest coordinate produced by an inverse transform
+    static constexpr int32_t Limit = 1 << 30;
+
+    //! \var FixedShift - Number of fractional bits of fixed point coefficients
+    static constexpr int32_t FixedShift = 16;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+
+    float       Scale = 1.0f,                     //!< Device pixels per scene unit  (Must be positive, and below 32768 in fixed point)
+                OffsetX = 0.0f,                   //!< Device x-coordinate of the scene origin
+                OffsetY = 0.0f;                   //!< Device y-coordinate of the scene origin
+    Arithmetic  Format = Arithmetic::Float;       //!< Number format
+  private:
+    int64_t     FixedScale = 1 << FixedShift,     //!< Scale in 16.16 fixed point
+                BiasX = 1 << (FixedShift-1),      //!< Horizontal offset plus one half, in 16.16 fixed point
+                BiasY = 1 << (FixedShift-1);      //!< Vertical offset plus one half, in 16.16 fixed point
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    constexpr Transform() = default;
+    constexpr Transform(float scale, float dx, float dy, Arithmetic format = Arithmetic::Float)
+      : Scale(scale), OffsetX(dx), OffsetY(dy), Format(format),
+        FixedScale(fixed(scale)), BiasX(fixed(dx) + (1 << (FixedShift-1))), BiasY(fixed(dy) + (1 << (FixedShift-1)))
+    {}
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+
+    bool identity() const  { return Scale == 1.0f && OffsetX == 0.0f && OffsetY == 0.0f; }
+    bool scaled() const    { return Scale != 1.0f; }
+
+    //! Get the device length of a scene distance  (Unrounded)
+    float length(int32_t d) const  { return float(d) * Scale; }
+
+    int32_t x(int32_t v) const  { return map(v, OffsetX, BiasX); }
+    int32_t y(int32_t v) const  { return map(v, OffsetY, BiasY); }
+
+    PointL operator() (PointL pt) const        { return PointL(x(pt.x), y(pt.y)); }
+    RectL  operator() (const RectL& rc) const  { return RectL(x(rc.left), y(rc.top), x(rc.right), y(rc.bottom)); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::inverse const
+    //! Get a scene rectangle containing every point that maps into a device rectangle
+    //!
+    //! \param[in] rc - Device rectangle
+    //! \return RectL - Scene rectangle  (Conservative by one unit on each side)
+    ///////////////////////////////////////////////////////////////////////////////
+    RectL inverse(const RectL& rc) const
+    {
+      if (identity())
+        return rc;
+
+      auto clamp = [](double v) { return int32_t(std::max<double>(-Limit, std::min<double>(Limit, v))); };
+      return RectL(clamp(std::floor((rc.left - OffsetX) / Scale) - 1), clamp(std::floor((rc.top - OffsetY) / Scale) - 1),
+                   clamp(std::ceil((rc.right - OffsetX) / Scale) + 1), clamp(std::ceil((rc.bottom - OffsetY) / Scale) + 1));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::mapX const
+    //! Map an array of x-coordinates into device coordinates
+    //!
+    //! \param[in] src - Scene coordinates
+    //! \param[out] dst - Device coordinates  (May equal src)
+    //! \param[in] count - Number of coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    void mapX(const int32_t* src, int32_t* dst, size_t count) const
+    {
+      map(src, dst, count, OffsetX, BiasX);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::mapY const
+    //! Map an array of y-coordinates into device coordinates
+    //!
+    //! \param[in] src - Scene coordinates
+    //! \param[out] dst - Device coordinates  (May equal src)
+    //! \param[in] count - Number of coordinates
+    ///////////////////////////////////////////////////////////////////////////////
+    void mapY(const int32_t* src, int32_t* dst, size_t count) const
+    {
+      map(src, dst, count, OffsetY, BiasY);
+    }
+
+  private:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::fixed
+    //! Convert a coefficient to 16.16 fixed point  (Rounded to nearest)
+    ///////////////////////////////////////////////////////////////////////////////
+    static constexpr int64_t fixed(float v)
+    {
+      const double f = double(v) * (1 << FixedShift) + 0.5;
+      const int64_t t = int64_t(f);
+      return double(t) > f ? t-1 : t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::map const
+    //! Map one coordinate into device coordinates
+    //!
+    //! \param[in] v - Scene coordinate
+    //! \param[in] offset - Device coordinate of the scene origin
+    //! \param[in] bias - Fixed point offset plus one half
+    ///////////////////////////////////////////////////////////////////////////////
+    int32_t map(int32_t v, float offset, int64_t bias) const
+    {
+      if (Format == Arithmetic::Fixed)
+        return int32_t((int64_t(v) * FixedScale + bias) >> FixedShift);
+
+#if defined(__FMA__)
+      return int32_t(std::floor(std::fma(float(v), Scale, offset + 0.5f)));
+#else
+      return int32_t(std::floor(float(v) * Scale + (offset + 0.5f)));
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Transform::map const
+    //! Map an array of coordinates into device coordinates
+    //!
+    //! \param[in] src - Scene coordinates
+    //! \param[out] dst - Device coordinates  (May equal src)
+    //! \param[in] count - Number of coordinates
+    //! \param[in] offset - Device coordinate of the scene origin
+    //! \param[in] bias - Fixed point offset plus one half
+    ///////////////////////////////////////////////////////////////////////////////
+    void map(const int32_t* src, int32_t* dst, size_t count, float offset, int64_t bias) const
+    {
+      size_t n = 0;
+#if defined(__AVX2__)
+      if (Format == Arithmetic::Fixed)
+      {
+        // 32x32 => 64-bit products of even and odd lanes; bits 16..47 of each sum are the result
+        const __m256i scale = _mm256_set1_epi32(int32_t(FixedScale)),
+                      sum = _mm256_set1_epi64x(bias);
+        for (; n+8 <= count; n += 8)
+        {
+          const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+n)),
+                        even = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(v, scale), sum), FixedShift),
+                        odd = _mm256_srli_epi64(_mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(v, 32), scale), sum), FixedShift);
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+n), _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA));
+        }
+      }
+      else
+      {
+        const __m256 scale = _mm256_set1_ps(Scale),
+                     bias = _mm256_set1_ps(offset + 0.5f);
+        for (; n+8 <= count; n += 8)
+        {
+          const __m256 v = _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src+n)));
+  #if defined(__FMA__)
+          const __m256 r = _mm256_fmadd_ps(v, scale, bias);
+  #else
+          const __m256 r = _mm256_add_ps(_mm256_mul_ps(v, scale), bias);
+  #endif
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst+n), _mm256_cvttps_epi32(_mm256_floor_ps(r)));
+        }
+      }
+#elif defined(RENDER_SSE2)
+      if (Format == Arithmetic::Fixed)
+      {
+        // Unsigned 32x32 => 64-bit products of even and odd lanes, less 2^32 * scale wherever the coordinate
+        // is negative, are the signed products modulo 2^64  (The scale is positive)
+        const __m128i scale = _mm_set1_epi32(int32_t(FixedScale)),
+                      sum = _mm_set1_epi64x(bias),
+                      high = _mm_set1_epi64x(int64_t(0xFFFFFFFF00000000ull));
+        for (; n+4 <= count; n += 4)
+        {
+          const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src+n)),
+                        neg = _mm_and_si128(_mm_srai_epi32(v, 31), scale),
+                        even = _mm_sub_epi64(_mm_mul_epu32(v, scale), _mm_slli_epi64(neg, 32)),
+                        odd = _mm_sub_epi64(_mm_mul_epu32(_mm_srli_epi64(v, 32), scale), _mm_and_si128(neg, high)),
+                        lo = _mm_shuffle_epi32(_mm_srli_epi64(_mm_add_epi64(even, sum), FixedShift), _MM_SHUFFLE(3,1,2,0)),
+                        hi = _mm_shuffle_epi32(_mm_srli_epi64(_mm_add_epi64(odd, sum), FixedShift), _MM_SHUFFLE(3,1,2,0));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst+n), _mm_unpacklo_epi32(lo, hi));
+        }
+      }
+      else
+      {
+        const __m128 scale = _mm_set1_ps(Scale),
+                     bias = _mm_set1_ps(offset + 0.5f);
+        for (; n+4 <= count; n += 4)
+        {
+          // Round towards zero, then subtract one where that rounded up
+          const __m128  r = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src+n))), scale), bias);
+          const __m128i t = _mm_cvttps_epi32(r);
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst+n), _mm_add_epi32(t, _mm_castps_si128(_mm_cmpgt_ps(_mm_cvtepi32_ps(t), r))));
+        }
+      }
+#endif
+      // Remainder
+      for (; n < count; ++n)
+        dst[n] = map(src[n], offset, bias);
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct PointBuffer - Structure-of-arrays points  (Coordinates of each point at the same index)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct PointBuffer
+  {
+    std::vector<int32_t>  X,        //!< x-coordinates
+                          Y;        //!< y-coordinates
+
+    size_t size() const   { return X.size(); }
+    bool   empty() const  { return X.empty(); }
+
+    PointL operator[] (size_t idx) const  { return PointL(X[idx], Y[idx]); }
+
+    void clear()
+    {
+      X.clear(), Y.clear();
+    }
+
+    void push_back(int32_t x, int32_t y)
+    {
+      X.push_back(x), Y.push_back(y);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // PointBuffer::transform
+    //! Map every point into device coordinates  (One pass over each coordinate array)
+    ///////////////////////////////////////////////////////////////////////////////
+    void transform(const Transform& view)
+    {
+      view.mapX(X.data(), X.data(), size());
+      view.mapY(Y.data(), Y.data(), size());
+    }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct RectBuffer - Structure-of-arrays rectangles  (Edges of each rectangle at the same index)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct RectBuffer
+  {
+    std::vector<int32_t>  Left,     //!< Left edges
+                          Top,      //!< Top edges
+                          Right,    //!< Right edges  (Exclusive)
+                          Bottom;   //!< Bottom edges  (Exclusive)
+
+    size_t size() const   { return Left.size(); }
+    bool   empty() const  { return Left.empty(); }
+
+    RectL operator[] (size_t idx) const  { return RectL(Left[idx], Top[idx], Right[idx], Bottom[idx]); }
+
+    void clear()
+    {
+      Left.clear(), Top.clear(), Right.clear(), Bottom.clear();
+    }
+
+    void push_back(const RectL& rc)
+    {
+      Left.push_back(rc.left), Top.push_back(rc.top), Right.push_back(rc.right), Bottom.push_back(rc.bottom);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RectBuffer::transform
+    //! Map every rectangle into device coordinates  (One pass over each edge array)
+    ///////////////////////////////////////////////////////////////////////////////
+    void transform(const Transform& view)
+    {
+      view.mapX(Left.data(), Left.data(), size());
+      view.mapY(Top.data(), Top.data(), size());
+      view.mapX(Right.data(), Right.data(), size());
+      view.mapY(Bottom.data(), Bottom.data(), size());
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\TripleBuffer.h
+//! \brief Defines a lock-free triple buffer for handing frames between two threads
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TRIPLE_BUFFER_H
+#define RENDER_TRIPLE_BUFFER_H
+
+#include <atomic>             //!< std::atomic
+#include <cstdint>            //!< uint8_t
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TripleBuffer - Hands values from one producer thread to one consumer thread without locking
+  //!
+  //! The producer owns the back slot and the consumer owns the front slot; the third slot is
+  //! exchanged between them through a single atomic index. Publishing swaps the back slot into
+  //! the middle and marks it fresh; acquiring swaps a fresh middle slot into the front. Neither
+  //! thread ever waits for the other, and the consumer always receives the newest value
+  //! (Values published faster than they are acquired are overwritten).
+  //!
+  //! \tparam T - Slot type  (Slots are reused, never copied)
+  ///////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct TripleBuffer
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+  private:
+    //! \var Fresh - Flag set within the middle index when it holds a value not yet acquired
+    static constexpr uint8_t Fresh = 4;
+
+    //! \var Index - Mask of the slot index within the middle index
+    static constexpr uint8_t Index = 3;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    T                     Slots[3];       //!< Back, middle and front values
+    uint8_t               Back = 0,       //!< Slot written by producer
+                          Front = 1;      //!< Slot read by consumer
+    std::atomic<uint8_t>  Middle{2};      //!< Slot exchanged between them  (Plus fresh flag)
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator= (const TripleBuffer&) = delete;
+
+    // ---------------------------------- ACCESSOR METHODS ----------------------------------
+  public:
+    //! Get the value most recently acquired  (Consumer only)
+    const T& front() const  { return Slots[Front]; }
+
+    //! Query whether a value has been published but not yet acquired
+    bool fresh() const      { return (Middle.load(std::memory_order_relaxed) & Fresh) != 0; }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    //! Get the value being produced  (Producer only)
+    T& back()  { return Slots[Back]; }
+
+    //! Get the value most recently acquired  (Consumer only)
+    T& front()  { return Slots[Front]; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // TripleBuffer::publish
+    //! Make the back value available to the consumer and begin another  (Producer only)
+    ///////////////////////////////////////////////////////////////////////////////
+    void publish()
+    {
+      Back = Middle.exchange(uint8_t(Back | Fresh), std::memory_order_acq_rel) & Index;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // TripleBuffer::acquire
+    //! Move the newest published value to the front  (Consumer only)
+    //!
+    //! \return bool - True if a value was published since the previous acquisition
+    ///////////////////////////////////////////////////////////////////////////////
+    bool acquire()
+    {
+      if (!fresh())
+        return false;
+
+      // Only the consumer clears the flag, so the middle slot remains fresh
+      Front = Middle.exchange(Front, std::memory_order_acq_rel) & Index;
+      return true;
+    }
+  };
+
+} } // namespace hw1::render
+
+#endif
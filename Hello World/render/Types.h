@@ -0,0 +1,331 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Types.h
+//! \brief Defines the portable drawing vocabulary used by the software renderer
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_TYPES_H
+#define RENDER_TYPES_H
+
+#include <cstdint>            //!< int32_t
+#include <cstdlib>            //!< std::abs
+#include <algorithm>          //!< std::min
+#include <atomic>             //!< std::atomic
+
+//! \namespace hw1::render - Portable software renderer (Mirrors the wtl drawing vocabulary)
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct POINT - Mirrors ::POINT for polygon vertex arrays
+  ///////////////////////////////////////////////////////////////////////////////
+  struct POINT
+  {
+    int32_t x, y;
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct PointL - Mirrors wtl::PointL
+  ///////////////////////////////////////////////////////////////////////////////
+  struct PointL
+  {
+    int32_t x = 0, y = 0;
+
+    constexpr PointL() = default;
+    constexpr PointL(int32_t X, int32_t Y) : x(X), y(Y) {}
+
+    constexpr PointL operator+ (PointL r) const  { return PointL(x+r.x, y+r.y); }
+    constexpr PointL operator- (PointL r) const  { return PointL(x-r.x, y-r.y); }
+    constexpr bool   operator== (PointL r) const { return x == r.x && y == r.y; }
+    constexpr bool   operator!= (PointL r) const { return !operator==(r); }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct SizeL - Mirrors wtl::SizeL  (Dimensions may be negative)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct SizeL
+  {
+    int32_t width = 0, height = 0;
+
+    constexpr SizeL() = default;
+    constexpr SizeL(int32_t w, int32_t h) : width(w), height(h) {}
+
+    constexpr bool operator== (SizeL r) const { return width == r.width && height == r.height; }
+    constexpr bool operator!= (SizeL r) const { return !operator==(r); }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct RectL - Mirrors wtl::RectL  (Right and bottom edges are exclusive)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct RectL
+  {
+    int32_t left = 0, top = 0, right = 0, bottom = 0;
+
+    constexpr RectL() = default;
+    constexpr RectL(int32_t l, int32_t t, int32_t r, int32_t b) : left(l), top(t), right(r), bottom(b) {}
+    constexpr RectL(PointL pt, SizeL sz) : left(pt.x), top(pt.y), right(pt.x+sz.width), bottom(pt.y+sz.height) {}
+
+    constexpr int32_t width() const   { return right - left; }
+    constexpr int32_t height() const  { return bottom - top; }
+    constexpr bool    empty() const   { return right <= left || bottom <= top; }
+    constexpr PointL  topLeft() const { return PointL(left, top); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RectL::normalized const
+    //! Get an equivalent rectangle with positive dimensions
+    ///////////////////////////////////////////////////////////////////////////////
+    constexpr RectL normalized() const
+    {
+      return RectL(std::min(left,right), std::min(top,bottom), std::max(left,right), std::max(top,bottom));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RectL::intersect const
+    //! Get the intersection with another rectangle  (Empty when disjoint)
+    ///////////////////////////////////////////////////////////////////////////////
+    constexpr RectL intersect(const RectL& r) const
+    {
+      return RectL(std::max(left,r.left), std::max(top,r.top), std::min(right,r.right), std::min(bottom,r.bottom));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RectL::unite const
+    //! Get the bounding rectangle of this and another rectangle
+    ///////////////////////////////////////////////////////////////////////////////
+    constexpr RectL unite(const RectL& r) const
+    {
+      return empty()   ? r
+           : r.empty() ? *this
+           : RectL(std::min(left,r.left), std::min(top,r.top), std::max(right,r.right), std::max(bottom,r.bottom));
+    }
+
+    constexpr bool intersects(const RectL& r) const { return !intersect(r).empty(); }
+    constexpr bool contains(PointL pt) const        { return pt.x >= left && pt.x < right && pt.y >= top && pt.y < bottom; }
+
+    constexpr bool operator== (const RectL& r) const { return left == r.left && top == r.top && right == r.right && bottom == r.bottom; }
+    constexpr bool operator!= (const RectL& r) const { return !operator==(r); }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct TriangleL - Mirrors wtl::TriangleL  (Base runs rightwards from origin, apex lies above)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct TriangleL
+  {
+    POINT points[3];
+
+    constexpr TriangleL(PointL pt, int32_t width, int32_t height)
+      : points{ {pt.x, pt.y}, {pt.x+width/2, pt.y-height}, {pt.x+width, pt.y} }
+    {}
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum Colour - Named colours (Stored as 0x00RRGGBB)
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class Colour : uint32_t
+  {
+    Black   = 0x000000,
+    White   = 0xFFFFFF,
+    Red     = 0xFF0000,
+    Green   = 0x008000,
+    Blue    = 0x0000FF,
+    Beige   = 0xF5F5DC,
+    Brown   = 0x8B5A2B,
+    Cyan    = 0x00FFFF,
+    Forest  = 0x228B22,
+    Gold    = 0xFFD700,
+    Honey   = 0xE8B04A,
+    Leaves  = 0x4CBB17,
+    Magenta = 0xFF00FF,
+    Orange  = 0xFFA500,
+    Rose    = 0xFF66CC,
+    SkyBlue = 0x87CEEB,
+    Snow    = 0xFFFAFA,
+    Teal    = 0x008080,
+    Wheat   = 0xF5DEB3,
+    Yellow  = 0xFFFF00,
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum StockBrush - Solid stock brushes  (Values are the brush colour)
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class StockBrush : uint32_t
+  {
+    Black  = uint32_t(Colour::Black),
+    White  = uint32_t(Colour::White),
+    Brown  = uint32_t(Colour::Brown),
+    Cyan   = uint32_t(Colour::Cyan),
+    Green  = uint32_t(Colour::Green),
+    Leaves = uint32_t(Colour::Leaves),
+    Red    = uint32_t(Colour::Red),
+    Snow   = uint32_t(Colour::Snow),
+    Wheat  = uint32_t(Colour::Wheat),
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum HatchStyle - Hatched brush styles
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class HatchStyle : uint8_t
+  {
+    Horizontal,         //!< -----
+    Vertical,           //!< |||||
+    ForwardDiagonal,    //!< Top-left to bottom-right
+    BackwardDiagonal,   //!< Bottom-left to top-right
+    Cross,              //!< +++++
+    CrossDiagonal,      //!< xxxxx
+  };
+
+  //! \var NumHatchStyles - Number of hatch styles
+  constexpr int32_t NumHatchStyles = 6;
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::hatchMask
+  //! Get the 8x8 pattern of a hatch style
+  //!
+  //! \param[in] style - Hatch style
+  //! \return uint64_t - Byte N is pattern row N; bit N of each row is pattern column N
+  ///////////////////////////////////////////////////////////////////////////////
+  inline uint64_t hatchMask(HatchStyle style)
+  {
+    static constexpr uint64_t masks[NumHatchStyles] =
+    {
+      0x00000000000000FFull,    // Horizontal
+      0x0101010101010101ull,    // Vertical
+      0x8040201008040201ull,    // ForwardDiagonal
+      0x0102040810204080ull,    // BackwardDiagonal
+      0x01010101010101FFull,    // Cross
+      0x8142241818244281ull,    // CrossDiagonal
+    };
+    return masks[uint8_t(style)];
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum PenStyle - Pen styles
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class PenStyle : uint8_t
+  {
+    Solid,
+    Null = 5,
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum DrawingMode - Background mix mode
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class DrawingMode : uint8_t
+  {
+    Transparent = 1,    //!< Hatches and text leave background untouched
+    Opaque = 2,         //!< Hatches and text fill background with back colour
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum DrawTextFlags - Text layout flags
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class DrawTextFlags : uint32_t
+  {
+    Left       = 0x00000000,
+    Top        = 0x00000000,
+    Centre     = 0x00000001,
+    Right      = 0x00000002,
+    VCentre    = 0x00000004,
+    Bottom     = 0x00000008,
+    SingleLine = 0x00000020,
+  };
+
+  constexpr DrawTextFlags operator| (DrawTextFlags a, DrawTextFlags b) { return DrawTextFlags(uint32_t(a) | uint32_t(b)); }
+  constexpr bool          operator& (DrawTextFlags a, DrawTextFlags b) { return (uint32_t(a) & uint32_t(b)) != 0; }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \enum FontWeight - Font weights
+  ///////////////////////////////////////////////////////////////////////////////
+  enum class FontWeight : int32_t
+  {
+    Normal = 400,
+    Bold = 700,
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::objectsCreated
+  //! Get the number of pens, brushes and fonts created from attributes  (Mirrors GDI object creation)
+  ///////////////////////////////////////////////////////////////////////////////
+  inline std::atomic<uint64_t>& objectsCreated()
+  {
+    static std::atomic<uint64_t> count(0);
+    return count;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct HPen - Pen description  (Value type mirroring wtl::HPen)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct HPen
+  {
+    PenStyle  style = PenStyle::Solid;
+    int32_t   width = 1;
+    Colour    colour = Colour::Black;
+
+    HPen() = default;
+    HPen(PenStyle s, int32_t w, Colour c) : style(s), width(w), colour(c) { ++objectsCreated(); }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct HBrush - Solid or hatched brush description  (Value type mirroring wtl::HBrush)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct HBrush
+  {
+    Colour      colour = Colour::White;
+    HatchStyle  hatch = HatchStyle::Horizontal;
+    bool        hatched = false;
+
+    HBrush() = default;
+    HBrush(Colour c) : colour(c) { ++objectsCreated(); }
+    HBrush(StockBrush b) : colour(Colour(b)) {}
+    HBrush(HatchStyle h, Colour c) : colour(c), hatch(h), hatched(true) { ++objectsCreated(); }
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct HFont - Font description  (Value type mirroring wtl::HFont)
+  ///////////////////////////////////////////////////////////////////////////////
+  struct HFont
+  {
+    int32_t     height = 8;
+    FontWeight  weight = FontWeight::Normal;
+    const char* face = nullptr;     //!< Face name  (String literal; drawn only by a text writer)
+  };
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::faceHash
+  //! Hash the face name of a font (FNV-1a)
+  //!
+  //! \param[in] face - Face name  (May be nullptr)
+  //! \return uint32_t - Hash, or zero when there is no face name
+  ///////////////////////////////////////////////////////////////////////////////
+  inline uint32_t faceHash(const char* face)
+  {
+    if (!face)
+      return 0;
+
+    uint32_t hash = 2166136261u;
+    for (; *face; ++face)
+      hash = (hash ^ uint8_t(*face)) * 16777619u;
+    return hash;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::c_str
+  //! Mirrors wtl::c_str for narrow string literals
+  ///////////////////////////////////////////////////////////////////////////////
+  inline const char* c_str(const char* str)
+  {
+    return str;
+  }
+
+  ///////////////////////////////////////////////////////////////////////////////
+  // render::pixel
+  //! Convert a colour into an opaque 32-bit framebuffer pixel  (0xAARRGGBB)
+  ///////////////////////////////////////////////////////////////////////////////
+  constexpr uint32_t pixel(Colour c)
+  {
+    return 0xFF000000u | uint32_t(c);
+  }
+
+} } // namespace hw1::render
+
+#endif
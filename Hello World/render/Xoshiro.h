@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+//! \file HelloWorld\render\Xoshiro.h
+//! \brief Defines a seeded random number generator producing several streams in parallel
+//! \date 17 October 2026
+//! \author Nick Crowley
+//! \copyright  Nick Crowley. All rights reserved.
+////////////////////////////////////////////////////////////////////////////////
+#ifndef RENDER_XOSHIRO_H
+#define RENDER_XOSHIRO_H
+
+#include <algorithm>          //!< std::copy
+#include <cstddef>            //!< size_t
+#include <cstdint>            //!< uint32_t
+
+//! \namespace hw1::render - Portable software renderer
+namespace hw1 { namespace render
+{
+  ///////////////////////////////////////////////////////////////////////////////
+  //! \struct Xoshiro128 - xoshiro128** generator advancing Lanes independent streams in lockstep
+  //!
+  //! The state is held as structure-of-arrays so each step is a handful of shifts, adds and
+  //! xors across every lane, which compilers vectorize with SSE2 or AVX2 alike. Output
+  //! interleaves the lanes, so a sequence depends only upon the seed, never upon the
+  //! instruction set.
+  ///////////////////////////////////////////////////////////////////////////////
+  struct Xoshiro128
+  {
+    // ---------------------------------- TYPES & CONSTANTS ---------------------------------
+
+    //! \var Lanes - Number of streams  (One AVX2 register of 32-bit words)
+    static constexpr size_t Lanes = 8;
+
+    // ----------------------------------- REPRESENTATION -----------------------------------
+  private:
+    uint32_t  S0[Lanes], S1[Lanes], S2[Lanes], S3[Lanes];    //!< State words of each lane
+
+    // ------------------------------ CONSTRUCTION & DESTRUCTION ----------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Xoshiro128::Xoshiro128
+    //! Seed every lane from a single value  (Expanded with splitmix64, as recommended)
+    //!
+    //! \param[in] seed - Seed
+    ///////////////////////////////////////////////////////////////////////////////
+    explicit Xoshiro128(uint64_t seed)
+    {
+      auto splitmix = [&seed]() {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+      };
+      for (size_t l = 0; l < Lanes; ++l)
+      {
+        const uint64_t a = splitmix(), b = splitmix();
+        S0[l] = uint32_t(a);  S1[l] = uint32_t(a >> 32);
+        S2[l] = uint32_t(b);  S3[l] = uint32_t(b >> 32) | 1;    // Never all zero
+      }
+    }
+
+    // ----------------------------------- STATIC METHODS -----------------------------------
+  public:
+    //! Reduce a random word into [0,n) by multiplication  (Avoids division)
+    static uint32_t bounded(uint32_t r, uint32_t n)  { return uint32_t((uint64_t(r) * n) >> 32); }
+
+    // ----------------------------------- MUTATOR METHODS ----------------------------------
+  public:
+    ///////////////////////////////////////////////////////////////////////////////
+    // Xoshiro128::generate
+    //! Fill an array with random words
+    //!
+    //! \param[out] out - Destination
+    //! \param[in] count - Number of words
+    ///////////////////////////////////////////////////////////////////////////////
+    void generate(uint32_t* out, size_t count)
+    {
+      // Advance a local copy of the state  (Stores to the destination cannot alias it, so the lanes vectorize)
+      uint32_t s0[Lanes], s1[Lanes], s2[Lanes], s3[Lanes], block[Lanes];
+      std::copy(S0, S0+Lanes, s0);  std::copy(S1, S1+Lanes, s1);
+      std::copy(S2, S2+Lanes, s2);  std::copy(S3, S3+Lanes, s3);
+
+      auto rotl = [](uint32_t x, int k) { return (x << k) | (x >> (32 - k)); };
+      for (size_t n = 0; n < count; n += Lanes)
+      {
+        for (size_t l = 0; l < Lanes; ++l)
+        {
+          const uint32_t t = s1[l] << 9,
+                         r = rotl(s1[l] + (s1[l] << 2), 7);      // s1*5, rotated
+          block[l] = r + (r << 3);                              // ...*9
+          s2[l] ^= s0[l];
+          s3[l] ^= s1[l];
+          s1[l] ^= s2[l];
+          s0[l] ^= s3[l];
+          s2[l] ^= t;
+          s3[l] = rotl(s3[l], 11);
+        }
+        std::copy(block, block + std::min(Lanes, count - n), out + n);
+      }
+
+      std::copy(s0, s0+Lanes, S0);  std::copy(s1, s1+Lanes, S1);
+      std::copy(s2, s2+Lanes, S2);  std::copy(s3, s3+Lanes, S3);
+    }
+  };
+
+  //! \var Xoshiro128::Lanes - Number of streams
+  constexpr size_t  Xoshiro128::Lanes;
+
+} } // namespace hw1::render
+
+#endif